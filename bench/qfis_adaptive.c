@@ -0,0 +1,153 @@
+/*!
+ * @file qfis_adaptive.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ * @brief Cost and accuracy of the adaptive de-fuzzification of qFIS. The
+ * tipper example of the documentation is evaluated over an 11x11 grid of
+ * inputs with the uniform sampling of 100 points and with
+ * qFIS_SetDeFuzzAdaptive( f, 8, 0.01 ). Both are compared against a uniform
+ * sampling of 20000 points, and the cost is given as the number of output
+ * membership function evaluations per de-fuzzification.
+ *
+ * Usage : qfis_adaptive
+ **/
+
+#include "qfis.h"
+#include <math.h>
+#include <stdio.h>
+
+#define GRID        ( 11 )
+#define REF_POINTS  ( 20000 )
+
+enum { service, food };
+enum { tip };
+enum { poor, good, excellent, rancid, delicious };
+enum { cheap, average, generous };
+
+static const qFIS_Rules_t rules[] = {
+    QFIS_RULES_BEGIN
+        IF service IS poor OR food IS rancid THEN tip IS cheap END
+        IF service IS good THEN tip IS average END
+        IF service IS excellent OR food IS delicious THEN tip IS generous END
+    QFIS_RULES_END
+};
+static const float poor_p[] = { 1.5f, 0.0f };
+static const float good_p[] = { 1.5f, 5.0f };
+static const float excellent_p[] = { 1.5f, 10.0f };
+static const float rancid_p[] = { 0.0f, 0.0f, 1.0f, 3.0f };
+static const float delicious_p[] = { 7.0f, 9.0f, 10.0f, 10.0f };
+static const float cheap_p[] = { 0.0f, 5.0f, 10.0f };
+static const float average_p[] = { 10.0f, 15.0f, 20.0f };
+static const float generous_p[] = { 20.0f, 25.0f, 30.0f };
+
+static unsigned long nEval = 0UL;
+
+/*============================================================================*/
+static float adp_TriMF( const qFIS_IO_Base_t * const in,
+                        const float *p,
+                        const size_t n )
+{
+    const float x = in[ 0 ].value;
+    float y = 0.0F;
+    (void)n;
+
+    ++nEval;
+    if ( ( x > p[ 0 ] ) && ( x < p[ 2 ] ) ) {
+        y = ( x <= p[ 1 ] ) ? ( ( x - p[ 0 ] )/( p[ 1 ] - p[ 0 ] ) )
+                            : ( ( p[ 2 ] - x )/( p[ 2 ] - p[ 1 ] ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static void adp_Setup( qFIS_t * const f,
+                       qFIS_Input_t * const in,
+                       qFIS_Output_t * const out,
+                       qFIS_MF_t * const mfIn,
+                       qFIS_MF_t * const mfOut,
+                       float * const w )
+{
+    (void)qFIS_InputSetup( in, service, 0.0f, 10.0f );
+    (void)qFIS_InputSetup( in, food, 0.0f, 10.0f );
+    (void)qFIS_OutputSetup( out, tip, 0.0f, 30.0f );
+    (void)qFIS_SetMF( mfIn, service, poor, gaussmf, NULL, poor_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, service, good, gaussmf, NULL, good_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, service, excellent, gaussmf, NULL, excellent_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, food, rancid, trapmf, NULL, rancid_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, food, delicious, trapmf, NULL, delicious_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, tip, cheap, custommf, &adp_TriMF, cheap_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, tip, average, custommf, &adp_TriMF, average_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, tip, generous, custommf, &adp_TriMF, generous_p, 1.0f );
+    (void)qFIS_Setup( f, Mamdani, in, 2U*sizeof(qFIS_Input_t), out, sizeof(qFIS_Output_t),
+                      mfIn, 5U*sizeof(qFIS_MF_t), mfOut, 3U*sizeof(qFIS_MF_t), rules, w, 3U );
+}
+/*============================================================================*/
+static float adp_Eval( qFIS_t * const f,
+                       qFIS_Input_t * const in,
+                       qFIS_Output_t * const out,
+                       const float xs,
+                       const float xf )
+{
+    (void)qFIS_SetInput( in, service, xs );
+    (void)qFIS_SetInput( in, food, xf );
+    (void)qFIS_Fuzzify( f );
+    (void)qFIS_Inference( f );
+    (void)qFIS_DeFuzzify( f );
+
+    return qFIS_GetOutput( out, tip );
+}
+/*============================================================================*/
+int main( void )
+{
+    static const char * const names[] = { "centroid", "bisector" };
+    qFIS_t ref, uni, adp;
+    qFIS_Input_t rIn[ 2 ], uIn[ 2 ], aIn[ 2 ];
+    qFIS_Output_t rOut[ 1 ], uOut[ 1 ], aOut[ 1 ];
+    qFIS_MF_t rMFIn[ 5 ], rMFOut[ 3 ], uMFIn[ 5 ], uMFOut[ 3 ], aMFIn[ 5 ], aMFOut[ 3 ];
+    float rw[ 3 ], uw[ 3 ], aw[ 3 ];
+    int m, a, b;
+
+    adp_Setup( &ref, rIn, rOut, rMFIn, rMFOut, rw );
+    adp_Setup( &uni, uIn, uOut, uMFIn, uMFOut, uw );
+    adp_Setup( &adp, aIn, aOut, aMFIn, aMFOut, aw );
+    (void)qFIS_SetParameter( &ref, qFIS_EvalPoints, (qFIS_ParamValue_t)REF_POINTS );
+    (void)qFIS_SetParameter( &uni, qFIS_EvalPoints, 100 );
+    (void)qFIS_SetDeFuzzAdaptive( &adp, 8U, 0.01f );
+
+    (void)printf( "| Method      | Sampling | Evaluations | Max. error | Mean error |\n" );
+    (void)printf( "|-------------|----------|-------------|------------|------------|\n" );
+    for ( m = 0 ; m < 2 ; ++m ) {
+        const qFIS_DeFuzz_Method_t method = ( 0 == m ) ? centroid : bisector;
+        double uMax = 0.0, uSum = 0.0, aMax = 0.0, aSum = 0.0;
+        unsigned long uEval = 0UL, aEval = 0UL;
+
+        (void)qFIS_SetDeFuzzMethod( &ref, method );
+        (void)qFIS_SetDeFuzzMethod( &uni, method );
+        (void)qFIS_SetDeFuzzMethod( &adp, method );
+        for ( a = 0 ; a < GRID ; ++a ) {
+            for ( b = 0 ; b < GRID ; ++b ) {
+                const float xs = (float)a;
+                const float xf = (float)b;
+                const double yr = (double)adp_Eval( &ref, rIn, rOut, xs, xf );
+                double e;
+
+                nEval = 0UL;
+                e = fabs( (double)adp_Eval( &uni, uIn, uOut, xs, xf ) - yr );
+                uEval += nEval;
+                uMax = ( e > uMax ) ? e : uMax;
+                uSum += e;
+                nEval = 0UL;
+                e = fabs( (double)adp_Eval( &adp, aIn, aOut, xs, xf ) - yr );
+                aEval += nEval;
+                aMax = ( e > aMax ) ? e : aMax;
+                aSum += e;
+            }
+        }
+        (void)printf( "| ::%-9s | uniform  | %-11.1f | %-10.2g | %-10.2g |\n", names[ m ],
+                      (double)uEval/(double)( GRID*GRID ), uMax, uSum/(double)( GRID*GRID ) );
+        (void)printf( "| ::%-9s | adaptive | %-11.1f | %-10.2g | %-10.2g |\n", names[ m ],
+                      (double)aEval/(double)( GRID*GRID ), aMax, aSum/(double)( GRID*GRID ) );
+    }
+
+    return 0;
+}
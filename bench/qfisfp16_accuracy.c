@@ -0,0 +1,393 @@
+/*!
+ * @file qfisfp16_accuracy.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ * @brief Accuracy of the fixed-point qFISFP16 engine against the
+ * floating-point qFIS engine. It reproduces the table of the qFIS
+ * documentation :
+ *
+ * - Every input membership function is swept over [ -10, 10 ] through a one
+ *   rule ::Sugeno system with a ::wtsum output, so the output is the degree.
+ * - The tipper example of the documentation is evaluated with the five
+ *   ::Mamdani de-fuzzification methods over a 41x41 grid of inputs.
+ * - A two input ::Sugeno system with @c sigmf, @c gaussmf and @c trimf
+ *   premises and @c linearmf / @c constantmf consequents is evaluated with
+ *   ::wtaver and ::wtsum over a 41x41 grid of inputs.
+ *
+ * The last column leaves out the inputs where the sum of the rule strengths
+ * of the floating-point engine is below 1e-3. There the fixed-point strengths
+ * are a few units of the last place, or zero, so ::wtaver divides quantization
+ * noise, or falls back to the middle of the output range when no rule fired.
+ *
+ * Usage : qfisfp16_accuracy
+ **/
+
+#include "qfis.h"
+#include "qfisfp16.h"
+#include <math.h>
+#include <stdio.h>
+
+#define GRID    ( 41 )
+#define WEAK    ( 1.0e-3f )
+
+typedef struct
+{
+    double maxErr, sumErr;
+    unsigned long n;
+} acc_stat_t;
+
+/*============================================================================*/
+static float acc_Strength( const float *w,
+                           const size_t n )
+{
+    float sum = 0.0f;
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        sum += w[ i ];
+    }
+
+    return sum;
+}
+/*============================================================================*/
+static void acc_Add( acc_stat_t * const s,
+                     const float a,
+                     const float b )
+{
+    const double e = fabs( (double)a - (double)b );
+
+    if ( e > s->maxErr ) {
+        s->maxErr = e;
+    }
+    s->sumErr += e;
+    ++s->n;
+}
+/*============================================================================*/
+static void acc_ToFP( qFP16_t *d,
+                      const float *s,
+                      const size_t n )
+{
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        d[ i ] = qFP16_FloatToFP( s[ i ] );
+    }
+}
+/*============================================================================*/
+static void acc_MembershipFunctions( void )
+{
+    enum { x };
+    enum { y };
+    enum { m };
+    enum { c };
+    static const qFIS_Rules_t rules[] = {
+        QFIS_RULES_BEGIN
+            IF x IS m THEN y IS c END
+        QFIS_RULES_END
+    };
+    static const char * const names[] = {
+        "trimf", "trapmf", "gbellmf", "gaussmf", "gauss2mf", "sigmf",
+        "dsigmf", "psigmf", "pimf", "smf", "zmf", "singletonmf", "concavemf",
+        "spikemf", "linsmf", "linzmf", "rectmf", "cosmf"
+    };
+    static const float p[][ 4 ] = {
+        { -3.0f, 1.0f, 4.0f, 0.0f },        /*trimf*/
+        { -6.0f, -2.0f, 3.0f, 7.0f },       /*trapmf*/
+        { 2.0f, 3.0f, 1.0f, 0.0f },         /*gbellmf*/
+        { 2.5f, 1.0f, 0.0f, 0.0f },         /*gaussmf*/
+        { 1.5f, -2.0f, 2.0f, 3.0f },        /*gauss2mf*/
+        { 1.5f, 1.0f, 0.0f, 0.0f },         /*sigmf*/
+        { 2.0f, -3.0f, 1.5f, 4.0f },        /*dsigmf*/
+        { 2.0f, -3.0f, -1.5f, 6.0f },       /*psigmf*/
+        { -6.0f, -1.0f, 2.0f, 7.0f },       /*pimf*/
+        { -4.0f, 4.0f, 0.0f, 0.0f },        /*smf*/
+        { -4.0f, 4.0f, 0.0f, 0.0f },        /*zmf*/
+        { 2.0f, 0.0f, 0.0f, 0.0f },         /*singletonmf*/
+        { -2.0f, 3.0f, 0.0f, 0.0f },        /*concavemf*/
+        { 4.0f, 1.0f, 0.0f, 0.0f },         /*spikemf*/
+        { -4.0f, 4.0f, 0.0f, 0.0f },        /*linsmf*/
+        { -4.0f, 4.0f, 0.0f, 0.0f },        /*linzmf*/
+        { -2.0f, 3.0f, 0.0f, 0.0f },        /*rectmf*/
+        { 0.0f, 6.0f, 0.0f, 0.0f },         /*cosmf*/
+    };
+    static const float one[ 1 ] = { 1.0f };
+    qFIS_t f;
+    qFIS_Input_t in[ 1 ];
+    qFIS_Output_t out[ 1 ];
+    qFIS_MF_t mfIn[ 1 ], mfOut[ 1 ];
+    float w[ 1 ];
+    qFISFP16_t g;
+    qFISFP16_Input_t gin[ 1 ];
+    qFISFP16_Output_t gout[ 1 ];
+    qFISFP16_MF_t gmfIn[ 1 ], gmfOut[ 1 ];
+    qFP16_t gw[ 1 ], gp[ 4 ], gone[ 1 ];
+    size_t s;
+    int k;
+
+    (void)printf( "| Membership function | Max. error |\n" );
+    (void)printf( "|---------------------|------------|\n" );
+    acc_ToFP( gone, one, 1U );
+    for ( s = 0U ; s < sizeof(names)/sizeof(names[ 0 ]) ; ++s ) {
+        const qFIS_MF_Name_t shape = (qFIS_MF_Name_t)( (int)trimf + (int)s );
+        acc_stat_t st = { 0.0, 0.0, 0UL };
+
+        acc_ToFP( gp, p[ s ], 4U );
+        (void)qFIS_InputSetup( in, x, -10.0f, 10.0f );
+        (void)qFIS_OutputSetup( out, y, -1.0f, 2.0f );
+        (void)qFIS_SetMF( mfIn, x, m, shape, NULL, p[ s ], 1.0f );
+        (void)qFIS_SetMF( mfOut, y, c, constantmf, NULL, one, 1.0f );
+        (void)qFIS_Setup( &f, Sugeno, in, sizeof(in), out, sizeof(out),
+                          mfIn, sizeof(mfIn), mfOut, sizeof(mfOut),
+                          rules, w, 1U );
+        (void)qFIS_SetDeFuzzMethod( &f, wtsum );
+        (void)qFISFP16_InputSetup( gin, x, qFP16_FloatToFP( -10.0f ), qFP16_FloatToFP( 10.0f ) );
+        (void)qFISFP16_OutputSetup( gout, y, qFP16_FloatToFP( -1.0f ), qFP16_FloatToFP( 2.0f ) );
+        (void)qFISFP16_SetMF( gmfIn, x, m, shape, NULL, gp, qFP16.one );
+        (void)qFISFP16_SetMF( gmfOut, y, c, constantmf, NULL, gone, qFP16.one );
+        (void)qFISFP16_Setup( &g, Sugeno, gin, sizeof(gin), gout, sizeof(gout),
+                              gmfIn, sizeof(gmfIn), gmfOut, sizeof(gmfOut),
+                              rules, gw, 1U );
+        (void)qFISFP16_SetDeFuzzMethod( &g, wtsum );
+        for ( k = 0 ; k <= 2000 ; ++k ) {
+            const float xk = -10.0f + ( 0.01f*(float)k );
+
+            (void)qFIS_SetInput( in, x, xk );
+            (void)qFIS_Fuzzify( &f );
+            (void)qFIS_Inference( &f );
+            (void)qFIS_DeFuzzify( &f );
+            (void)qFISFP16_SetInput( gin, x, qFP16_FloatToFP( xk ) );
+            (void)qFISFP16_Fuzzify( &g );
+            (void)qFISFP16_Inference( &g );
+            (void)qFISFP16_DeFuzzify( &g );
+            acc_Add( &st, qFIS_GetOutput( out, y ),
+                     qFP16_FPToFloat( qFISFP16_GetOutput( gout, y ) ) );
+        }
+        (void)printf( "| %-19s | %-10.2g |\n", names[ s ], st.maxErr );
+    }
+    (void)printf( "\n" );
+}
+/*============================================================================*/
+static void acc_Tipper( void )
+{
+    enum { service, food };
+    enum { tip };
+    enum { service_poor, service_good, service_excellent, food_rancid, food_delicious };
+    enum { tip_cheap, tip_average, tip_generous };
+    static const qFIS_Rules_t rules[] = {
+        QFIS_RULES_BEGIN
+            IF service IS service_poor OR food IS food_rancid THEN tip IS tip_cheap END
+            IF service IS service_good THEN tip IS tip_average END
+            IF service IS service_excellent OR food IS food_delicious THEN tip IS tip_generous END
+        QFIS_RULES_END
+    };
+    static const float service_poor_p[] = { 1.5f, 0.0f };
+    static const float service_good_p[] = { 1.5f, 5.0f };
+    static const float service_excellent_p[] = { 1.5f, 10.0f };
+    static const float food_rancid_p[] = { 0.0f, 0.0f, 1.0f, 3.0f };
+    static const float food_delicious_p[] = { 7.0f, 9.0f, 10.0f, 10.0f };
+    static const float tip_cheap_p[] = { 0.0f, 5.0f, 10.0f };
+    static const float tip_average_p[] = { 10.0f, 15.0f, 20.0f };
+    static const float tip_generous_p[] = { 20.0f, 25.0f, 30.0f };
+    static const char * const names[] = { "centroid", "bisector", "mom", "lom", "som" };
+    qFP16_t gsp[ 2 ], gsg[ 2 ], gse[ 2 ], gfr[ 4 ], gfd[ 4 ], gtc[ 3 ], gta[ 3 ], gtg[ 3 ];
+    qFIS_t f;
+    qFIS_Input_t in[ 2 ];
+    qFIS_Output_t out[ 1 ];
+    qFIS_MF_t mfIn[ 5 ], mfOut[ 3 ];
+    float w[ 3 ];
+    qFISFP16_t g;
+    qFISFP16_Input_t gin[ 2 ];
+    qFISFP16_Output_t gout[ 1 ];
+    qFISFP16_MF_t gmfIn[ 5 ], gmfOut[ 3 ];
+    qFP16_t gw[ 3 ];
+    int m, a, b;
+
+    acc_ToFP( gsp, service_poor_p, 2U );
+    acc_ToFP( gsg, service_good_p, 2U );
+    acc_ToFP( gse, service_excellent_p, 2U );
+    acc_ToFP( gfr, food_rancid_p, 4U );
+    acc_ToFP( gfd, food_delicious_p, 4U );
+    acc_ToFP( gtc, tip_cheap_p, 3U );
+    acc_ToFP( gta, tip_average_p, 3U );
+    acc_ToFP( gtg, tip_generous_p, 3U );
+
+    (void)qFIS_InputSetup( in, service, 0.0f, 10.0f );
+    (void)qFIS_InputSetup( in, food, 0.0f, 10.0f );
+    (void)qFIS_OutputSetup( out, tip, 0.0f, 30.0f );
+    (void)qFIS_SetMF( mfIn, service, service_poor, gaussmf, NULL, service_poor_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, service, service_good, gaussmf, NULL, service_good_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, service, service_excellent, gaussmf, NULL, service_excellent_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, food, food_rancid, trapmf, NULL, food_rancid_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, food, food_delicious, trapmf, NULL, food_delicious_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, tip, tip_cheap, trimf, NULL, tip_cheap_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, tip, tip_average, trimf, NULL, tip_average_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, tip, tip_generous, trimf, NULL, tip_generous_p, 1.0f );
+    (void)qFIS_Setup( &f, Mamdani, in, sizeof(in), out, sizeof(out),
+                      mfIn, sizeof(mfIn), mfOut, sizeof(mfOut), rules, w, 3U );
+
+    (void)qFISFP16_InputSetup( gin, service, 0, qFP16_FloatToFP( 10.0f ) );
+    (void)qFISFP16_InputSetup( gin, food, 0, qFP16_FloatToFP( 10.0f ) );
+    (void)qFISFP16_OutputSetup( gout, tip, 0, qFP16_FloatToFP( 30.0f ) );
+    (void)qFISFP16_SetMF( gmfIn, service, service_poor, gaussmf, NULL, gsp, qFP16.one );
+    (void)qFISFP16_SetMF( gmfIn, service, service_good, gaussmf, NULL, gsg, qFP16.one );
+    (void)qFISFP16_SetMF( gmfIn, service, service_excellent, gaussmf, NULL, gse, qFP16.one );
+    (void)qFISFP16_SetMF( gmfIn, food, food_rancid, trapmf, NULL, gfr, qFP16.one );
+    (void)qFISFP16_SetMF( gmfIn, food, food_delicious, trapmf, NULL, gfd, qFP16.one );
+    (void)qFISFP16_SetMF( gmfOut, tip, tip_cheap, trimf, NULL, gtc, qFP16.one );
+    (void)qFISFP16_SetMF( gmfOut, tip, tip_average, trimf, NULL, gta, qFP16.one );
+    (void)qFISFP16_SetMF( gmfOut, tip, tip_generous, trimf, NULL, gtg, qFP16.one );
+    (void)qFISFP16_Setup( &g, Mamdani, gin, sizeof(gin), gout, sizeof(gout),
+                          gmfIn, sizeof(gmfIn), gmfOut, sizeof(gmfOut), rules, gw, 3U );
+
+    for ( m = (int)centroid ; m <= (int)som ; ++m ) {
+        acc_stat_t st = { 0.0, 0.0, 0UL };
+        acc_stat_t fired = { 0.0, 0.0, 0UL };
+
+        (void)qFIS_SetDeFuzzMethod( &f, (qFIS_DeFuzz_Method_t)m );
+        (void)qFISFP16_SetDeFuzzMethod( &g, (qFIS_DeFuzz_Method_t)m );
+        for ( a = 0 ; a < GRID ; ++a ) {
+            for ( b = 0 ; b < GRID ; ++b ) {
+                const float xs = 0.25f*(float)a;
+                const float xf = 0.25f*(float)b;
+
+                (void)qFIS_SetInput( in, service, xs );
+                (void)qFIS_SetInput( in, food, xf );
+                (void)qFIS_Fuzzify( &f );
+                (void)qFIS_Inference( &f );
+                (void)qFIS_DeFuzzify( &f );
+                (void)qFISFP16_SetInput( gin, service, qFP16_FloatToFP( xs ) );
+                (void)qFISFP16_SetInput( gin, food, qFP16_FloatToFP( xf ) );
+                (void)qFISFP16_Fuzzify( &g );
+                (void)qFISFP16_Inference( &g );
+                (void)qFISFP16_DeFuzzify( &g );
+                acc_Add( &st, qFIS_GetOutput( out, tip ),
+                         qFP16_FPToFloat( qFISFP16_GetOutput( gout, tip ) ) );
+                if ( acc_Strength( w, 3U ) >= WEAK ) {
+                    acc_Add( &fired, qFIS_GetOutput( out, tip ),
+                             qFP16_FPToFloat( qFISFP16_GetOutput( gout, tip ) ) );
+                }
+            }
+        }
+        (void)printf( "| Mamdani  | ::%-9s | %-10.2g | %-10.2g | %-17.2g |\n",
+                      names[ m ], st.maxErr, st.sumErr/(double)st.n,
+                      fired.maxErr );
+    }
+}
+/*============================================================================*/
+static void acc_Sugeno( void )
+{
+    enum { x1, x2 };
+    enum { y };
+    enum { a1, a2, b1, b2 };
+    enum { c1, c2, c3, c4 };
+    static const qFIS_Rules_t rules[] = {
+        QFIS_RULES_BEGIN
+            IF x1 IS a1 AND x2 IS b1 THEN y IS c1 END
+            IF x1 IS a1 AND x2 IS_NOT b2 THEN y IS c2 END
+            IF x1 IS a2 OR x2 IS b1 THEN y IS c3 END
+            IF x1 IS a2 AND x2 IS b2 THEN y IS c4 END
+        QFIS_RULES_END
+    };
+    static const float a1_p[] = { 2.0f, -5.0f };
+    static const float a2_p[] = { 2.0f, 5.0f };
+    static const float b1_p[] = { -10.0f, 0.0f, 2.0f };
+    static const float b2_p[] = { -2.0f, 5.0f, 10.0f };
+    static const float c1_p[] = { 1.0f, 2.0f, 3.0f };
+    static const float c2_p[] = { 0.5f };
+    static const float c3_p[] = { -1.0f, 0.5f, 4.0f };
+    static const float c4_p[] = { 3.0f };
+    qFP16_t ga1[ 2 ], ga2[ 2 ], gb1[ 3 ], gb2[ 3 ], gc1[ 3 ], gc2[ 1 ], gc3[ 3 ], gc4[ 1 ];
+    qFIS_t f;
+    qFIS_Input_t in[ 2 ];
+    qFIS_Output_t out[ 1 ];
+    qFIS_MF_t mfIn[ 4 ], mfOut[ 4 ];
+    float w[ 4 ];
+    qFISFP16_t g;
+    qFISFP16_Input_t gin[ 2 ];
+    qFISFP16_Output_t gout[ 1 ];
+    qFISFP16_MF_t gmfIn[ 4 ], gmfOut[ 4 ];
+    qFP16_t gw[ 4 ];
+    int m, a, b;
+
+    acc_ToFP( ga1, a1_p, 2U );
+    acc_ToFP( ga2, a2_p, 2U );
+    acc_ToFP( gb1, b1_p, 3U );
+    acc_ToFP( gb2, b2_p, 3U );
+    acc_ToFP( gc1, c1_p, 3U );
+    acc_ToFP( gc2, c2_p, 1U );
+    acc_ToFP( gc3, c3_p, 3U );
+    acc_ToFP( gc4, c4_p, 1U );
+
+    (void)qFIS_InputSetup( in, x1, -10.0f, 10.0f );
+    (void)qFIS_InputSetup( in, x2, -10.0f, 10.0f );
+    (void)qFIS_OutputSetup( out, y, -100.0f, 100.0f );
+    (void)qFIS_SetMF( mfIn, x1, a1, sigmf, NULL, a1_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, x1, a2, gaussmf, NULL, a2_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, x2, b1, trimf, NULL, b1_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, x2, b2, trimf, NULL, b2_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, y, c1, linearmf, NULL, c1_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, y, c2, constantmf, NULL, c2_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, y, c3, linearmf, NULL, c3_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, y, c4, constantmf, NULL, c4_p, 1.0f );
+    (void)qFIS_Setup( &f, Sugeno, in, sizeof(in), out, sizeof(out),
+                      mfIn, sizeof(mfIn), mfOut, sizeof(mfOut), rules, w, 4U );
+
+    (void)qFISFP16_InputSetup( gin, x1, qFP16_FloatToFP( -10.0f ), qFP16_FloatToFP( 10.0f ) );
+    (void)qFISFP16_InputSetup( gin, x2, qFP16_FloatToFP( -10.0f ), qFP16_FloatToFP( 10.0f ) );
+    (void)qFISFP16_OutputSetup( gout, y, qFP16_FloatToFP( -100.0f ), qFP16_FloatToFP( 100.0f ) );
+    (void)qFISFP16_SetMF( gmfIn, x1, a1, sigmf, NULL, ga1, qFP16.one );
+    (void)qFISFP16_SetMF( gmfIn, x1, a2, gaussmf, NULL, ga2, qFP16.one );
+    (void)qFISFP16_SetMF( gmfIn, x2, b1, trimf, NULL, gb1, qFP16.one );
+    (void)qFISFP16_SetMF( gmfIn, x2, b2, trimf, NULL, gb2, qFP16.one );
+    (void)qFISFP16_SetMF( gmfOut, y, c1, linearmf, NULL, gc1, qFP16.one );
+    (void)qFISFP16_SetMF( gmfOut, y, c2, constantmf, NULL, gc2, qFP16.one );
+    (void)qFISFP16_SetMF( gmfOut, y, c3, linearmf, NULL, gc3, qFP16.one );
+    (void)qFISFP16_SetMF( gmfOut, y, c4, constantmf, NULL, gc4, qFP16.one );
+    (void)qFISFP16_Setup( &g, Sugeno, gin, sizeof(gin), gout, sizeof(gout),
+                          gmfIn, sizeof(gmfIn), gmfOut, sizeof(gmfOut), rules, gw, 4U );
+
+    for ( m = (int)wtaver ; m <= (int)wtsum ; ++m ) {
+        acc_stat_t st = { 0.0, 0.0, 0UL };
+        acc_stat_t fired = { 0.0, 0.0, 0UL };
+
+        (void)qFIS_SetDeFuzzMethod( &f, (qFIS_DeFuzz_Method_t)m );
+        (void)qFISFP16_SetDeFuzzMethod( &g, (qFIS_DeFuzz_Method_t)m );
+        for ( a = 0 ; a < GRID ; ++a ) {
+            for ( b = 0 ; b < GRID ; ++b ) {
+                const float u1 = -10.0f + ( 0.5f*(float)a );
+                const float u2 = -10.0f + ( 0.5f*(float)b );
+
+                (void)qFIS_SetInput( in, x1, u1 );
+                (void)qFIS_SetInput( in, x2, u2 );
+                (void)qFIS_Fuzzify( &f );
+                (void)qFIS_Inference( &f );
+                (void)qFIS_DeFuzzify( &f );
+                (void)qFISFP16_SetInput( gin, x1, qFP16_FloatToFP( u1 ) );
+                (void)qFISFP16_SetInput( gin, x2, qFP16_FloatToFP( u2 ) );
+                (void)qFISFP16_Fuzzify( &g );
+                (void)qFISFP16_Inference( &g );
+                (void)qFISFP16_DeFuzzify( &g );
+                acc_Add( &st, qFIS_GetOutput( out, y ),
+                         qFP16_FPToFloat( qFISFP16_GetOutput( gout, y ) ) );
+                if ( acc_Strength( w, 4U ) >= WEAK ) {
+                    acc_Add( &fired, qFIS_GetOutput( out, y ),
+                             qFP16_FPToFloat( qFISFP16_GetOutput( gout, y ) ) );
+                }
+            }
+        }
+        (void)printf( "| Sugeno   | ::%-9s | %-10.2g | %-10.2g | %-17.2g |\n",
+                      ( (int)wtaver == m ) ? "wtaver" : "wtsum",
+                      st.maxErr, st.sumErr/(double)st.n, fired.maxErr );
+    }
+}
+/*============================================================================*/
+int main( void )
+{
+    acc_MembershipFunctions();
+    (void)printf( "| System   | Method      | Max. error | Mean error | Max. error, fired |\n" );
+    (void)printf( "|----------|-------------|------------|------------|-------------------|\n" );
+    acc_Tipper();
+    acc_Sugeno();
+
+    return 0;
+}
@@ -0,0 +1,273 @@
+/*!
+ * @file qfismodel_check.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ * @brief Check of the binary FIS model loader. Two systems are written as the
+ * text of a MATLAB @c .fis file, converted with qFIS_ImportFIS(), loaded with
+ * qFIS_LoadModel() and compared against the same systems built by hand with
+ * qFIS_SetMF() and qFIS_Setup() over a 41x41 grid of inputs :
+ *
+ * - The ::Mamdani tipper example of the documentation.
+ * - A ::Sugeno system with @c linear and @c constant consequents, a negated
+ *   premise and a weighted rule.
+ *
+ * Both instances use the same parameters and operators, so the outputs
+ * should be identical.
+ *
+ * Usage : qfismodel_check ( returns 0 when every output matches )
+ **/
+
+#include "qfis.h"
+#include "qfismodel.h"
+#include <stdio.h>
+
+#define GRID    ( 41 )
+
+static const char tipperText[] =
+    "[System]\n"
+    "Name='tipper'\n"
+    "Type='mamdani'\n"
+    "NumInputs=2\n"
+    "NumOutputs=1\n"
+    "NumRules=3\n"
+    "AndMethod='min'\n"
+    "OrMethod='max'\n"
+    "ImpMethod='min'\n"
+    "AggMethod='max'\n"
+    "DefuzzMethod='centroid'\n"
+    "\n"
+    "[Input1]\n"
+    "Name='service'\n"
+    "Range=[0 10]\n"
+    "NumMFs=3\n"
+    "MF1='poor':'gaussmf',[1.5 0]\n"
+    "MF2='good':'gaussmf',[1.5 5]\n"
+    "MF3='excellent':'gaussmf',[1.5 10]\n"
+    "\n"
+    "[Input2]\n"
+    "Name='food'\n"
+    "Range=[0 10]\n"
+    "NumMFs=2\n"
+    "MF1='rancid':'trapmf',[0 0 1 3]\n"
+    "MF2='delicious':'trapmf',[7 9 10 10]\n"
+    "\n"
+    "[Output1]\n"
+    "Name='tip'\n"
+    "Range=[0 30]\n"
+    "NumMFs=3\n"
+    "MF1='cheap':'trimf',[0 5 10]\n"
+    "MF2='average':'trimf',[10 15 20]\n"
+    "MF3='generous':'trimf',[20 25 30]\n"
+    "\n"
+    "[Rules]\n"
+    "1 1, 1 (1) : 2\n"
+    "2 0, 2 (1) : 1\n"
+    "3 2, 3 (1) : 2\n";
+
+static const char sugenoText[] =
+    "[System]\n"
+    "Name='sugeno'\n"
+    "Type='sugeno'\n"
+    "NumInputs=2\n"
+    "NumOutputs=1\n"
+    "NumRules=3\n"
+    "AndMethod='prod'\n"
+    "OrMethod='probor'\n"
+    "ImpMethod='prod'\n"
+    "AggMethod='sum'\n"
+    "DefuzzMethod='wtaver'\n"
+    "\n"
+    "[Input1]\n"
+    "Name='x1'\n"
+    "Range=[-10 10]\n"
+    "NumMFs=2\n"
+    "MF1='a1':'sigmf',[2 -5]\n"
+    "MF2='a2':'gaussmf',[2 5]\n"
+    "\n"
+    "[Input2]\n"
+    "Name='x2'\n"
+    "Range=[-10 10]\n"
+    "NumMFs=2\n"
+    "MF1='b1':'trimf',[-10 0 2]\n"
+    "MF2='b2':'trimf',[-2 5 10]\n"
+    "\n"
+    "[Output1]\n"
+    "Name='y'\n"
+    "Range=[-100 100]\n"
+    "NumMFs=3\n"
+    "MF1='c1':'linear',[1 2 3]\n"
+    "MF2='c2':'constant',[0.5]\n"
+    "MF3='c3':'linear',[-1 0.5 4]\n"
+    "\n"
+    "[Rules]\n"
+    "1 1, 1 (1) : 1\n"
+    "1 -2, 2 (0.5) : 1\n"
+    "2 1, 3 (1) : 2\n";
+
+static uint32_t model[ 256 ];
+
+/*============================================================================*/
+static int check_Compare( qFIS_t * const hand,
+                          qFIS_Input_t * const hIn,
+                          qFIS_Output_t * const hOut,
+                          qFIS_t * const loaded,
+                          qFIS_Input_t * const lIn,
+                          qFIS_Output_t * const lOut,
+                          const float xMin,
+                          const float xMax,
+                          const char *name )
+{
+    const float step = ( xMax - xMin )/(float)( GRID - 1 );
+    unsigned long nDiff = 0UL;
+    int a, b;
+
+    for ( a = 0 ; a < GRID ; ++a ) {
+        for ( b = 0 ; b < GRID ; ++b ) {
+            const float u0 = xMin + ( step*(float)a );
+            const float u1 = xMin + ( step*(float)b );
+
+            (void)qFIS_SetInput( hIn, 0, u0 );
+            (void)qFIS_SetInput( hIn, 1, u1 );
+            (void)qFIS_Fuzzify( hand );
+            (void)qFIS_Inference( hand );
+            (void)qFIS_DeFuzzify( hand );
+            (void)qFIS_SetInput( lIn, 0, u0 );
+            (void)qFIS_SetInput( lIn, 1, u1 );
+            (void)qFIS_Fuzzify( loaded );
+            (void)qFIS_Inference( loaded );
+            (void)qFIS_DeFuzzify( loaded );
+            if ( qFIS_GetOutput( hOut, 0 ) != qFIS_GetOutput( lOut, 0 ) ) {
+                ++nDiff;
+            }
+        }
+    }
+    (void)printf( "%-7s : %lu of %d outputs differ\n", name, nDiff, GRID*GRID );
+
+    return ( 0UL == nDiff ) ? 1 : 0;
+}
+/*============================================================================*/
+static int check_Tipper( void )
+{
+    enum { service, food };
+    enum { tip };
+    enum { poor, good, excellent, rancid, delicious };
+    enum { cheap, average, generous };
+    static const qFIS_Rules_t rules[] = {
+        QFIS_RULES_BEGIN
+            IF service IS poor OR food IS rancid THEN tip IS cheap END
+            IF service IS good THEN tip IS average END
+            IF service IS excellent OR food IS delicious THEN tip IS generous END
+        QFIS_RULES_END
+    };
+    static const float poor_p[] = { 1.5f, 0.0f };
+    static const float good_p[] = { 1.5f, 5.0f };
+    static const float excellent_p[] = { 1.5f, 10.0f };
+    static const float rancid_p[] = { 0.0f, 0.0f, 1.0f, 3.0f };
+    static const float delicious_p[] = { 7.0f, 9.0f, 10.0f, 10.0f };
+    static const float cheap_p[] = { 0.0f, 5.0f, 10.0f };
+    static const float average_p[] = { 10.0f, 15.0f, 20.0f };
+    static const float generous_p[] = { 20.0f, 25.0f, 30.0f };
+    qFIS_t f, g;
+    qFIS_Input_t in[ 2 ], gin[ 2 ];
+    qFIS_Output_t out[ 1 ], gout[ 1 ];
+    qFIS_MF_t mfIn[ 5 ], mfOut[ 3 ], gmfIn[ 5 ], gmfOut[ 3 ];
+    float w[ 3 ], gw[ 3 ];
+    size_t n;
+    int retVal = 0;
+
+    (void)qFIS_InputSetup( in, service, 0.0f, 10.0f );
+    (void)qFIS_InputSetup( in, food, 0.0f, 10.0f );
+    (void)qFIS_OutputSetup( out, tip, 0.0f, 30.0f );
+    (void)qFIS_SetMF( mfIn, service, poor, gaussmf, NULL, poor_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, service, good, gaussmf, NULL, good_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, service, excellent, gaussmf, NULL, excellent_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, food, rancid, trapmf, NULL, rancid_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, food, delicious, trapmf, NULL, delicious_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, tip, cheap, trimf, NULL, cheap_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, tip, average, trimf, NULL, average_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, tip, generous, trimf, NULL, generous_p, 1.0f );
+    (void)qFIS_Setup( &f, Mamdani, in, sizeof(in), out, sizeof(out),
+                      mfIn, sizeof(mfIn), mfOut, sizeof(mfOut), rules, w, 3U );
+
+    n = qFIS_ImportFIS( tipperText, model, sizeof(model) );
+    if ( ( 0U == n ) ||
+         ( 0 == qFIS_LoadModel( &g, model, n, gin, sizeof(gin), gout, sizeof(gout),
+                                gmfIn, sizeof(gmfIn), gmfOut, sizeof(gmfOut), gw, 3U ) ) ) {
+        (void)printf( "tipper  : the model could not be loaded\n" );
+    }
+    else {
+        retVal = check_Compare( &f, in, out, &g, gin, gout, 0.0f, 10.0f, "tipper" );
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static int check_Sugeno( void )
+{
+    enum { x1, x2 };
+    enum { y };
+    enum { a1, a2, b1, b2 };
+    enum { c1, c2, c3 };
+    static const qFIS_Rules_t rules[] = {
+        QFIS_RULES_BEGIN
+            IF x1 IS a1 AND x2 IS b1 THEN y IS c1 END
+            IF x1 IS a1 AND x2 IS_NOT b2 THEN y IS c2 END
+            IF x1 IS a2 OR x2 IS b1 THEN y IS c3 END
+        QFIS_RULES_END
+    };
+    static const float a1_p[] = { 2.0f, -5.0f };
+    static const float a2_p[] = { 2.0f, 5.0f };
+    static const float b1_p[] = { -10.0f, 0.0f, 2.0f };
+    static const float b2_p[] = { -2.0f, 5.0f, 10.0f };
+    static const float c1_p[] = { 1.0f, 2.0f, 3.0f };
+    static const float c2_p[] = { 0.5f };
+    static const float c3_p[] = { -1.0f, 0.5f, 4.0f };
+    static float rw[] = { 1.0f, 0.5f, 1.0f };
+    qFIS_t f, g;
+    qFIS_Input_t in[ 2 ], gin[ 2 ];
+    qFIS_Output_t out[ 1 ], gout[ 1 ];
+    qFIS_MF_t mfIn[ 4 ], mfOut[ 3 ], gmfIn[ 4 ], gmfOut[ 3 ];
+    float w[ 3 ], gw[ 3 ];
+    size_t n;
+    int retVal = 0;
+
+    (void)qFIS_InputSetup( in, x1, -10.0f, 10.0f );
+    (void)qFIS_InputSetup( in, x2, -10.0f, 10.0f );
+    (void)qFIS_OutputSetup( out, y, -100.0f, 100.0f );
+    (void)qFIS_SetMF( mfIn, x1, a1, sigmf, NULL, a1_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, x1, a2, gaussmf, NULL, a2_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, x2, b1, trimf, NULL, b1_p, 1.0f );
+    (void)qFIS_SetMF( mfIn, x2, b2, trimf, NULL, b2_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, y, c1, linearmf, NULL, c1_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, y, c2, constantmf, NULL, c2_p, 1.0f );
+    (void)qFIS_SetMF( mfOut, y, c3, linearmf, NULL, c3_p, 1.0f );
+    (void)qFIS_Setup( &f, Sugeno, in, sizeof(in), out, sizeof(out),
+                      mfIn, sizeof(mfIn), mfOut, sizeof(mfOut), rules, w, 3U );
+    (void)qFIS_SetParameter( &f, qFIS_AND, qFIS_PROD );
+    (void)qFIS_SetParameter( &f, qFIS_OR, qFIS_PROBOR );
+    (void)qFIS_SetParameter( &f, qFIS_Implication, qFIS_PROD );
+    (void)qFIS_SetParameter( &f, qFIS_Aggregation, qFIS_SUM );
+    (void)qFIS_SetRuleWeights( &f, rw );
+
+    n = qFIS_ImportFIS( sugenoText, model, sizeof(model) );
+    if ( ( 0U == n ) ||
+         ( 0 == qFIS_LoadModel( &g, model, n, gin, sizeof(gin), gout, sizeof(gout),
+                                gmfIn, sizeof(gmfIn), gmfOut, sizeof(gmfOut), gw, 3U ) ) ) {
+        (void)printf( "sugeno  : the model could not be loaded\n" );
+    }
+    else {
+        retVal = check_Compare( &f, in, out, &g, gin, gout, -10.0f, 10.0f, "sugeno" );
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int main( void )
+{
+    int ok = 1;
+
+    ok &= check_Tipper();
+    ok &= check_Sugeno();
+
+    return ( 1 == ok ) ? 0 : 1;
+}
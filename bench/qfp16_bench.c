@@ -0,0 +1,913 @@
+/*!
+ * @file qfp16_bench.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ * @brief Accuracy and speed benchmark of the qFP16 and qFPQ APIs. Each
+ * function is evaluated against a double precision reference over its whole
+ * domain (exhaustively for functions of one argument and densely sampled for
+ * functions of two arguments), reporting the error in LSBs of its output
+ * format, the behavior of results that fall out of the range of that format
+ * and the cost per operation. The array and text functions of qFP16 are then
+ * compared element by element against the scalar functions they replace,
+ * reporting the mismatches, the error and the cost per element of both.
+ *
+ * Usage : qfp16_bench [-s shift] [-p log2pairs] [-f filter]
+ *  -s  Test one of every 2^shift inputs of the one-argument functions
+ *      (default 0, exhaustive).
+ *  -p  Number of sampled pairs of the two-argument functions, and of
+ *      elements of the array and text functions, as a power of two
+ *      (default 26).
+ *  -f  Only run the functions whose name contains this text.
+ *
+ * The sweeps run in parallel when the benchmark is built with OpenMP.
+ **/
+
+#include "qfp16.h"
+#include "qfpq.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+#define BENCH_CHUNK         ( 65536U )
+#define BENCH_TIME_SAMPLES  ( 4096U )
+#define BENCH_BLOCK         ( 256U )
+#define BENCH_FIELD         ( 24U )
+
+typedef int32_t (*bench_fcn_t)( const int32_t x, const int32_t y );
+typedef double (*bench_val_t)( const int32_t x, const int32_t y );
+typedef double (*bench_ref_t)( const double x, const double y );
+typedef void (*bench_arr_t)( qFP16_t * const z,
+                             const qFP16_t * const x,
+                             const qFP16_t * const y,
+                             const size_t n );
+
+typedef struct
+{
+    double scale;           /*raw units per unit*/
+    double lo, hi;          /*raw range of the results*/
+    int marked;             /*the format reports overflows with a marker*/
+} bench_fmt_t;
+
+typedef struct
+{
+    const char *name;
+    bench_fcn_t fcn;        /*function under test, on raw values*/
+    bench_val_t val;        /*its result when it is not a raw value, or NULL*/
+    bench_ref_t ref;        /*double precision reference*/
+    const bench_fmt_t *in;  /*format of the arguments*/
+    const bench_fmt_t *out; /*format of the result*/
+    int args;               /*number of arguments*/
+    double xl, xh;          /*domain of x*/
+    double yl, yh;          /*domain of y*/
+    double period;          /*results are compared modulo this, if not zero*/
+} bench_case_t;
+
+typedef struct
+{
+    const char *name;
+    bench_arr_t fcn;        /*array function under test*/
+    bench_arr_t elem;       /*the same, computed one element at a time*/
+    bench_ref_t ref;        /*double precision reference of each element*/
+    int reduce;             /*the result is the sum of the block*/
+    int broadcast;          /*the first y is used for the whole block*/
+    double xl, xh;          /*domain of x*/
+    double yl, yh;          /*domain of y*/
+} bench_array_t;
+
+typedef struct
+{
+    uint64_t n;             /*samples with the result inside the range*/
+    uint64_t out;           /*samples with the result outside the range*/
+    uint64_t outBad;        /*out of range, but neither overflow nor saturated*/
+    uint64_t spurious;      /*inside the range, but reported as overflow*/
+    uint64_t mismatch;      /*array results that differ from the scalar ones*/
+    double maxErr, sumErr;
+    int32_t xMax, yMax;     /*arguments of the maximum error*/
+} bench_stat_t;
+
+static const bench_fmt_t fmtFP16 = { 65536.0, -2147483647.0, 2147483647.0, 1 };
+static const bench_fmt_t fmtInt = { 1.0, -2147483648.0, 2147483647.0, 0 };
+static const bench_fmt_t fmtQ15 = { 32768.0, -32768.0, 32767.0, 0 };
+static const bench_fmt_t fmtQ31 = { 2147483648.0, -2147483648.0, 2147483647.0, 0 };
+static const bench_fmt_t fmtQ8_24 = { 16777216.0, -2147483648.0, 2147483647.0, 0 };
+
+#define FULL        -32767.99999, 32767.99999
+#define FRAC        -0.5, 0.5
+#define PI          3.14159265358979323846
+#define NONE        0.0, 0.0
+#define FP16        &fmtFP16, &fmtFP16
+
+static qFP16_Settings_t ctx; /*rounding and overflow detection, read-only*/
+
+/*coefficients of the qFP16_Polyval() case, in descending powers*/
+static const qFP16_t poly[ 4 ] = {
+    qFP16_Constant( 0.5 ), qFP16_Constant( -1.25 ),
+    qFP16_Constant( 2.0 ), qFP16_Constant( 3.0 )
+};
+
+/*============================================================================*/
+static qFP16_t f_Abs( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Abs_Ctx( &ctx, x ); }
+static qFP16_t f_Floor( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Floor( x ); }
+static qFP16_t f_Ceil( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Ceil( x ); }
+static qFP16_t f_Round( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Round( x ); }
+static qFP16_t f_FPToInt( const qFP16_t x, const qFP16_t y ) { (void)y; return (qFP16_t)qFP16_FPToInt_Ctx( &ctx, x ); }
+static qFP16_t f_FloatToFP( const qFP16_t x, const qFP16_t y ) { return qFP16_FloatToFP_Ctx( &ctx, (float)( ( (double)x + ( (double)y/65536.0 ) )/65536.0 ) ); }
+static qFP16_t f_Sqrt( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Sqrt_Ctx( &ctx, x ); }
+static qFP16_t f_Exp( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Exp_Ctx( &ctx, x ); }
+static qFP16_t f_Log( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Log_Ctx( &ctx, x ); }
+static qFP16_t f_Log2( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Log2_Ctx( &ctx, x ); }
+static qFP16_t f_RadToDeg( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_RadToDeg_Ctx( &ctx, x ); }
+static qFP16_t f_DegToRad( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_DegToRad_Ctx( &ctx, x ); }
+static qFP16_t f_WrapToPi( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_WrapToPi( x ); }
+static qFP16_t f_WrapTo180( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_WrapTo180( x ); }
+static qFP16_t f_Sin( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Sin_Ctx( &ctx, x ); }
+static qFP16_t f_Cos( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Cos_Ctx( &ctx, x ); }
+static qFP16_t f_Tan( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Tan_Ctx( &ctx, x ); }
+static qFP16_t f_Atan( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Atan_Ctx( &ctx, x ); }
+static qFP16_t f_Asin( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Asin_Ctx( &ctx, x ); }
+static qFP16_t f_Acos( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Acos_Ctx( &ctx, x ); }
+static qFP16_t f_Sinh( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Sinh_Ctx( &ctx, x ); }
+static qFP16_t f_Cosh( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Cosh_Ctx( &ctx, x ); }
+static qFP16_t f_Tanh( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Tanh_Ctx( &ctx, x ); }
+static qFP16_t f_Polyval( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_Polyval_Ctx( &ctx, poly, 4U, x ); }
+static qFP16_t f_CordicSin( const qFP16_t x, const qFP16_t y ) { qFP16_t s = y; (void)qFP16_CordicSinCos( x, &s, NULL ); return s; }
+static qFP16_t f_CordicCos( const qFP16_t x, const qFP16_t y ) { qFP16_t c = y; (void)qFP16_CordicSinCos( x, NULL, &c ); return c; }
+static qFP16_t f_CordicSqrt( const qFP16_t x, const qFP16_t y ) { (void)y; return qFP16_CordicSqrt( x ); }
+static qFP16_t f_Add( const qFP16_t x, const qFP16_t y ) { return qFP16_Add_Ctx( &ctx, x, y ); }
+static qFP16_t f_Sub( const qFP16_t x, const qFP16_t y ) { return qFP16_Sub_Ctx( &ctx, x, y ); }
+static qFP16_t f_Mul( const qFP16_t x, const qFP16_t y ) { return qFP16_Mul_Ctx( &ctx, x, y ); }
+static qFP16_t f_Div( const qFP16_t x, const qFP16_t y ) { return qFP16_Div_Ctx( &ctx, x, y ); }
+static qFP16_t f_Mod( const qFP16_t x, const qFP16_t y ) { return qFP16_Mod( x, y ); }
+static qFP16_t f_Add_Sat( const qFP16_t x, const qFP16_t y ) { return qFP16_Add_Sat( x, y ); }
+static qFP16_t f_Add_NoSat( const qFP16_t x, const qFP16_t y ) { return qFP16_Add_NoSat( x, y ); }
+static qFP16_t f_Sub_Sat( const qFP16_t x, const qFP16_t y ) { return qFP16_Sub_Sat( x, y ); }
+static qFP16_t f_Sub_NoSat( const qFP16_t x, const qFP16_t y ) { return qFP16_Sub_NoSat( x, y ); }
+static qFP16_t f_Mul_RoundSat( const qFP16_t x, const qFP16_t y ) { return qFP16_Mul_RoundSat( x, y ); }
+static qFP16_t f_Mul_Round( const qFP16_t x, const qFP16_t y ) { return qFP16_Mul_Round( x, y ); }
+static qFP16_t f_Mul_TruncSat( const qFP16_t x, const qFP16_t y ) { return qFP16_Mul_TruncSat( x, y ); }
+static qFP16_t f_Mul_Trunc( const qFP16_t x, const qFP16_t y ) { return qFP16_Mul_Trunc( x, y ); }
+static qFP16_t f_Div_RoundSat( const qFP16_t x, const qFP16_t y ) { return qFP16_Div_RoundSat( x, y ); }
+static qFP16_t f_Div_Round( const qFP16_t x, const qFP16_t y ) { return qFP16_Div_Round( x, y ); }
+static qFP16_t f_Div_TruncSat( const qFP16_t x, const qFP16_t y ) { return qFP16_Div_TruncSat( x, y ); }
+static qFP16_t f_Div_Trunc( const qFP16_t x, const qFP16_t y ) { return qFP16_Div_Trunc( x, y ); }
+static qFP16_t f_Atan2( const qFP16_t x, const qFP16_t y ) { return qFP16_Atan2_Ctx( &ctx, x, y ); }
+static qFP16_t f_CordicAtan2( const qFP16_t x, const qFP16_t y ) { return qFP16_CordicAtan2( x, y, NULL ); }
+static qFP16_t f_CordicMag( const qFP16_t x, const qFP16_t y ) { qFP16_t m = 0; (void)qFP16_CordicAtan2( x, y, &m ); return m; }
+static qFP16_t f_IPow( const qFP16_t x, const qFP16_t y ) { return qFP16_IPow_Ctx( &ctx, x, y ); }
+static qFP16_t f_Pow( const qFP16_t x, const qFP16_t y ) { return qFP16_Pow_Ctx( &ctx, x, y ); }
+/*============================================================================*/
+static double r_Value( const double x, const double y ) { (void)y; return x; }
+static double r_Abs( const double x, const double y ) { (void)y; return fabs( x ); }
+static double r_Floor( const double x, const double y ) { (void)y; return floor( x ); }
+static double r_Ceil( const double x, const double y ) { (void)y; return ceil( x ); }
+static double r_Round( const double x, const double y ) { (void)y; return floor( x + 0.5 ); }
+static double r_ToInt( const double x, const double y ) { (void)y; return ( x >= 0.0 ) ? floor( x + 0.5 ) : ceil( x - 0.5 ); }
+static double r_FP16Float( const double x, const double y ) { return (double)(float)( x + ( y/65536.0 ) ); }
+static double r_Sqrt( const double x, const double y ) { (void)y; return sqrt( x ); }
+static double r_Exp( const double x, const double y ) { (void)y; return exp( x ); }
+static double r_Log( const double x, const double y ) { (void)y; return log( x ); }
+static double r_Log2( const double x, const double y ) { (void)y; return log( x )/log( 2.0 ); }
+static double r_RadToDeg( const double x, const double y ) { (void)y; return x*( 180.0/PI ); }
+static double r_DegToRad( const double x, const double y ) { (void)y; return x*( PI/180.0 ); }
+static double r_Sin( const double x, const double y ) { (void)y; return sin( x ); }
+static double r_Cos( const double x, const double y ) { (void)y; return cos( x ); }
+static double r_Tan( const double x, const double y ) { (void)y; return tan( x ); }
+static double r_Atan( const double x, const double y ) { (void)y; return atan( x ); }
+static double r_Asin( const double x, const double y ) { (void)y; return asin( x ); }
+static double r_Acos( const double x, const double y ) { (void)y; return acos( x ); }
+static double r_Sinh( const double x, const double y ) { (void)y; return sinh( x ); }
+static double r_Cosh( const double x, const double y ) { (void)y; return cosh( x ); }
+static double r_Tanh( const double x, const double y ) { (void)y; return tanh( x ); }
+static double r_Polyval( const double x, const double y ) { (void)y; return ( ( ( ( 0.5*x ) - 1.25 )*x + 2.0 )*x ) + 3.0; }
+static double r_Add( const double x, const double y ) { return x + y; }
+static double r_Sub( const double x, const double y ) { return x - y; }
+static double r_Mul( const double x, const double y ) { return x*y; }
+static double r_MAC( const double x, const double y ) { return x + ( x*y ); }
+static double r_Div( const double x, const double y ) { return x/y; }
+static double r_Mod( const double x, const double y ) { return ( 0.0 == y ) ? 0.0 : fmod( x, y ); }
+static double r_Atan2( const double x, const double y ) { return atan2( x, y ); }
+static double r_Mag( const double x, const double y ) { return sqrt( ( x*x ) + ( y*y ) ); }
+static double r_IPow( const double x, const double y ) { return pow( x, trunc( y ) ); }
+static double r_Pow( const double x, const double y ) { return pow( x, y ); }
+/*============================================================================*/
+/*wrappers of the API of a qFPQ format with S raw units per unit. The float
+and double conversions take x plus a fraction y of one LSB, so they have to
+round, and the results that are not raw values are also given by a Q##_v*
+function*/
+#define BENCH_QFPQ( Q, S )                                                                      \
+static int32_t Q##_fFloatToQ( const int32_t x, const int32_t y ) { return Q##_FloatToQ( (float)( ( (double)x + ( (double)y/(S) ) )/(S) ) ); } \
+static int32_t Q##_fQToFloat( const int32_t x, const int32_t y ) { const float v = Q##_QToFloat( (Q##_t)x ); int32_t r; (void)y; (void)memcpy( &r, &v, sizeof(r) ); return r; } \
+static int32_t Q##_fDoubleToQ( const int32_t x, const int32_t y ) { return Q##_DoubleToQ( ( (double)x + ( (double)y/(S) ) )/(S) ); } \
+static int32_t Q##_fQToDouble( const int32_t x, const int32_t y ) { const double v = Q##_QToDouble( (Q##_t)x ); int32_t r; (void)y; (void)memcpy( &r, &v, sizeof(r) ); return r; } \
+static int32_t Q##_fFP16ToQ( const int32_t x, const int32_t y ) { (void)y; return Q##_FP16ToQ( x ); } \
+static int32_t Q##_fQToFP16( const int32_t x, const int32_t y ) { (void)y; return Q##_QToFP16( (Q##_t)x ); } \
+static int32_t Q##_fAbs( const int32_t x, const int32_t y ) { (void)y; return Q##_Abs( (Q##_t)x ); } \
+static int32_t Q##_fAdd( const int32_t x, const int32_t y ) { return Q##_Add( (Q##_t)x, (Q##_t)y ); } \
+static int32_t Q##_fSub( const int32_t x, const int32_t y ) { return Q##_Sub( (Q##_t)x, (Q##_t)y ); } \
+static int32_t Q##_fMul( const int32_t x, const int32_t y ) { return Q##_Mul( (Q##_t)x, (Q##_t)y ); } \
+static int32_t Q##_fDiv( const int32_t x, const int32_t y ) { return Q##_Div( (Q##_t)x, (Q##_t)y ); } \
+static int32_t Q##_fSqrt( const int32_t x, const int32_t y ) { (void)y; return Q##_Sqrt( (Q##_t)x ); } \
+static int32_t Q##_fExp( const int32_t x, const int32_t y ) { (void)y; return Q##_Exp( (Q##_t)x ); } \
+static int32_t Q##_fLog( const int32_t x, const int32_t y ) { (void)y; return Q##_Log( (Q##_t)x ); } \
+static int32_t Q##_fSin( const int32_t x, const int32_t y ) { (void)y; return Q##_Sin( (Q##_t)x ); } \
+static int32_t Q##_fCos( const int32_t x, const int32_t y ) { (void)y; return Q##_Cos( (Q##_t)x ); } \
+static int32_t Q##_fAtan2( const int32_t x, const int32_t y ) { return Q##_Atan2( (Q##_t)x, (Q##_t)y ); } \
+static double Q##_vQToFloat( const int32_t x, const int32_t y ) { (void)y; return (double)Q##_QToFloat( (Q##_t)x ); } \
+static double Q##_vQToDouble( const int32_t x, const int32_t y ) { (void)y; return Q##_QToDouble( (Q##_t)x ); } \
+static double Q##_rFloat( const double x, const double y ) { return (double)(float)( x + ( y/(S) ) ); } \
+static double Q##_rDouble( const double x, const double y ) { return x + ( y/(S) ); } \
+
+/*the cases of a qFPQ format, with F the domain of the conversions from qFP16*/
+#define BENCH_QFPQ_CASES( Q, FMT, LO, HI, F )                                                               \
+    { #Q "_FloatToQ",   Q##_fFloatToQ,  NULL,           Q##_rFloat,     FMT, FMT,       2, LO, HI, FRAC, 0.0 }, \
+    { #Q "_QToFloat",   Q##_fQToFloat,  Q##_vQToFloat,  r_Value,        FMT, FMT,       1, LO, HI, NONE, 0.0 }, \
+    { #Q "_DoubleToQ",  Q##_fDoubleToQ, NULL,           Q##_rDouble,    FMT, FMT,       2, LO, HI, FRAC, 0.0 }, \
+    { #Q "_QToDouble",  Q##_fQToDouble, Q##_vQToDouble, r_Value,        FMT, FMT,       1, LO, HI, NONE, 0.0 }, \
+    { #Q "_FP16ToQ",    Q##_fFP16ToQ,   NULL,           r_Value,        &fmtFP16, FMT,  1, -(F), (F), NONE, 0.0 }, \
+    { #Q "_QToFP16",    Q##_fQToFP16,   NULL,           r_Value,        FMT, &fmtFP16,  1, LO, HI, NONE, 0.0 }, \
+    { #Q "_Abs",        Q##_fAbs,       NULL,           r_Abs,          FMT, FMT,       1, LO, HI, NONE, 0.0 }, \
+    { #Q "_Add",        Q##_fAdd,       NULL,           r_Add,          FMT, FMT,       2, LO, HI, LO, HI, 0.0 }, \
+    { #Q "_Sub",        Q##_fSub,       NULL,           r_Sub,          FMT, FMT,       2, LO, HI, LO, HI, 0.0 }, \
+    { #Q "_Mul",        Q##_fMul,       NULL,           r_Mul,          FMT, FMT,       2, LO, HI, LO, HI, 0.0 }, \
+    { #Q "_Div",        Q##_fDiv,       NULL,           r_Div,          FMT, FMT,       2, LO, HI, LO, HI, 0.0 }, \
+    { #Q "_Sqrt",       Q##_fSqrt,      NULL,           r_Sqrt,         FMT, FMT,       1, 0.0, HI, NONE, 0.0 }, \
+    { #Q "_Exp",        Q##_fExp,       NULL,           r_Exp,          FMT, FMT,       1, LO, HI, NONE, 0.0 }, \
+    { #Q "_Log",        Q##_fLog,       NULL,           r_Log,          FMT, FMT,       1, 0.0, HI, NONE, 0.0 }, \
+    { #Q "_Sin",        Q##_fSin,       NULL,           r_Sin,          FMT, FMT,       1, LO, HI, NONE, 0.0 }, \
+    { #Q "_Cos",        Q##_fCos,       NULL,           r_Cos,          FMT, FMT,       1, LO, HI, NONE, 0.0 }, \
+    { #Q "_Atan2",      Q##_fAtan2,     NULL,           r_Atan2,        FMT, FMT,       2, LO, HI, LO, HI, 0.0 }, \
+
+BENCH_QFPQ( qQ15, 32768.0 )
+BENCH_QFPQ( qQ31, 2147483648.0 )
+BENCH_QFPQ( qQ8_24, 16777216.0 )
+/*============================================================================*/
+static const bench_case_t cases[] = {
+    { "Abs",            f_Abs,          NULL, r_Abs,        FP16, 1, FULL,            NONE, 0.0 },
+    { "Floor",          f_Floor,        NULL, r_Floor,      FP16, 1, FULL,            NONE, 0.0 },
+    { "Ceil",           f_Ceil,         NULL, r_Ceil,       FP16, 1, FULL,            NONE, 0.0 },
+    { "Round",          f_Round,        NULL, r_Round,      FP16, 1, FULL,            NONE, 0.0 },
+    { "FPToInt",        f_FPToInt,      NULL, r_ToInt,      &fmtFP16, &fmtInt, 1, FULL, NONE, 0.0 },
+    { "FloatToFP",      f_FloatToFP,    NULL, r_FP16Float,  FP16, 2, FULL,            FRAC, 0.0 },
+    { "Sqrt",           f_Sqrt,         NULL, r_Sqrt,       FP16, 1, FULL,            NONE, 0.0 },
+    { "Exp",            f_Exp,          NULL, r_Exp,        FP16, 1, FULL,            NONE, 0.0 },
+    { "Log",            f_Log,          NULL, r_Log,        FP16, 1, FULL,            NONE, 0.0 },
+    { "Log2",           f_Log2,         NULL, r_Log2,       FP16, 1, FULL,            NONE, 0.0 },
+    { "RadToDeg",       f_RadToDeg,     NULL, r_RadToDeg,   FP16, 1, FULL,            NONE, 360.0 },
+    { "DegToRad",       f_DegToRad,     NULL, r_DegToRad,   FP16, 1, FULL,            NONE, 2.0*PI },
+    { "WrapToPi",       f_WrapToPi,     NULL, r_Value,      FP16, 1, -1024.0, 1024.0, NONE, 2.0*PI },
+    { "WrapTo180",      f_WrapTo180,    NULL, r_Value,      FP16, 1, FULL,            NONE, 360.0 },
+    { "Sin",            f_Sin,          NULL, r_Sin,        FP16, 1, FULL,            NONE, 0.0 },
+    { "Cos",            f_Cos,          NULL, r_Cos,        FP16, 1, FULL,            NONE, 0.0 },
+    { "Tan",            f_Tan,          NULL, r_Tan,        FP16, 1, -64.0, 64.0,     NONE, 0.0 },
+    { "Atan",           f_Atan,         NULL, r_Atan,       FP16, 1, FULL,            NONE, 0.0 },
+    { "Asin",           f_Asin,         NULL, r_Asin,       FP16, 1, -1.0, 1.0,       NONE, 0.0 },
+    { "Acos",           f_Acos,         NULL, r_Acos,       FP16, 1, -1.0, 1.0,       NONE, 0.0 },
+    { "Sinh",           f_Sinh,         NULL, r_Sinh,       FP16, 1, FULL,            NONE, 0.0 },
+    { "Cosh",           f_Cosh,         NULL, r_Cosh,       FP16, 1, FULL,            NONE, 0.0 },
+    { "Tanh",           f_Tanh,         NULL, r_Tanh,       FP16, 1, FULL,            NONE, 0.0 },
+    { "Polyval",        f_Polyval,      NULL, r_Polyval,    FP16, 1, -64.0, 64.0,     NONE, 0.0 },
+    { "CordicSin",      f_CordicSin,    NULL, r_Sin,        FP16, 1, FULL,            NONE, 0.0 },
+    { "CordicCos",      f_CordicCos,    NULL, r_Cos,        FP16, 1, FULL,            NONE, 0.0 },
+    { "CordicSqrt",     f_CordicSqrt,   NULL, r_Sqrt,       FP16, 1, FULL,            NONE, 0.0 },
+    { "Add",            f_Add,          NULL, r_Add,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Sub",            f_Sub,          NULL, r_Sub,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Mul",            f_Mul,          NULL, r_Mul,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Div",            f_Div,          NULL, r_Div,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Mod",            f_Mod,          NULL, r_Mod,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Add_Sat",        f_Add_Sat,      NULL, r_Add,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Add_NoSat",      f_Add_NoSat,    NULL, r_Add,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Sub_Sat",        f_Sub_Sat,      NULL, r_Sub,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Sub_NoSat",      f_Sub_NoSat,    NULL, r_Sub,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Mul_RoundSat",   f_Mul_RoundSat, NULL, r_Mul,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Mul_Round",      f_Mul_Round,    NULL, r_Mul,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Mul_TruncSat",   f_Mul_TruncSat, NULL, r_Mul,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Mul_Trunc",      f_Mul_Trunc,    NULL, r_Mul,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Div_RoundSat",   f_Div_RoundSat, NULL, r_Div,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Div_Round",      f_Div_Round,    NULL, r_Div,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Div_TruncSat",   f_Div_TruncSat, NULL, r_Div,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Div_Trunc",      f_Div_Trunc,    NULL, r_Div,        FP16, 2, FULL,            FULL, 0.0 },
+    { "Atan2",          f_Atan2,        NULL, r_Atan2,      FP16, 2, FULL,            FULL, 0.0 },
+    { "CordicAtan2",    f_CordicAtan2,  NULL, r_Atan2,      FP16, 2, FULL,            FULL, 0.0 },
+    { "CordicMag",      f_CordicMag,    NULL, r_Mag,        FP16, 2, FULL,            FULL, 0.0 },
+    { "IPow",           f_IPow,         NULL, r_IPow,       FP16, 2, -16.0, 16.0,     0.0, 8.0, 0.0 },
+    { "Pow",            f_Pow,          NULL, r_Pow,        FP16, 2, 0.00002, 256.0,  -8.0, 8.0, 0.0 },
+    BENCH_QFPQ_CASES( qQ15, &fmtQ15, -1.0, ( 32767.0/32768.0 ), 2.0 )
+    BENCH_QFPQ_CASES( qQ31, &fmtQ31, -1.0, ( 2147483647.0/2147483648.0 ), 2.0 )
+    BENCH_QFPQ_CASES( qQ8_24, &fmtQ8_24, -128.0, ( 2147483647.0/16777216.0 ), 256.0 )
+};
+/*============================================================================*/
+static void a_Add( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n ) { (void)qFP16_ArrayAdd_Ctx( &ctx, z, x, y, n ); }
+static void a_Sub( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n ) { (void)qFP16_ArraySub_Ctx( &ctx, z, x, y, n ); }
+static void a_Mul( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n ) { (void)qFP16_ArrayMul_Ctx( &ctx, z, x, y, n ); }
+static void a_MAC( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n ) { (void)qFP16_ArrayMAC_Ctx( &ctx, z, x, y, n ); }
+static void a_Scale( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n ) { (void)qFP16_ArrayScale_Ctx( &ctx, z, x, y[ 0 ], n ); }
+static void a_Dot( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n ) { z[ 0 ] = qFP16_ArrayDot_Ctx( &ctx, x, y, n ); }
+/*============================================================================*/
+static void e_Add( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n )
+{
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        z[ i ] = qFP16_Add_Ctx( &ctx, x[ i ], y[ i ] );
+    }
+}
+/*============================================================================*/
+static void e_Sub( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n )
+{
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        z[ i ] = qFP16_Sub_Ctx( &ctx, x[ i ], y[ i ] );
+    }
+}
+/*============================================================================*/
+static void e_Mul( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n )
+{
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        z[ i ] = qFP16_Mul_Ctx( &ctx, x[ i ], y[ i ] );
+    }
+}
+/*============================================================================*/
+static void e_MAC( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n )
+{
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        z[ i ] = qFP16_Add_Ctx( &ctx, z[ i ], qFP16_Mul_Ctx( &ctx, x[ i ], y[ i ] ) );
+    }
+}
+/*============================================================================*/
+static void e_Scale( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n )
+{
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        z[ i ] = qFP16_Mul_Ctx( &ctx, x[ i ], y[ 0 ] );
+    }
+}
+/*============================================================================*/
+static void e_Dot( qFP16_t * const z, const qFP16_t * const x, const qFP16_t * const y, const size_t n )
+{
+    qFP16_t acc = 0;
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        acc = qFP16_Add_Ctx( &ctx, acc, qFP16_Mul_Ctx( &ctx, x[ i ], y[ i ] ) );
+    }
+    z[ 0 ] = acc;
+}
+/*============================================================================*/
+/*the accumulators of ArrayMAC start with the values of x, in a domain where
+the products do not overflow*/
+static const bench_array_t arrays[] = {
+    { "ArrayAdd",       a_Add,      e_Add,      r_Add,  0, 0, FULL,          FULL },
+    { "ArraySub",       a_Sub,      e_Sub,      r_Sub,  0, 0, FULL,          FULL },
+    { "ArrayMul",       a_Mul,      e_Mul,      r_Mul,  0, 0, FULL,          FULL },
+    { "ArrayMAC",       a_MAC,      e_MAC,      r_MAC,  0, 0, -128.0, 128.0, -128.0, 128.0 },
+    { "ArrayScale",     a_Scale,    e_Scale,    r_Mul,  0, 1, FULL,          -16.0, 16.0 },
+    { "ArrayDot",       a_Dot,      e_Dot,      r_Mul,  1, 0, -8.0, 8.0,     -8.0, 8.0 },
+};
+
+/*============================================================================*/
+static uint64_t bench_Hash( uint64_t x )
+{
+    /*splitmix64, gives independent samples for any index*/
+    x += 0x9E3779B97F4A7C15ULL;
+    x = ( x ^ ( x >> 30 ) )*0xBF58476D1CE4E5B9ULL;
+    x = ( x ^ ( x >> 27 ) )*0x94D049BB133111EBULL;
+
+    return x ^ ( x >> 31 );
+}
+/*============================================================================*/
+static int32_t bench_Sample( const uint64_t r,
+                             const double l,
+                             const double h,
+                             const double scale )
+{
+    const int32_t lo = (int32_t)ceil( l*scale );
+    const int32_t hi = (int32_t)floor( h*scale );
+    const uint32_t span = (uint32_t)( (int64_t)hi - (int64_t)lo );
+    const uint32_t bits = (uint32_t)( r & 31U );
+    uint32_t v = (uint32_t)( r >> 32 );
+
+    /*half of the samples are uniform, the other half have a uniformly
+    distributed magnitude, so small values get the same attention*/
+    if ( 0U != ( r & 32U ) ) {
+        int64_t s = (int64_t)( v >> ( 31U - bits ) );
+
+        s = ( 0U != ( r & 64U ) ) ? -s : s;
+        if ( ( s < (int64_t)lo ) || ( s > (int64_t)hi ) ) {
+            s = (int64_t)lo + (int64_t)( (uint64_t)( s < 0 ? -s : s ) % ( (uint64_t)span + 1U ) );
+        }
+        v = (uint32_t)(int32_t)s;
+    }
+    else {
+        v = (uint32_t)lo + (uint32_t)( (uint64_t)v % ( (uint64_t)span + 1U ) );
+    }
+
+    return (int32_t)v;
+}
+/*============================================================================*/
+static void bench_Eval( const bench_case_t * const c,
+                        const int32_t x,
+                        const int32_t y,
+                        bench_stat_t * const st )
+{
+    const bench_fmt_t * const o = c->out;
+    const int32_t raw = c->fcn( x, y );
+    const double got = ( NULL != c->val ) ? c->val( x, y )*o->scale : (double)raw;
+    const int marker = ( 0 != o->marked ) && ( NULL == c->val ) && ( qFP16.overflow == raw );
+    const double p = c->period*o->scale;
+    double ref = c->ref( (double)x/c->in->scale, (double)y/c->in->scale )*o->scale;
+
+    if ( p > 0.0 ) {
+        ref = remainder( ref, p );
+    }
+
+    if ( isnan( ref ) || ( ref >= ( o->hi + 0.5 ) ) || ( ref <= ( o->lo - 0.5 ) ) ) {
+        const int flagged = marker ||
+                            ( ( o->hi == got ) && !( ref < 0.0 ) ) ||
+                            ( ( o->lo == got ) && !( ref > 0.0 ) );
+        st->out++;
+        if ( !flagged ) {
+            st->outBad++;
+        }
+    }
+    else if ( marker ) {
+        st->spurious++;
+    }
+    else {
+        const double e = ( p > 0.0 ) ? fabs( remainder( got - ref, p ) )
+                                     : fabs( got - ref );
+
+        st->n++;
+        st->sumErr += e;
+        if ( e > st->maxErr ) {
+            st->maxErr = e;
+            st->xMax = x;
+            st->yMax = y;
+        }
+    }
+}
+/*============================================================================*/
+static void bench_Merge( bench_stat_t * const dst,
+                         const bench_stat_t * const src )
+{
+    dst->n += src->n;
+    dst->out += src->out;
+    dst->outBad += src->outBad;
+    dst->spurious += src->spurious;
+    dst->mismatch += src->mismatch;
+    dst->sumErr += src->sumErr;
+    if ( src->maxErr > dst->maxErr ) {
+        dst->maxErr = src->maxErr;
+        dst->xMax = src->xMax;
+        dst->yMax = src->yMax;
+    }
+}
+/*============================================================================*/
+static void bench_Accuracy( const bench_case_t * const c,
+                            const unsigned shift,
+                            const unsigned pairs,
+                            bench_stat_t * const total )
+{
+    const double s = c->in->scale;
+    const int64_t lo = (int64_t)ceil( c->xl*s );
+    const int64_t hi = (int64_t)floor( c->xh*s );
+    const uint64_t step = (uint64_t)1U << shift;
+    const uint64_t n = ( 1 == c->args ) ? ( ( (uint64_t)( hi - lo )/step ) + 1U )
+                                        : ( (uint64_t)1U << pairs );
+    const int64_t chunks = (int64_t)( ( n + BENCH_CHUNK - 1U )/BENCH_CHUNK );
+    int64_t k;
+
+    memset( total, 0, sizeof(*total) );
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic)
+#endif
+    for ( k = 0 ; k < chunks ; ++k ) {
+        bench_stat_t st;
+        uint64_t i, end = ( (uint64_t)k + 1U )*BENCH_CHUNK;
+
+        memset( &st, 0, sizeof(st) );
+        end = ( end > n ) ? n : end;
+        for ( i = (uint64_t)k*BENCH_CHUNK ; i < end ; ++i ) {
+            if ( 1 == c->args ) {
+                bench_Eval( c, (int32_t)( lo + (int64_t)( i*step ) ), 0, &st );
+            }
+            else {
+                const uint64_t r = bench_Hash( i );
+
+                bench_Eval( c, bench_Sample( r, c->xl, c->xh, s ),
+                               bench_Sample( bench_Hash( ~r ), c->yl, c->yh, s ), &st );
+            }
+        }
+#ifdef _OPENMP
+        #pragma omp critical
+#endif
+        bench_Merge( total, &st );
+    }
+}
+/*============================================================================*/
+static double bench_Speed( const bench_case_t * const c )
+{
+    static int32_t xs[ BENCH_TIME_SAMPLES ], ys[ BENCH_TIME_SAMPLES ];
+    volatile int32_t sink = 0;
+    unsigned long reps = 0UL;
+    clock_t t0, t;
+    unsigned i;
+
+    for ( i = 0U ; i < BENCH_TIME_SAMPLES ; ++i ) {
+        const uint64_t r = bench_Hash( i );
+
+        xs[ i ] = bench_Sample( r, c->xl, c->xh, c->in->scale );
+        ys[ i ] = bench_Sample( bench_Hash( ~r ), c->yl, c->yh, c->in->scale );
+    }
+    t0 = clock();
+    do {
+        int32_t acc = 0;
+
+        for ( i = 0U ; i < BENCH_TIME_SAMPLES ; ++i ) {
+            acc ^= c->fcn( xs[ i ], ys[ i ] );
+        }
+        sink ^= acc;
+        ++reps;
+        t = clock();
+    } while ( ( t - t0 ) < ( CLOCKS_PER_SEC/20 ) );
+    (void)sink;
+
+    return ( 1.0e9*(double)( t - t0 )/(double)CLOCKS_PER_SEC )/
+           ( (double)reps*(double)BENCH_TIME_SAMPLES );
+}
+/*============================================================================*/
+static void bench_Fill( const bench_array_t * const c,
+                        const uint64_t first,
+                        qFP16_t * const x,
+                        qFP16_t * const y,
+                        const size_t n )
+{
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        const uint64_t r = bench_Hash( first + i );
+
+        x[ i ] = bench_Sample( r, c->xl, c->xh, 65536.0 );
+        y[ i ] = ( ( 0 != c->broadcast ) && ( i > 0U ) ) ? y[ 0 ]
+               : bench_Sample( bench_Hash( ~r ), c->yl, c->yh, 65536.0 );
+    }
+}
+/*============================================================================*/
+static void bench_ArrayAccuracy( const bench_array_t * const c,
+                                 const unsigned pairs,
+                                 bench_stat_t * const total )
+{
+    const uint64_t n = (uint64_t)1U << pairs;
+    const int64_t blocks = (int64_t)( ( n + BENCH_BLOCK - 1U )/BENCH_BLOCK );
+    int64_t k;
+
+    memset( total, 0, sizeof(*total) );
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for ( k = 0 ; k < blocks ; ++k ) {
+        qFP16_t x[ BENCH_BLOCK ], y[ BENCH_BLOCK ], z[ BENCH_BLOCK ], w[ BENCH_BLOCK ];
+        const size_t m = ( 0 != c->reduce ) ? 1U : BENCH_BLOCK;
+        bench_stat_t st;
+        double ref = 0.0;
+        size_t i;
+
+        memset( &st, 0, sizeof(st) );
+        bench_Fill( c, (uint64_t)k*BENCH_BLOCK, x, y, BENCH_BLOCK );
+        (void)memcpy( z, x, sizeof(z) );
+        (void)memcpy( w, x, sizeof(w) );
+        c->fcn( z, x, y, BENCH_BLOCK );
+        c->elem( w, x, y, BENCH_BLOCK );
+        for ( i = 0U ; i < BENCH_BLOCK ; ++i ) {
+            ref += c->ref( qFP16_FPToDouble( x[ i ] ), qFP16_FPToDouble( y[ i ] ) );
+        }
+        for ( i = 0U ; i < m ; ++i ) {
+            const double r = ( ( 0 != c->reduce ) ? ref
+                             : c->ref( qFP16_FPToDouble( x[ i ] ), qFP16_FPToDouble( y[ i ] ) ) )*65536.0;
+
+            if ( z[ i ] != w[ i ] ) {
+                st.mismatch++;
+            }
+            if ( ( r >= 2147483647.5 ) || ( r <= -2147483647.5 ) ) {
+                st.out++;
+            }
+            else if ( qFP16.overflow == z[ i ] ) {
+                st.spurious++;
+            }
+            else {
+                const double e = fabs( (double)z[ i ] - r );
+
+                st.n++;
+                st.sumErr += e;
+                if ( e > st.maxErr ) {
+                    st.maxErr = e;
+                    st.xMax = x[ i ];
+                    st.yMax = y[ i ];
+                }
+            }
+        }
+#ifdef _OPENMP
+        #pragma omp critical
+#endif
+        bench_Merge( total, &st );
+    }
+}
+/*============================================================================*/
+static double bench_ArraySpeed( const bench_array_t * const c,
+                                const bench_arr_t f )
+{
+    static qFP16_t xs[ BENCH_TIME_SAMPLES ], ys[ BENCH_TIME_SAMPLES ], zs[ BENCH_TIME_SAMPLES ];
+    volatile qFP16_t sink = 0;
+    unsigned long reps = 0UL;
+    clock_t t0, t;
+    unsigned i;
+
+    for ( i = 0U ; i < BENCH_TIME_SAMPLES ; i += BENCH_BLOCK ) {
+        bench_Fill( c, i, &xs[ i ], &ys[ i ], BENCH_BLOCK );
+    }
+    t0 = clock();
+    do {
+        /*the accumulators are restarted to keep ArrayMAC in range*/
+        (void)memcpy( zs, xs, sizeof(zs) );
+        for ( i = 0U ; i < BENCH_TIME_SAMPLES ; i += BENCH_BLOCK ) {
+            f( &zs[ i ], &xs[ i ], &ys[ i ], BENCH_BLOCK );
+        }
+        sink ^= zs[ reps % BENCH_TIME_SAMPLES ];
+        ++reps;
+        t = clock();
+    } while ( ( t - t0 ) < ( CLOCKS_PER_SEC/20 ) );
+    (void)sink;
+
+    return ( 1.0e9*(double)( t - t0 )/(double)CLOCKS_PER_SEC )/
+           ( (double)reps*(double)BENCH_TIME_SAMPLES );
+}
+/*============================================================================*/
+static size_t bench_Write( const qFP16_t * const x,
+                           const uint64_t first,
+                           const size_t n,
+                           char * const text,
+                           const size_t size )
+{
+    size_t i, len = 0U;
+
+    /*from 0 to 9 decimals, so the parser also has to round*/
+    for ( i = 0U ; i < n ; ++i ) {
+        const int d = (int)( bench_Hash( ~( first + i ) ) % 10U );
+
+        len += (size_t)snprintf( &text[ len ], size - len, "%s%.*f",
+                                 ( i > 0U ) ? "," : "", d, qFP16_FPToDouble( x[ i ] ) );
+    }
+
+    return len;
+}
+/*============================================================================*/
+static void bench_TextAccuracy( const bench_array_t * const c,
+                                const unsigned pairs,
+                                const int decimals,
+                                bench_stat_t * const toText,
+                                bench_stat_t * const fromText )
+{
+    const uint64_t n = (uint64_t)1U << pairs;
+    const int64_t blocks = (int64_t)( ( n + BENCH_BLOCK - 1U )/BENCH_BLOCK );
+    int64_t k;
+
+    memset( toText, 0, sizeof(*toText) );
+    memset( fromText, 0, sizeof(*fromText) );
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for ( k = 0 ; k < blocks ; ++k ) {
+        char text[ BENCH_BLOCK*BENCH_FIELD ];
+        qFP16_t x[ BENCH_BLOCK ], y[ BENCH_BLOCK ], z[ BENCH_BLOCK ];
+        bench_stat_t st[ 2 ];
+        const char *p;
+        size_t i;
+
+        memset( st, 0, sizeof(st) );
+        bench_Fill( c, (uint64_t)k*BENCH_BLOCK, x, y, BENCH_BLOCK );
+        /*qFP16_ArrayToA() against qFP16_FPToA() and the value written*/
+        (void)qFP16_ArrayToA_Ctx( &ctx, x, BENCH_BLOCK, text, sizeof(text), decimals, ',' );
+        p = text;
+        for ( i = 0U ; i < BENCH_BLOCK ; ++i ) {
+            char one[ BENCH_FIELD ];
+            const size_t len = strlen( qFP16_FPToA_Ctx( &ctx, x[ i ], one, decimals ) );
+            const double e = fabs( ( strtod( p, NULL )*65536.0 ) - (double)x[ i ] );
+
+            if ( ( 0 != strncmp( p, one, len ) ) || ( ( ',' != p[ len ] ) && ( '\0' != p[ len ] ) ) ) {
+                st[ 0 ].mismatch++;
+            }
+            st[ 0 ].n++;
+            st[ 0 ].sumErr += e;
+            if ( e > st[ 0 ].maxErr ) {
+                st[ 0 ].maxErr = e;
+                st[ 0 ].xMax = x[ i ];
+            }
+            p = strchr( p, ',' );
+            p = ( NULL != p ) ? &p[ 1 ] : "";
+        }
+        /*qFP16_AToArray() against qFP16_AToFP() and the value of the text*/
+        (void)bench_Write( x, (uint64_t)k*BENCH_BLOCK, BENCH_BLOCK, text, sizeof(text) );
+        (void)qFP16_AToArray_Ctx( &ctx, text, z, BENCH_BLOCK, ',', NULL );
+        p = text;
+        for ( i = 0U ; i < BENCH_BLOCK ; ++i ) {
+            const double r = strtod( p, NULL )*65536.0;
+
+            if ( qFP16_AToFP_Ctx( &ctx, p ) != z[ i ] ) {
+                st[ 1 ].mismatch++;
+            }
+            /*printf() may round the text up to 32768*/
+            if ( ( r >= 2147483647.5 ) || ( r <= -2147483647.5 ) ) {
+                st[ 1 ].out++;
+                if ( qFP16.overflow != z[ i ] ) {
+                    st[ 1 ].outBad++;
+                }
+            }
+            else if ( qFP16.overflow == z[ i ] ) {
+                st[ 1 ].spurious++;
+            }
+            else {
+                const double e = fabs( (double)z[ i ] - r );
+
+                st[ 1 ].n++;
+                st[ 1 ].sumErr += e;
+                if ( e > st[ 1 ].maxErr ) {
+                    st[ 1 ].maxErr = e;
+                    st[ 1 ].xMax = x[ i ];
+                }
+            }
+            p = strchr( p, ',' );
+            p = ( NULL != p ) ? &p[ 1 ] : "";
+        }
+#ifdef _OPENMP
+        #pragma omp critical
+#endif
+        {
+            bench_Merge( toText, &st[ 0 ] );
+            bench_Merge( fromText, &st[ 1 ] );
+        }
+    }
+}
+/*============================================================================*/
+/*data of the timed text conversions*/
+static qFP16_t tx[ BENCH_TIME_SAMPLES ];
+static char tText[ BENCH_TIME_SAMPLES*BENCH_FIELD ];
+static const char *tField[ BENCH_TIME_SAMPLES ];
+static int tDecimals;
+static volatile qFP16_t tSink;
+
+static void t_ArrayToA( void ) { tSink ^= (qFP16_t)qFP16_ArrayToA_Ctx( &ctx, tx, BENCH_TIME_SAMPLES, tText, sizeof(tText), tDecimals, ',' ); }
+static void t_AToArray( void ) { qFP16_t z[ BENCH_TIME_SAMPLES ]; tSink ^= (qFP16_t)qFP16_AToArray_Ctx( &ctx, tText, z, BENCH_TIME_SAMPLES, ',', NULL ); }
+/*============================================================================*/
+static void t_FPToA( void )
+{
+    char one[ BENCH_FIELD ];
+    unsigned i;
+
+    for ( i = 0U ; i < BENCH_TIME_SAMPLES ; ++i ) {
+        tSink ^= (qFP16_t)qFP16_FPToA_Ctx( &ctx, tx[ i ], one, tDecimals )[ 0 ];
+    }
+}
+/*============================================================================*/
+static void t_AToFP( void )
+{
+    unsigned i;
+
+    for ( i = 0U ; i < BENCH_TIME_SAMPLES ; ++i ) {
+        tSink ^= qFP16_AToFP_Ctx( &ctx, tField[ i ] );
+    }
+}
+/*============================================================================*/
+static double bench_TextSpeed( void (*f)( void ) )
+{
+    unsigned long reps = 0UL;
+    clock_t t0, t;
+
+    t0 = clock();
+    do {
+        f();
+        ++reps;
+        t = clock();
+    } while ( ( t - t0 ) < ( CLOCKS_PER_SEC/20 ) );
+
+    return ( 1.0e9*(double)( t - t0 )/(double)CLOCKS_PER_SEC )/
+           ( (double)reps*(double)BENCH_TIME_SAMPLES );
+}
+/*============================================================================*/
+static void bench_Print( const char * const name,
+                         const bench_stat_t * const st,
+                         const double ns )
+{
+    (void)printf( "%-16s %12llu %10.3f %10.4f %12llu %8llu %8llu %8.1f",
+                  name, (unsigned long long)( st->n + st->out + st->spurious ),
+                  st->maxErr, ( st->n > 0U ) ? ( st->sumErr/(double)st->n ) : 0.0,
+                  (unsigned long long)st->out, (unsigned long long)st->outBad,
+                  (unsigned long long)st->spurious, ns );
+}
+/*============================================================================*/
+int main( int argc, char *argv[] )
+{
+    /*domain of the text conversions*/
+    static const bench_array_t text = { "text", NULL, NULL, NULL, 0, 0, FULL, NONE };
+    unsigned shift = 0U, pairs = 26U;
+    const char *filter = NULL;
+    bench_stat_t st, st2;
+    size_t i;
+    int a;
+
+    for ( a = 1 ; a < argc ; ++a ) {
+        if ( ( 0 == strcmp( argv[ a ], "-s" ) ) && ( ( a + 1 ) < argc ) ) {
+            shift = (unsigned)strtoul( argv[ ++a ], NULL, 10 );
+        }
+        else if ( ( 0 == strcmp( argv[ a ], "-p" ) ) && ( ( a + 1 ) < argc ) ) {
+            pairs = (unsigned)strtoul( argv[ ++a ], NULL, 10 );
+        }
+        else if ( ( 0 == strcmp( argv[ a ], "-f" ) ) && ( ( a + 1 ) < argc ) ) {
+            filter = argv[ ++a ];
+        }
+        else {
+            (void)fprintf( stderr, "usage: %s [-s shift] [-p log2pairs] [-f filter]\n", argv[ 0 ] );
+            return EXIT_FAILURE;
+        }
+    }
+    shift = ( shift > 31U ) ? 31U : shift;
+    pairs = ( pairs > 40U ) ? 40U : pairs;
+    (void)qFP16_SettingsSet( &ctx, -qFP16.max, qFP16.max, 1U, 0U );
+
+#ifdef _OPENMP
+    (void)printf( "threads : %d\n", omp_get_max_threads() );
+#endif
+    (void)printf( "%-16s %12s %10s %10s %12s %8s %8s %8s  %s\n",
+                  "function", "samples", "max[LSB]", "mean[LSB]",
+                  "out-range", "bad", "spurious", "ns/op", "worst case" );
+    for ( i = 0U ; i < ( sizeof(cases)/sizeof(cases[ 0 ]) ) ; ++i ) {
+        const bench_case_t * const c = &cases[ i ];
+
+        if ( ( NULL != filter ) && ( NULL == strstr( c->name, filter ) ) ) {
+            continue;
+        }
+        bench_Accuracy( c, shift, pairs, &st );
+        bench_Print( c->name, &st, bench_Speed( c ) );
+        if ( 1 == c->args ) {
+            (void)printf( "  x=%.6f\n", (double)st.xMax/c->in->scale );
+        }
+        else {
+            (void)printf( "  x=%.6f y=%.6f\n", (double)st.xMax/c->in->scale,
+                          (double)st.yMax/c->in->scale );
+        }
+        (void)fflush( stdout );
+    }
+
+    /*the array and text functions against the scalar ones they replace*/
+    (void)printf( "\n%-16s %12s %10s %10s %12s %8s %8s %8s %8s %8s  %s\n",
+                  "function", "elements", "max[LSB]", "mean[LSB]",
+                  "out-range", "bad", "spurious", "ns/elem", "mismatch",
+                  "1-by-1", "worst case" );
+    for ( i = 0U ; i < ( sizeof(arrays)/sizeof(arrays[ 0 ]) ) ; ++i ) {
+        const bench_array_t * const c = &arrays[ i ];
+
+        if ( ( NULL != filter ) && ( NULL == strstr( c->name, filter ) ) ) {
+            continue;
+        }
+        bench_ArrayAccuracy( c, pairs, &st );
+        bench_Print( c->name, &st, bench_ArraySpeed( c, c->fcn ) );
+        (void)printf( " %8llu %8.1f  x=%.6f y=%.6f\n", (unsigned long long)st.mismatch,
+                      bench_ArraySpeed( c, c->elem ), qFP16_FPToDouble( st.xMax ),
+                      qFP16_FPToDouble( st.yMax ) );
+        (void)fflush( stdout );
+    }
+    if ( ( NULL == filter ) || ( NULL != strstr( "ArrayToA AToArray", filter ) ) ) {
+        size_t len = 0U;
+        qFP16_t y[ BENCH_TIME_SAMPLES ];
+
+        tDecimals = 5;
+        bench_TextAccuracy( &text, pairs, tDecimals, &st, &st2 );
+        bench_Fill( &text, 0U, tx, y, BENCH_TIME_SAMPLES );
+        bench_Print( "ArrayToA", &st, bench_TextSpeed( &t_ArrayToA ) );
+        (void)printf( " %8llu %8.1f  x=%.6f\n", (unsigned long long)st.mismatch,
+                      bench_TextSpeed( &t_FPToA ), qFP16_FPToDouble( st.xMax ) );
+        (void)bench_Write( tx, 0U, BENCH_TIME_SAMPLES, tText, sizeof(tText) );
+        for ( i = 0U ; i < BENCH_TIME_SAMPLES ; ++i ) {
+            tField[ i ] = &tText[ len ];
+            while ( ( ',' != tText[ len ] ) && ( '\0' != tText[ len ] ) ) {
+                ++len;
+            }
+            ++len;
+        }
+        bench_Print( "AToArray", &st2, bench_TextSpeed( &t_AToArray ) );
+        (void)printf( " %8llu %8.1f  x=%.6f\n", (unsigned long long)st2.mismatch,
+                      bench_TextSpeed( &t_AToFP ), qFP16_FPToDouble( st2.xMax ) );
+        (void)fflush( stdout );
+    }
+
+    return EXIT_SUCCESS;
+}
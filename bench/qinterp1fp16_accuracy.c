@@ -0,0 +1,131 @@
+/*!
+ * @file qinterp1fp16_accuracy.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ * @brief Agreement of qInterp1FP16 with the floating-point qInterp1. Every
+ * method is evaluated over three tables : the sensor table of the
+ * documentation read from 16-bit integers with a 0.1 scale, a smooth curve
+ * over equally spaced points and a curve over non-uniformly spaced points.
+ * The maximum absolute difference is reported separately inside the table
+ * range and when extrapolating up to a quarter of the range beyond each end.
+ *
+ * Usage : qinterp1fp16_accuracy
+ **/
+
+#include "qinterp1.h"
+#include "qinterp1fp16.h"
+#include <math.h>
+#include <stdio.h>
+
+#define SAMPLES     ( 4000 )
+#define BEYOND      ( 0.25 )
+#define MAX_POINTS  ( 11 )
+
+typedef struct
+{
+    const char *name;
+    size_t n;
+    float x[ MAX_POINTS ], y[ MAX_POINTS ];
+} acc_Table_t;
+
+static const int16_t adc[] = { 0, 410, 1230, 2050, 2870, 3690, 4095 };
+static const int16_t tmp[] = { -400, -212, 95, 318, 560, 841, 1050 };
+
+/*============================================================================*/
+static void acc_Eval( const acc_Table_t * const t,
+                      qInterp1_t * const f,
+                      qInterp1FP16_t * const q,
+                      double * const inRange,
+                      double * const outRange )
+{
+    const double lo = (double)t->x[ 0 ];
+    const double hi = (double)t->x[ t->n - 1U ];
+    const double span = hi - lo;
+    int k;
+
+    *inRange = 0.0;
+    *outRange = 0.0;
+    for ( k = -(int)( BEYOND*SAMPLES ) ; k <= (int)( ( 1.0 + BEYOND )*SAMPLES ) ; ++k ) {
+        const double xd = lo + ( span*(double)k/(double)SAMPLES );
+        const qFP16_t xq = qFP16_DoubleToFP( xd );
+        /*both evaluated at the same point, the one that qFP16 can hold*/
+        const double yf = (double)qInterp1_Get( f, (float)qFP16_FPToDouble( xq ) );
+        const double yq = qFP16_FPToDouble( qInterp1FP16_Get( q, xq ) );
+        const double e = fabs( yq - yf );
+
+        if ( ( k >= 0 ) && ( k <= SAMPLES ) ) {
+            *inRange = ( e > *inRange ) ? e : *inRange;
+        }
+        else {
+            *outRange = ( e > *outRange ) ? e : *outRange;
+        }
+    }
+}
+/*============================================================================*/
+int main( void )
+{
+    static const char * const names[ QINTERP1_MAX ] = {
+        "next", "previous", "nearest", "linear", "sine",
+        "cubic", "hermite", "spline", "constrained_spline"
+    };
+    static acc_Table_t tables[ 3 ] = {
+        { "sensor", 7U, { 0.0f }, { 0.0f } },
+        { "smooth", 11U, { 0.0f }, { 0.0f } },
+        { "non-uniform", 7U, { 0.0f, 0.5f, 1.5f, 3.0f, 5.0f, 8.0f, 12.0f },
+                             { 1.0f, 1.8f, 2.2f, 1.4f, -0.6f, -2.5f, 0.5f } },
+    };
+    qFP16_t xq[ MAX_POINTS ], yq[ MAX_POINTS ];
+    size_t j;
+    int m;
+
+    /*with the scale that qFP16 holds for 0.1, so only the interpolation differs*/
+    for ( j = 0U ; j < 7U ; ++j ) {
+        tables[ 0 ].x[ j ] = (float)adc[ j ];
+        tables[ 0 ].y[ j ] = (float)( qFP16_FPToDouble( qFP16_Constant( 0.1 ) )*(double)tmp[ j ] );
+    }
+    for ( j = 0U ; j < 11U ; ++j ) {
+        tables[ 1 ].x[ j ] = (float)j;
+        tables[ 1 ].y[ j ] = (float)( ( 5.0*sin( 0.5*(double)j ) ) + ( 0.5*(double)j ) );
+    }
+    /*the float tables hold the values that qFP16 can hold*/
+    for ( j = 1U ; j < 3U ; ++j ) {
+        size_t k;
+
+        for ( k = 0U ; k < tables[ j ].n ; ++k ) {
+            tables[ j ].y[ k ] = (float)qFP16_FPToDouble( qFP16_FloatToFP( tables[ j ].y[ k ] ) );
+        }
+    }
+
+    (void)printf( "| Method             | Table       | In range   | Extrapolated |\n" );
+    (void)printf( "|--------------------|-------------|------------|--------------|\n" );
+    for ( m = 0 ; m < (int)QINTERP1_MAX ; ++m ) {
+        for ( j = 0U ; j < 3U ; ++j ) {
+            const acc_Table_t * const t = &tables[ j ];
+            qInterp1_t f;
+            qInterp1FP16_t q;
+            double inRange, outRange;
+            size_t k;
+
+            (void)qInterp1_Setup( &f, t->x, t->y, t->n );
+            (void)qInterp1_SetMethod( &f, (qInterp1Method_t)m );
+            if ( 0U == j ) {
+                /*the integer table of the documentation, y in tenths*/
+                (void)qInterp1FP16_SetupInt16( &q, adc, tmp, t->n );
+                (void)qInterp1FP16_SetScale( &q, qFP16.one, 0, qFP16_Constant( 0.1 ), 0 );
+            }
+            else {
+                for ( k = 0U ; k < t->n ; ++k ) {
+                    xq[ k ] = qFP16_FloatToFP( t->x[ k ] );
+                    yq[ k ] = qFP16_FloatToFP( t->y[ k ] );
+                }
+                (void)qInterp1FP16_Setup( &q, xq, yq, t->n );
+            }
+            (void)qInterp1FP16_SetMethod( &q, (qInterp1Method_t)m );
+            acc_Eval( t, &f, &q, &inRange, &outRange );
+            (void)printf( "| %-18s | %-11s | %-10.2g | %-12.2g |\n",
+                          names[ m ], t->name, inRange, outRange );
+        }
+    }
+
+    return 0;
+}
@@ -132,6 +132,8 @@ extern "C" {
     {
         /*! @cond  */
         qFIS_IO_Base_t b;
+        float prev, tol;
+        uint8_t dirty;
         /*! @endcond  */
     } qFIS_Input_t;
 
@@ -225,6 +227,50 @@ extern "C" {
     typedef float (*qFIS_DeFuzz_Fcn_t)( qFIS_Output_t * const o, const qFIS_DeFuzzState_t stage );
     /*! @endcond  */
 
+#ifdef QFIS_PROFILING
+    /**
+    * @brief Pointer to a function that returns a free-running timestamp used
+    * to profile the FIS stages, e.g. a CPU cycle counter or a nanosecond clock.
+    * @note Only available when the library is built with @c QFIS_PROFILING
+    */
+    typedef uint32_t (*qFIS_ProfileClock_t)( void );
+
+    /**
+    * @brief An enum with the FIS evaluation stages measured by the profiler.
+    * @note Only available when the library is built with @c QFIS_PROFILING
+    */
+    typedef enum {
+        qFIS_StageFuzzify = 0,  /*!< qFIS_Fuzzify()*/
+        qFIS_StageInference,    /*!< qFIS_Inference()*/
+        qFIS_StageDeFuzzify,    /*!< qFIS_DeFuzzify()*/
+        /*! @cond  */
+        _NUM_QFIS_STAGES        /*!< Number of profiled stages*/ //skipcq: CXX-E2000
+        /*! @endcond  */
+    } qFIS_Stage_t;
+
+    /**
+    * @brief A FIS profiler object.
+    * @details The instance should be attached to a FIS using the
+    * qFIS_SetProfile() API. The public counters can be read directly and
+    * are indexed by ::qFIS_Stage_t. Timestamp units are the ones returned by
+    * the qFIS_ProfileClock_t function.
+    * @note Only available when the library is built with @c QFIS_PROFILING
+    */
+    typedef struct
+    {
+        uint64_t ticks[ _NUM_QFIS_STAGES ];     /*!< Accumulated time spent on each stage, 64 bits wide so it does not wrap in long runs*/
+        uint32_t maxTicks[ _NUM_QFIS_STAGES ];  /*!< Worst-case time spent on each stage*/
+        uint32_t calls[ _NUM_QFIS_STAGES ];     /*!< Number of calls to each stage*/
+        uint32_t inferences;                    /*!< Number of inferences that evaluated the rules. Inferences skipped because no input changed are not accounted*/
+        /*! @cond  */
+        qFIS_ProfileClock_t clock;
+        uint32_t *fired;
+        float *strength;
+        size_t nRules;
+        /*! @endcond  */
+    } qFIS_Profile_t;
+#endif
+
     /**
     * @brief A FIS(Fuzzy Inference System) object
     * @details The instance should be initialized using the qFIS_Setup() API.
@@ -243,8 +289,19 @@ extern "C" {
         size_t (*inferenceState)( struct _qFIS_s * const f, size_t i );
         size_t (*aggregationState)( struct _qFIS_s * const f, size_t i );
         qFIS_DeFuzz_Fcn_t deFuzz;
+        float *gCoeff;
+        size_t *gIndex;
+        size_t gCount[ 4 ];
+        size_t *rStart, *mfStart, *mfRef, *rActive;
+        size_t nActive, nKept;
+        size_t nCoarse;
+        float dTol;
+        uint8_t pending;
         float *ruleWeight;
         float *wi;
+        qFIS_MF_t *lowMF;
+        float *wl;
+        size_t *t2Map;
         const qFIS_Rules_t *rules;
         size_t rule_cols;
         size_t nInputs, nOutputs;
@@ -254,6 +311,9 @@ extern "C" {
         float rStrength;
         qFIS_Rules_t lastConnector;
         qFIS_Type_t type;
+    #ifdef QFIS_PROFILING
+        qFIS_Profile_t *profile;
+    #endif
         /*! @endcond  */
     } qFIS_t;
 
@@ -432,6 +492,28 @@ extern "C" {
                        const qFIS_Tag_t t,
                        const float value );
 
+    /**
+    * @brief Set the change tolerance of the input with the specified tag to
+    * enable the incremental evaluation of the FIS.
+    * @details A tracked input is only considered as changed when its value
+    * differs from the last evaluated value by more than @a tol. On every
+    * evaluation, qFIS_Fuzzify() only re-evaluates the membership functions of
+    * the changed inputs and, if the rule index is enabled with
+    * qFIS_SetRuleIndex(), qFIS_Inference() only recomputes the rules that
+    * depend on them. When none of the inputs has changed, the inference and the
+    * de-fuzzification are skipped and the previous outputs are kept.
+    * @note The incremental evaluation only applies when all the inputs are
+    * tracked. By default, inputs are not tracked.
+    * @param[in] v An array with the FIS inputs as a qFIS_Input_t array.
+    * @param[in] t The input tag
+    * @param[in] tol The change tolerance. A negative value disables the change
+    * tracking for this input, so it will be evaluated on every call.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_SetInputTolerance( qFIS_Input_t * const v,
+                                const qFIS_Tag_t t,
+                                const float tol );
+
     /**
     * @brief Get the de-fuzzified crisp value from the the output  with the
     * specified tag.
@@ -442,6 +524,22 @@ extern "C" {
     float qFIS_GetOutput( const qFIS_Output_t * const v,
                           const qFIS_Tag_t t );
 
+    /**
+    * @brief Get the type-reduced interval of the output with the specified
+    * tag. The crisp value retrieved by qFIS_GetOutput() is the center of
+    * this interval.
+    * @pre The type-2 evaluation should be enabled with qFIS_SetType2().
+    * @param[in] v An array with the FIS outputs as a qFIS_Output_t array.
+    * @param[in] t The output tag
+    * @param[out] yl The left end-point of the interval.
+    * @param[out] yr The right end-point of the interval.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_GetOutputInterval( const qFIS_Output_t * const v,
+                                const qFIS_Tag_t t,
+                                float * const yl,
+                                float * const yr );
+
     /**
     * @brief Set the IO tag and points for the specified membership function
     * @param[in] m An array with the required membership functions as qFIS_MF_t
@@ -541,6 +639,289 @@ extern "C" {
     int qFIS_SetRuleWeights( qFIS_t * const f,
                              float *rWeights );
 
+    /**
+    * @brief Number of elements stored per input membership function by
+    * qFIS_SetMFGroups(): five pre-processed coefficients, the input value and
+    * the membership degree.
+    */
+    #define QFIS_MFGROUP_NCOEF      ( 7U )
+
+    /**
+    * @brief Regroup the input membership functions by shape so that the
+    * fuzzification stage can evaluate the ::trimf, ::trapmf and ::gaussmf
+    * functions with specialized kernels instead of calling them through the
+    * shape function pointer. The remaining shapes, and the ::trimf and
+    * ::trapmf functions with a vertical side, keep using the generic
+    * evaluation.
+    * @details Membership functions are partitioned by shape and their
+    * parameters are pre-processed and stored as structure-of-arrays blocks in
+    * @a k, one contiguous array per coefficient. On every evaluation, the
+    * input values are first gathered into a contiguous block of @a k, every
+    * kernel then runs as a branch-free loop over contiguous memory that writes
+    * the degrees into another block, and these are finally copied back to
+    * the membership functions.
+    * @pre I/Os and fuzzy sets must be previously initialized by qFIS_InputSetup(),
+    * qFIS_OutputSetup(), qFIS_SetMF() and qFIS_Setup() respectively.
+    * @note This function should be called again every time the parameters of
+    * an input membership function are modified.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[in] k An array of at least #QFIS_MFGROUP_NCOEF times @a n elements
+    * where the pre-processed coefficients will be stored. Pass @c NULL to
+    * disable the grouped evaluation.
+    * @param[in] idx An array of @a n elements where the membership functions
+    * indexes will be stored.
+    * @param[in] n The number of input membership functions that @a k and @a idx
+    * can hold. Should be greater or equal to the number of input membership
+    * functions of the FIS instance.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_SetMFGroups( qFIS_t * const f,
+                          float *k,
+                          size_t *idx,
+                          const size_t n );
+
+    /**
+    * @brief Returns the number of elements required by the workspace of
+    * qFIS_SetRuleIndex().
+    * @param[in] nr The number of rules.
+    * @param[in] nmi The number of input membership functions.
+    * @param[in] rsz The number of bytes used by the rules set. Use the sizeof
+    * operator.
+    */
+    #define QFIS_RULEINDEX_SIZE( nr, nmi, rsz )                             \
+    ( ( 3U*(nr) ) + (nmi) + 2U + ( (rsz)/( 3U*sizeof(qFIS_Rules_t) ) ) )   \
+
+    /**
+    * @brief Build an index from every input membership function to the rules
+    * that reference it, so that the inference only evaluates the rules that
+    * can have a non-zero firing strength.
+    * @details Once the index is built, qFIS_Inference() only evaluates the
+    * rules with at least one non-zero premise and keeps a compact list of the
+    * active rules (the ones with a non-zero firing strength). This list is
+    * then used by the aggregation and the de-fuzzification stages. Rules with
+    * negated premises ( #IS_NOT ) are always evaluated.
+    * @pre I/Os and fuzzy sets must be previously initialized by qFIS_InputSetup(),
+    * qFIS_OutputSetup(), qFIS_SetMF() and qFIS_Setup() respectively.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[in] w An array of @a n elements used to store the index. Use the
+    * #QFIS_RULEINDEX_SIZE macro to obtain the required size. Pass @c NULL to
+    * evaluate the whole rule set on every inference.
+    * @param[in] n The number of elements of @a w.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_SetRuleIndex( qFIS_t * const f,
+                           size_t *w,
+                           const size_t n );
+
+    /**
+    * @brief Get the list of active rules from the last inference.
+    * @pre The rule index should be enabled with qFIS_SetRuleIndex().
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[out] n The number of active rules. To ignore pass @c NULL.
+    * @return A pointer to the array with the indexes of the rules that have
+    * a non-zero firing strength. If the rule index is not enabled, returns
+    * @c NULL.
+    */
+    const size_t* qFIS_GetActiveRules( const qFIS_t * const f,
+                                       size_t * const n );
+
+    /**
+    * @brief Enable the adaptive de-fuzzification of a ::Mamdani FIS.
+    * @details Instead of sampling the aggregated output at the
+    * #qFIS_EvalPoints uniformly spaced points, the output range is first split
+    * into @a n coarse intervals that are then recursively halved only where
+    * the aggregated membership is non-zero and departs from a straight line.
+    * Each interval is refined until its contribution to the error of the
+    * de-fuzzified value falls below @a tol, so flat and empty regions of the
+    * aggregated set are covered with very few evaluations.
+    * @note The coarse intervals should be narrower than the support of the
+    * narrowest output membership function, otherwise it can be missed.
+    * @note When an output stores its aggregated region with
+    * qFIS_StoreAggregatedRegion(), the uniform sampling is used instead.
+    * @pre I/Os and fuzzy sets must be previously initialized by qFIS_InputSetup(),
+    * qFIS_OutputSetup(), qFIS_SetMF() and qFIS_Setup() respectively.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[in] n The number of coarse intervals [ n >= 2 ]. Pass zero to go
+    * back to the uniform sampling.
+    * @param[in] tol The tolerance of the de-fuzzified value, in output units.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_SetDeFuzzAdaptive( qFIS_t * const f,
+                                const size_t n,
+                                const float tol );
+
+    /**
+    * @brief Returns the number of elements required by the float workspace
+    * of qFIS_SetType2().
+    * @param[in] nr The number of rules.
+    * @param[in] no The number of outputs.
+    */
+    #define QFIS_TYPE2_WORK_SIZE( nr, no )      ( (nr) + ( 4U*(nr)*(no) ) )
+
+    /**
+    * @brief Returns the number of elements required by the index workspace
+    * of qFIS_SetType2().
+    * @param[in] nr The number of rules.
+    * @param[in] no The number of outputs.
+    */
+    #define QFIS_TYPE2_INDEX_SIZE( nr, no )     ( ( 2U*(nr)*(no) ) + (no) + 1U )
+
+    /**
+    * @brief Turn the FIS instance into an interval type-2 system by adding
+    * a lower membership function to every input fuzzy set.
+    * @details The membership functions given to qFIS_Setup() become the upper
+    * bounds of the footprint of uncertainty, so each rule fires with an
+    * interval of strengths. The outputs are then obtained by center-of-sets
+    * type reduction with the Enhanced Karnik-Mendel (EKM) algorithm : on
+    * ::Mamdani systems, each rule consequent is represented by the centroid
+    * of its output membership function, on ::Sugeno systems by the value of
+    * its ::constantmf or ::linearmf function. The consequents are kept sorted
+    * between calls, so the sort is skipped on ::Mamdani systems and takes a
+    * linear time on ::Sugeno systems with slowly varying inputs. The crisp
+    * output is the center of the type-reduced interval, that can be obtained
+    * with qFIS_GetOutputInterval(). If no rule is fired, the previous
+    * interval is kept.
+    * @note ::Tsukamoto systems are not supported. The rule index built by
+    * qFIS_SetRuleIndex() and the de-fuzzification method are not used
+    * while the type-2 evaluation is enabled.
+    * @note On ::Mamdani systems, call qFIS_Refresh() after modifying the
+    * parameters of an output membership function.
+    * @pre I/Os and fuzzy sets must be previously initialized by qFIS_InputSetup(),
+    * qFIS_OutputSetup(), qFIS_SetMF() and qFIS_Setup() respectively.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[in] mf_lower An array of qFIS_MF_t objects with the lower
+    * membership functions, set with qFIS_SetMF() using the same tags of the
+    * upper ones. The lower membership is limited to the upper one. Pass
+    * @c NULL to go back to the type-1 evaluation.
+    * @param[in] nml The number of bytes used by @a mf_lower. Use the sizeof
+    * operator.
+    * @param[in] w An array used to store the lower rule strengths and the
+    * type reduction data. Use the #QFIS_TYPE2_WORK_SIZE macro to obtain the
+    * required size.
+    * @param[in] nw The number of elements of @a w.
+    * @param[in] idx An array used to store the sorted consequents. Use the
+    * #QFIS_TYPE2_INDEX_SIZE macro to obtain the required size.
+    * @param[in] ni The number of elements of @a idx.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_SetType2( qFIS_t * const f,
+                       qFIS_MF_t * const mf_lower,
+                       const size_t nml,
+                       float *w,
+                       const size_t nw,
+                       size_t *idx,
+                       const size_t ni );
+
+    /**
+    * @brief Get the current setting of a parameter of the FIS instance.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[in] p The requested parameter. Only ::qFIS_Implication,
+    * ::qFIS_Aggregation, ::qFIS_AND and ::qFIS_OR are supported.
+    * @param[out] x The current value of the parameter.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_GetParameter( const qFIS_t * const f,
+                           const qFIS_Parameter_t p,
+                           qFIS_ParamValue_t * const x );
+
+    /**
+    * @brief Get the de-fuzzification method of the FIS instance.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[out] m The current de-fuzzification method.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_GetDeFuzzMethod( const qFIS_t * const f,
+                              qFIS_DeFuzz_Method_t * const m );
+
+    /**
+    * @brief Get the shape of a membership function.
+    * @param[in] m A pointer to the membership function object.
+    * @param[out] s The shape of the membership function. ::custommf is
+    * retrieved for user-defined functions.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_GetMFName( const qFIS_MF_t * const m,
+                        qFIS_MF_Name_t * const s );
+
+    /**
+    * @brief Notify the FIS instance that the parameters of its membership
+    * functions have been modified in-place. The groups built with
+    * qFIS_SetMFGroups() are updated and the next evaluation is performed
+    * from scratch.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_Refresh( qFIS_t * const f );
+
+#ifdef QFIS_PROFILING
+    /**
+    * @brief Attach a profiler to the FIS instance to measure the time spent
+    * on each evaluation stage and to collect rule firing statistics.
+    * @note Only available when the library is built with @c QFIS_PROFILING.
+    * The macro should be defined for both the library and the application,
+    * since it changes the layout of the qFIS_t object.
+    * @pre I/Os and fuzzy sets must be previously initialized by qFIS_InputSetup(),
+    * qFIS_OutputSetup(), qFIS_SetMF() and qFIS_Setup() respectively.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[in] p A pointer to the profiler instance. Pass @c NULL to detach
+    * the profiler.
+    * @param[in] clk The function that returns the timestamp. Pass @c NULL to
+    * only collect the rule statistics.
+    * @param[in] fired An array with one element per rule where the number of
+    * times that each rule fired is stored. Only the rules that are actually
+    * evaluated are accounted, so with qFIS_SetRuleIndex() an active rule
+    * that is kept because its inputs did not change is not counted again.
+    * Pass @c NULL to disable the rule statistics.
+    * @param[in] strength An array with one element per rule where the
+    * accumulated firing strength of each rule is stored. Pass @c NULL to
+    * disable the rule statistics. The sums are single precision, so after
+    * about 2^24 inferences new strengths barely change them and the mean of
+    * qFIS_GetRuleMeanStrength() drifts low. Use qFIS_ResetProfile() to
+    * restart the statistics in longer runs.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_SetProfile( qFIS_t * const f,
+                         qFIS_Profile_t * const p,
+                         qFIS_ProfileClock_t clk,
+                         uint32_t *fired,
+                         float *strength );
+
+    /**
+    * @brief Clear all the counters of the profiler, including the rule
+    * statistics.
+    * @note Only available when the library is built with @c QFIS_PROFILING
+    * @param[in] p A pointer to the profiler instance.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_ResetProfile( qFIS_Profile_t * const p );
+
+    /**
+    * @brief Get the mean firing strength of a rule over all the inferences
+    * accounted by the profiler.
+    * @note Only available when the library is built with @c QFIS_PROFILING
+    * @param[in] p A pointer to the profiler instance.
+    * @param[in] r The index of the rule.
+    * @return The mean firing strength of the rule. If there is no data,
+    * returns zero.
+    */
+    float qFIS_GetRuleMeanStrength( const qFIS_Profile_t * const p,
+                                    const size_t r );
+
+    /**
+    * @brief Get the rules that have never fired since the profiler was
+    * attached or reset. These rules are candidates for pruning.
+    * @note Only available when the library is built with @c QFIS_PROFILING
+    * @param[in] p A pointer to the profiler instance.
+    * @param[out] list An array where the indexes of the rules that never fired
+    * will be stored. To only obtain the number of rules, pass @c NULL.
+    * @param[in] n The number of elements of @a list.
+    * @return The number of rules that never fired.
+    */
+    size_t qFIS_GetUnfiredRules( const qFIS_Profile_t * const p,
+                                 size_t * const list,
+                                 const size_t n );
+#endif
+
     /** @}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,329 @@
+/*!
+ * @file qfisfp16.h
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Fixed-point Q16.16 Fuzzy Inference System (FIS) Engine
+ **/
+
+#ifndef QFISFP16_H
+#define QFISFP16_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #include <stdlib.h>
+    #include <stdint.h>
+    #include "qfis.h"
+    #include "qfp16.h"
+
+    /** @addtogroup  qfis
+    *  @{
+    */
+
+    /*cstat -MISRAC2012-Dir-4.8*/
+
+    /*! @cond  */
+    typedef struct
+    {
+        qFP16_t min, max, value;
+    } qFISFP16_IO_Base_t;
+    /*! @endcond  */
+
+    /**
+    * @brief A fixed-point FIS Input object
+    * @details The instance should be initialized using the qFISFP16_InputSetup()
+    * API.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        qFISFP16_IO_Base_t b;
+        /*! @endcond  */
+    } qFISFP16_Input_t;
+
+    /**
+    * @brief A fixed-point FIS Output object
+    * @details The instance should be initialized using the qFISFP16_OutputSetup()
+    * API.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        qFISFP16_IO_Base_t b;
+        void *owner;
+        qFP16_t *xag, *yag;
+        qFP16_t t, x, y, data[ 4 ];
+        /*! @endcond  */
+    } qFISFP16_Output_t;
+
+    /*cstat +MISRAC2012-Dir-4.8*/
+
+    /*! @cond  */
+    typedef qFP16_t (*qFISFP16_MF_Fcn_t)( const qFISFP16_IO_Base_t * const in, const qFP16_t *p, const size_t n );
+    typedef qFP16_t (*qFISFP16_DeFuzz_Fcn_t)( qFISFP16_Output_t * const o, const qFIS_DeFuzzState_t stage );
+    /*! @endcond  */
+
+    /**
+    * @brief A fixed-point FIS Membership Function
+    * @details The instance should be initialized using the qFISFP16_SetMF() API.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        qFISFP16_MF_Fcn_t shape;
+        const qFP16_t *points;
+        qFP16_t fx, h;
+        size_t index;
+        /*! @endcond  */
+    } qFISFP16_MF_t;
+
+    /**
+    * @brief A fixed-point FIS(Fuzzy Inference System) object
+    * @details The instance should be initialized using the qFISFP16_Setup() API.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct _qFISFP16_s //skipcq: CXX-E2000
+    {
+        /*! @cond  */
+        qFISFP16_Input_t *input;
+        qFISFP16_Output_t *output;
+        qFISFP16_MF_t *inMF, *outMF;
+        qFP16_t (*andOp)( const qFP16_t a, const qFP16_t b );
+        qFP16_t (*orOp)( const qFP16_t a, const qFP16_t b );
+        qFP16_t (*implicate)( const qFP16_t a, const qFP16_t b );
+        qFP16_t (*aggregate)( const qFP16_t a, const qFP16_t b );
+        size_t (*inferenceState)( struct _qFISFP16_s * const f, size_t i );
+        size_t (*aggregationState)( struct _qFISFP16_s * const f, size_t i );
+        qFISFP16_DeFuzz_Fcn_t deFuzz;
+        qFP16_t *ruleWeight;
+        qFP16_t *wi;
+        const qFIS_Rules_t *rules;
+        size_t nInputs, nOutputs;
+        size_t nMFInputs, nMFOutputs;
+        size_t nPoints;
+        size_t nRules, ruleCount;
+        qFP16_t rStrength;
+        qFIS_Rules_t lastConnector;
+        qFIS_Type_t type;
+        /*! @endcond  */
+    } qFISFP16_t;
+
+    /**
+    * @brief Set parameters of the fixed-point FIS instance.
+    * @note The number of evaluation points ::qFIS_EvalPoints is limited to
+    * the range [ 20, 16383 ] so that the de-fuzzification sums always fit in
+    * the Q16.16 format.
+    * @param[in] f A pointer to the fixed-point Fuzzy Inference System instance.
+    * @param[in] p The requested parameter to change/set.
+    * @param[in] x The value of the parameter to set.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_SetParameter( qFISFP16_t * const f,
+                               const qFIS_Parameter_t p,
+                               const qFIS_ParamValue_t x );
+
+    /**
+    * @brief Change the default de-Fuzzification method of the fixed-point FIS
+    * instance.
+    * @param[in] f A pointer to the fixed-point Fuzzy Inference System instance.
+    * @param[in] m The de-fuzzification method: use one of the following :
+    *  ::centroid, ::bisector, ::mom, ::lom, ::som, ::wtaver, ::wtsum
+    * @note ::centroid, ::bisector, ::mom, ::lom and ::som only apply for a
+    * ::Mamdani FIS
+    * @note ::wtaver and ::wtsum only apply for a ::Sugeno FIS.
+    * @note ::wtaver only apply for a ::Tsukamoto FIS
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_SetDeFuzzMethod( qFISFP16_t * const f,
+                                  qFIS_DeFuzz_Method_t m );
+
+    /**
+    * @brief Setup and initialize the fixed-point FIS instance.
+    * @note Default configuration : AND = Min, OR = Max, Implication = Min
+    * Aggregation = Max, EvalPoints = 100
+    * @note Rules are defined with the same statements and format used by the
+    * floating-point engine. See qFIS_Setup().
+    * @param[in] f A pointer to the fixed-point Fuzzy Inference System instance.
+    * @param[in] t Type of inference ::Mamdani, ::Sugeno or ::Tsukamoto.
+    * @param[in] inputs An array with all the system inputs as qFISFP16_Input_t
+    * objects.
+    * @param[in] ni The number of bytes used by @a inputs. Use the sizeof operator.
+    * @param[in] outputs An array with all the system outputs as
+    * qFISFP16_Output_t objects.
+    * @param[in] no The number of bytes used by @a outputs. Use the sizeof operator.
+    * @param[in] mf_inputs An array with all the membership functions related to
+    * the inputs. This should be an array of qFISFP16_MF_t objects.
+    * @param[in] nmi The number of bytes used by @a mf_inputs. Use the sizeof
+    * operator.
+    * @param[in] mf_outputs An array with all the membership functions related to
+    * the outputs. This should be an array of qFISFP16_MF_t objects.
+    * @param[in] nmo The number of bytes used by @a mf_outputs. Use the sizeof
+    * operator.
+    * @param[in] r The rules set.
+    * @param[in] wi An array of size @a n were the rule strengths will be stored.
+    * @param[in] n Number of rules
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_Setup( qFISFP16_t * const f,
+                        const qFIS_Type_t t,
+                        qFISFP16_Input_t * const inputs,
+                        const size_t ni,
+                        qFISFP16_Output_t * const outputs,
+                        const size_t no,
+                        qFISFP16_MF_t * const mf_inputs,
+                        const size_t nmi,
+                        qFISFP16_MF_t * const mf_outputs,
+                        const size_t nmo,
+                        const qFIS_Rules_t * const r,
+                        qFP16_t *wi,
+                        const size_t n
+                        );
+
+    /**
+    * @brief Setup the input with the specified tag and set limits for it
+    * @param[in] v An array with the FIS inputs as a qFISFP16_Input_t array.
+    * @param[in] t The input tag
+    * @param[in] min Minimum allowed value for this input
+    * @param[in] max Max allowed value for this input
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_InputSetup( qFISFP16_Input_t * const v,
+                             const qFIS_Tag_t t,
+                             const qFP16_t min,
+                             const qFP16_t max );
+
+    /**
+    * @brief Setup the output with the specified tag and set limits for it
+    * @param[in] v An array with the FIS outputs as a qFISFP16_Output_t array.
+    * @param[in] t The output tag
+    * @param[in] min Minimum allowed value for this output
+    * @param[in] max Max allowed value for this output
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_OutputSetup( qFISFP16_Output_t * const v,
+                              const qFIS_Tag_t t,
+                              const qFP16_t min,
+                              const qFP16_t max );
+
+    /**
+    * @brief Set a crisp value of the input with the specified tag.
+    * @param[in] v An array with the FIS inputs as a qFISFP16_Input_t array.
+    * @param[in] t The input tag
+    * @param[in] value The crisp value to set
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_SetInput( qFISFP16_Input_t * const v,
+                           const qFIS_Tag_t t,
+                           const qFP16_t value );
+
+    /**
+    * @brief Get the de-fuzzified crisp value from the the output  with the
+    * specified tag.
+    * @param[in] v An array with the FIS inputs as a qFISFP16_Output_t array.
+    * @param[in] t The output tag
+    * @return The requested de-fuzzified crips value.
+    */
+    qFP16_t qFISFP16_GetOutput( const qFISFP16_Output_t * const v,
+                                const qFIS_Tag_t t );
+
+    /**
+    * @brief Set the IO tag and points for the specified membership function
+    * @param[in] m An array with the required membership functions as
+    * qFISFP16_MF_t objects.
+    * @param[in] io The I/O tag related with this membership function
+    * @param[in] mf The user-defined tag for this membership function
+    * @param[in] s The wanted shape/form for this membership function. The same
+    * shapes of the floating-point engine are supported. See qFIS_SetMF().
+    * @param[in] custom_mf Custom user-defined membership function. To ignore
+    * pass @c NULL as argument.
+    * @param[in] cp Points or coefficients of the membership function as
+    * fixed-point values. Use the qFP16_Constant() macro to define them.
+    * @param[in] h Height of the membership function. [ 0 <= h <= qFP16.one ]
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_SetMF( qFISFP16_MF_t * const m,
+                        const qFIS_Tag_t io,
+                        const qFIS_Tag_t mf,
+                        const qFIS_MF_Name_t s,
+                        qFISFP16_MF_Fcn_t custom_mf,
+                        const qFP16_t *cp,
+                        const qFP16_t h );
+
+    /**
+    * @brief Set location to store the aggregated region for supplied FIS output
+    * @note This feature only applies to Mamdani systems.
+    * @warning Array size of @a x and @a y should be greater or equal to the
+    * number of evaluation points of the FIS instance.
+    * @pre The FIS instance and the output should be previously configured
+    * initialized with qFISFP16_Setup() and qFISFP16_OutputSetup() respectively.
+    * @param[in] o An array of type qFISFP16_Output_t with the FIS outputs.
+    * @param[in] t The output tag
+    * @param[in] x Array where the x-axis points of the aggregated output will be
+    * stored
+    * @param[in] y Array where the y-axis points of the aggregated output will be
+    * stored
+    * @param[in] n Number of elements in  @a x or @a y.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_StoreAggregatedRegion( qFISFP16_Output_t * const o,
+                                        const qFIS_Tag_t t,
+                                        qFP16_t *x,
+                                        qFP16_t *y,
+                                        const size_t n );
+
+    /**
+    * @brief Perform the fuzzification operation over the crisp inputs on the
+    * requested fixed-point FIS object
+    * @pre I/Os and fuzzy sets must be previously initialized by
+    * qFISFP16_InputSetup(), qFISFP16_OutputSetup(), qFISFP16_SetMF() and
+    * qFISFP16_Setup() respectively.
+    * @param[in] f A pointer to the fixed-point Fuzzy Inference System instance.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_Fuzzify( qFISFP16_t * const f );
+
+    /**
+    * @brief Perform the inference process on the requested fixed-point FIS
+    * object
+    * @pre The instance should have already invoked the fuzzification operation
+    * successfully with qFISFP16_Fuzzify()
+    * @param[in] f A pointer to the fixed-point Fuzzy Inference System instance.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_Inference( qFISFP16_t * const f );
+
+    /**
+    * @brief Perform the de-Fuzzification operation to compute the crisp outputs.
+    * @pre The instance should have already invoked the inference process
+    * successfully with qFISFP16_Inference()
+    * @note When none of the rules is fired, the outputs are set to the middle
+    * of their range.
+    * @param[in] f A pointer to the fixed-point Fuzzy Inference System instance.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_DeFuzzify( qFISFP16_t * const f );
+
+    /**
+    * @brief Set weights to the rules of the fixed-point inference system.
+    * @pre I/Os and fuzzy sets must be previously initialized by
+    * qFISFP16_InputSetup(), qFISFP16_OutputSetup(), qFISFP16_SetMF() and
+    * qFISFP16_Setup() respectively.
+    * @param[in] f A pointer to the fixed-point Fuzzy Inference System instance.
+    * @param[in] rWeights An array with the values of every rule weight;
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFISFP16_SetRuleWeights( qFISFP16_t * const f,
+                                 qFP16_t *rWeights );
+
+    /** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
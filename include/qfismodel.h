@@ -0,0 +1,170 @@
+/*!
+ * @file qfismodel.h
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Binary model format for the Fuzzy Inference System (FIS) Engine
+ **/
+
+#ifndef QFISMODEL_H
+#define QFISMODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #include <stdlib.h>
+    #include <stdint.h>
+    #include "qfis.h"
+
+    /** @addtogroup  qfis
+    *  @{
+    */
+
+    /** @brief The signature of a binary FIS model ( "QFIS" ) */
+    #define QFIS_MODEL_MAGIC        ( 0x53494651UL )
+
+    /** @brief The version of the binary FIS model format */
+    #define QFIS_MODEL_VERSION      ( 1U )
+
+    /**
+    * @brief The header of a binary FIS model
+    * @details A binary model is a contiguous, 4-byte aligned block of memory
+    * with the following sections, stored in the native byte order :
+    *
+    * - The header : a qFIS_ModelHeader_t structure.
+    * - The I/O table : @a nInputs + @a nOutputs qFIS_ModelIO_t entries, inputs
+    * first.
+    * - The membership function table : @a nMFInputs + @a nMFOutputs
+    * qFIS_ModelMF_t entries, input membership functions first.
+    * - The parameters : @a nParams float values referenced by the membership
+    * functions.
+    * - The rule weights : @a nRules float values, only if @a hasWeights is set.
+    * - The rules : @a nRuleItems qFIS_Rules_t items with the same layout that
+    * the #QFIS_RULES_BEGIN ... #QFIS_RULES_END statements produce, padded to a
+    * multiple of 4 bytes.
+    */
+    typedef struct
+    {
+        uint32_t magic;         /*!< Should be #QFIS_MODEL_MAGIC*/
+        uint16_t version;       /*!< Should be #QFIS_MODEL_VERSION*/
+        uint8_t type;           /*!< The inference type as a ::qFIS_Type_t value*/
+        uint8_t ruleItemSize;   /*!< Should be sizeof(qFIS_Rules_t)*/
+        uint16_t nInputs;       /*!< Number of inputs*/
+        uint16_t nOutputs;      /*!< Number of outputs*/
+        uint16_t nMFInputs;     /*!< Number of input membership functions*/
+        uint16_t nMFOutputs;    /*!< Number of output membership functions*/
+        uint16_t nRules;        /*!< Number of rules*/
+        uint16_t nPoints;       /*!< Number of points for de-fuzzification*/
+        uint32_t nParams;       /*!< Number of membership function parameters*/
+        uint32_t nRuleItems;    /*!< Number of items in the rule set*/
+        uint8_t andOp;          /*!< AND operator as a ::qFIS_ParamValue_t value*/
+        uint8_t orOp;           /*!< OR operator as a ::qFIS_ParamValue_t value*/
+        uint8_t implication;    /*!< Implication method as a ::qFIS_ParamValue_t value*/
+        uint8_t aggregation;    /*!< Aggregation method as a ::qFIS_ParamValue_t value*/
+        uint8_t deFuzz;         /*!< De-fuzzification method as a ::qFIS_DeFuzz_Method_t value*/
+        uint8_t hasWeights;     /*!< 1 if the model includes rule weights*/
+        uint16_t reserved;      /*!< Reserved, should be zero*/
+        uint32_t size;          /*!< The total size of the model in bytes*/
+    } qFIS_ModelHeader_t;
+
+    /**
+    * @brief An entry of the I/O table of a binary FIS model
+    */
+    typedef struct
+    {
+        float min;              /*!< Minimum value of the input/output*/
+        float max;              /*!< Maximum value of the input/output*/
+    } qFIS_ModelIO_t;
+
+    /**
+    * @brief An entry of the membership function table of a binary FIS model
+    */
+    typedef struct
+    {
+        uint16_t io;            /*!< The index of the related input/output*/
+        uint8_t shape;          /*!< The shape as a ::qFIS_MF_Name_t value*/
+        uint8_t reserved;       /*!< Reserved, should be zero*/
+        uint32_t offset;        /*!< Index of the first parameter*/
+        float h;                /*!< Height of the membership function*/
+    } qFIS_ModelMF_t;
+
+    /**
+    * @brief Get the header of a binary FIS model after validating it. Use it
+    * to obtain the number of elements required for the objects that should be
+    * passed to qFIS_LoadModel().
+    * @param[in] model A pointer to the 4-byte aligned binary model.
+    * @param[in] size The number of bytes available at @a model.
+    * @return A pointer to the model header if the model is valid, otherwise
+    * return @c NULL.
+    */
+    const qFIS_ModelHeader_t* qFIS_GetModelHeader( const void * const model,
+                                                   const size_t size );
+
+    /**
+    * @brief Setup the FIS instance from a binary model without copying it.
+    * @details The I/Os and membership function objects are configured from the
+    * model tables, while the membership function parameters, the rule weights
+    * and the rules are referenced in-place, so the model can reside in flash
+    * or in a memory-mapped file. The model can be replaced at any time by
+    * calling this function again with another model.
+    * @warning The model should remain accessible while it is being used by
+    * the FIS instance.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[in] model A pointer to the 4-byte aligned binary model.
+    * @param[in] size The number of bytes available at @a model.
+    * @param[in] inputs An array of qFIS_Input_t objects.
+    * @param[in] ni The number of bytes used by @a inputs. Use the sizeof operator.
+    * @param[in] outputs An array of qFIS_Output_t objects.
+    * @param[in] no The number of bytes used by @a outputs. Use the sizeof operator.
+    * @param[in] mf_inputs An array of qFIS_MF_t objects for the input membership
+    * functions.
+    * @param[in] nmi The number of bytes used by @a mf_inputs. Use the sizeof
+    * operator.
+    * @param[in] mf_outputs An array of qFIS_MF_t objects for the output
+    * membership functions.
+    * @param[in] nmo The number of bytes used by @a mf_outputs. Use the sizeof
+    * operator.
+    * @param[in] wi An array were the rule strengths will be stored.
+    * @param[in] nw The number of elements of @a wi.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_LoadModel( qFIS_t * const f,
+                        const void * const model,
+                        const size_t size,
+                        qFIS_Input_t * const inputs,
+                        const size_t ni,
+                        qFIS_Output_t * const outputs,
+                        const size_t no,
+                        qFIS_MF_t * const mf_inputs,
+                        const size_t nmi,
+                        qFIS_MF_t * const mf_outputs,
+                        const size_t nmo,
+                        float *wi,
+                        const size_t nw );
+
+    /**
+    * @brief Build a binary FIS model from the text of a MATLAB Fuzzy Logic
+    * Toolbox @c .fis file.
+    * @note Supported types are ::Mamdani and ::Sugeno, with the following
+    * membership functions : @c trimf, @c trapmf, @c gbellmf, @c gaussmf,
+    * @c gauss2mf, @c sigmf, @c dsigmf, @c psigmf, @c pimf, @c smf, @c zmf,
+    * @c linsmf, @c linzmf, @c constant and @c linear.
+    * @param[in] text A null-terminated string with the contents of the
+    * @c .fis file.
+    * @param[out] model A pointer to the 4-byte aligned memory where the model
+    * will be written. Pass @c NULL to only obtain the required size.
+    * @param[in] size The number of bytes available at @a model.
+    * @return The size of the model in bytes on success, otherwise return 0.
+    */
+    size_t qFIS_ImportFIS( const char *text,
+                           void * const model,
+                           const size_t size );
+
+    /** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,209 @@
+/*!
+ * @file qfistrain.h
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Hybrid (ANFIS) training for Sugeno Fuzzy Inference Systems
+ **/
+
+#ifndef QFISTRAIN_H
+#define QFISTRAIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #include <stdlib.h>
+    #include <stdint.h>
+    #include "qfis.h"
+
+    /** @addtogroup  qfis
+    *  @{
+    */
+
+    /**
+    * @brief A FIS trainer object
+    * @details The instance should be initialized using the qFIS_TrainSetup()
+    * API. The trainer accumulates, over a set of samples, the normal
+    * equations of the consequent parameters and the analytic gradient of the
+    * squared error with respect to all the trainable parameters.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        qFIS_t *f;
+        qFIS_MF_Fcn_t gaussShape, gbellShape;
+        qFIS_MF_Fcn_t linearShape;
+        float *A, *b, *g, *phi;
+        float *mu, *w, *y, *s, *e;
+        size_t nc, np;
+        size_t nGrad, nLSE, nErr;
+        float sse;
+        qFIS_ParamValue_t andOp, orOp;
+        uint8_t wtaver;
+        /*! @endcond  */
+    } qFIS_Trainer_t;
+
+    /**
+    * @brief Get the number of elements of the workspace required by
+    * qFIS_TrainSetup().
+    * @details The parameters are arranged as a single vector : the consequent
+    * parameters first, in the order of the output membership functions
+    * ( one for ::constantmf, the number of inputs plus one for ::linearmf ),
+    * followed by the premise parameters, in the order of the input membership
+    * functions ( two for ::gaussmf, three for ::gbellmf ). Premises with any
+    * other shape are not trained.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @return The number of float elements required by the workspace. If the
+    * FIS instance can not be trained, returns 0.
+    */
+    size_t qFIS_TrainWorkSize( const qFIS_t * const f );
+
+    /**
+    * @brief Setup a trainer for a ::Sugeno FIS with ::wtaver or ::wtsum
+    * de-fuzzification, ::constantmf or ::linearmf consequents and ::qFIS_MIN
+    * or ::qFIS_PROD as AND operator.
+    * @warning The parameters of the trained membership functions are updated
+    * in-place, so they should be stored in writable memory.
+    * @pre I/Os and fuzzy sets must be previously initialized by qFIS_InputSetup(),
+    * qFIS_OutputSetup(), qFIS_SetMF() and qFIS_Setup() respectively.
+    * @param[in] t A pointer to the trainer instance.
+    * @param[in] f A pointer to the Fuzzy Inference System instance.
+    * @param[in] work An array used as workspace by the trainer.
+    * @param[in] n The number of elements of @a work. Use qFIS_TrainWorkSize()
+    * to obtain the required size.
+    * @return 1 on success, otherwise return 0. It also fails when @a f cannot
+    * be trained or @a n is less than qFIS_TrainWorkSize().
+    */
+    int qFIS_TrainSetup( qFIS_Trainer_t * const t,
+                         qFIS_t * const f,
+                         float *work,
+                         const size_t n );
+
+    /**
+    * @brief Clear the accumulated normal equations, gradient and error.
+    * @param[in] t A pointer to the trainer instance.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_TrainReset( qFIS_Trainer_t * const t );
+
+    /**
+    * @brief Accumulate the least-squares normal equations of the consequent
+    * parameters over a batch of samples.
+    * @note The FIS instance is only read, so several trainers attached to
+    * the same FIS can process different batches concurrently.
+    * @param[in] t A pointer to the trainer instance.
+    * @param[in] x The input samples, stored row by row, one column per input.
+    * @param[in] y The target outputs, stored row by row, one column per output.
+    * @param[in] n The number of samples.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_TrainAccumulateLSE( qFIS_Trainer_t * const t,
+                                 const float *x,
+                                 const float *y,
+                                 const size_t n );
+
+    /**
+    * @brief Accumulate the analytic gradient of the squared error and the
+    * error itself over a batch of samples.
+    * @note The FIS instance is only read, so several trainers attached to
+    * the same FIS can process different batches concurrently.
+    * @param[in] t A pointer to the trainer instance.
+    * @param[in] x The input samples, stored row by row, one column per input.
+    * @param[in] y The target outputs, stored row by row, one column per output.
+    * @param[in] n The number of samples.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_TrainAccumulateGradient( qFIS_Trainer_t * const t,
+                                      const float *x,
+                                      const float *y,
+                                      const size_t n );
+
+    /**
+    * @brief Add the accumulators of another trainer attached to the same FIS
+    * instance, so that batches processed by different workers can be
+    * combined before calling qFIS_TrainSolveLSE() or qFIS_TrainStep().
+    * @param[in] t A pointer to the destination trainer instance.
+    * @param[in] src A pointer to the trainer whose accumulators will be added.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_TrainMerge( qFIS_Trainer_t * const t,
+                         const qFIS_Trainer_t * const src );
+
+    /**
+    * @brief Solve the accumulated normal equations and write the optimal
+    * consequent parameters to the FIS instance.
+    * @details The ridge-regularized system is solved around the current
+    * parameters, so consequents that were never fired keep their values.
+    * @note The accumulated normal equations are consumed, call
+    * qFIS_TrainReset() before accumulating them again.
+    * @param[in] t A pointer to the trainer instance.
+    * @param[in] lambda The regularization factor [ lambda >= 0 ].
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_TrainSolveLSE( qFIS_Trainer_t * const t,
+                            const float lambda );
+
+    /**
+    * @brief Perform a gradient-descent step using the mean of the
+    * accumulated gradient.
+    * @param[in] t A pointer to the trainer instance.
+    * @param[in] etaPremise The learning rate of the premise parameters.
+    * @param[in] etaConsequent The learning rate of the consequent parameters.
+    * Pass zero when the consequents are obtained by qFIS_TrainSolveLSE().
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFIS_TrainStep( qFIS_Trainer_t * const t,
+                        const float etaPremise,
+                        const float etaConsequent );
+
+    /**
+    * @brief Get the accumulated gradient.
+    * @param[in] t A pointer to the trainer instance.
+    * @param[out] n The number of parameters. To ignore pass @c NULL.
+    * @return A pointer to the gradient of the sum of squared errors divided
+    * by two, arranged as described in qFIS_TrainWorkSize(). If the trainer is
+    * not initialized, returns @c NULL.
+    */
+    const float* qFIS_TrainGetGradient( const qFIS_Trainer_t * const t,
+                                        size_t * const n );
+
+    /**
+    * @brief Get the root mean square error of the samples accumulated by
+    * qFIS_TrainAccumulateGradient().
+    * @param[in] t A pointer to the trainer instance.
+    * @return The root mean square error. If no samples were accumulated,
+    * returns -1.
+    */
+    float qFIS_TrainGetError( const qFIS_Trainer_t * const t );
+
+    /**
+    * @brief Run a complete hybrid training epoch over a dataset : the
+    * consequent parameters are first obtained by least-squares and then the
+    * premise parameters are updated by a gradient-descent step.
+    * @note To process the dataset in parallel, use the individual stages on
+    * one trainer per worker and combine them with qFIS_TrainMerge().
+    * @param[in] t A pointer to the trainer instance.
+    * @param[in] x The input samples, stored row by row, one column per input.
+    * @param[in] y The target outputs, stored row by row, one column per output.
+    * @param[in] n The number of samples.
+    * @param[in] eta The learning rate of the premise parameters.
+    * @param[in] lambda The regularization factor of the least-squares stage.
+    * @return The root mean square error after the least-squares stage. On
+    * failure returns -1.
+    */
+    float qFIS_TrainEpoch( qFIS_Trainer_t * const t,
+                           const float *x,
+                           const float *y,
+                           const size_t n,
+                           const float eta,
+                           const float lambda );
+
+    /** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
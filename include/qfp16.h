@@ -21,6 +21,18 @@ extern "C" {
     *  @{
     */
 
+    #ifndef QFP16_CORDIC_ITERATIONS
+        /**
+        * @brief The number of iterations performed by the CORDIC engine,
+        * in the range [ 1, 28 ]. Each iteration adds about one bit of
+        * precision. Define it at compile time to override the default value.
+        * @note Define @c QFP16_USE_CORDIC to compute qFP16_Sin(), qFP16_Cos(),
+        * qFP16_Tan() and qFP16_Atan2() ( and the functions built on them )
+        * with the CORDIC engine.
+        */
+        #define QFP16_CORDIC_ITERATIONS     ( 20 )
+    #endif
+
     /**  @brief Fixed-point Q16.16 type with width of exactly 32 bits.*/
     typedef int32_t qFP16_t;
 
@@ -73,6 +85,9 @@ extern "C" {
     /**
     * @brief A Q16.16 fixed-point settings object
     * @details The instance should be accessed using the qFP16_SettingsSet() API.
+    * Settings can be applied globally with qFP16_SettingsSelect() or passed
+    * explicitly to the @c _Ctx variants of the API, which do not use any shared
+    * state and can be called concurrently from different threads or interrupts.
     * @note Do not access any member of this structure directly.
     */
     typedef struct
@@ -114,6 +129,16 @@ extern "C" {
     */
     int qFP16_FPToInt( const qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_FPToInt(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return Same as qFP16_FPToInt().
+    */
+    int qFP16_FPToInt_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t x );
+
     /**
     * @brief Returns the int value @a x converted to fixed-point q16.16.
     * @param[in] x The integer value.
@@ -128,6 +153,16 @@ extern "C" {
     */
     qFP16_t qFP16_FloatToFP( const float x );
 
+    /**
+    * @brief Same as qFP16_FloatToFP(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The floating-point value.
+    * @return Same as qFP16_FloatToFP().
+    */
+    qFP16_t qFP16_FloatToFP_Ctx( const qFP16_Settings_t * const ctx,
+                                 const float x );
+
      /**
     * @brief Returns the fixed-point value @a x converted to float.
     * @param[in] x The fixed-point(q16.16) value.
@@ -142,6 +177,16 @@ extern "C" {
     */
     qFP16_t qFP16_DoubleToFP( const double x );
 
+    /**
+    * @brief Same as qFP16_DoubleToFP(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The double precision floating-point value.
+    * @return Same as qFP16_DoubleToFP().
+    */
+    qFP16_t qFP16_DoubleToFP_Ctx( const qFP16_Settings_t * const ctx,
+                                  const double x );
+
     /**
     * @brief Returns the fixed-point value @a x converted to double.
     * @param[in] x The fixed-point(q16.16) value.
@@ -156,6 +201,16 @@ extern "C" {
     */
     qFP16_t qFP16_Abs( const qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Abs(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return Same as qFP16_Abs().
+    */
+    qFP16_t qFP16_Abs_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t x );
+
     /**
     * @brief Returns the largest integer value less than or equal to @a x.
     * @param[in] x The fixed-point(q16.16) value.
@@ -188,6 +243,38 @@ extern "C" {
     qFP16_t qFP16_Add( const qFP16_t X,
                        const qFP16_t Y );
 
+    /**
+    * @brief Same as qFP16_Add(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] X The fixed-point(q16.16) value.
+    * @param[in] Y The fixed-point(q16.16) value.
+    * @return Same as qFP16_Add().
+    */
+    qFP16_t qFP16_Add_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t X,
+                           const qFP16_t Y );
+
+    /**
+    * @brief Returns the fixed-point addition @a X + @a Y, saturating.
+    * @param[in] X The fixed-point(q16.16) value.
+    * @param[in] Y The fixed-point(q16.16) value.
+    * @return This function returns the result saturated to the full Q16.16 range
+    * when an operation overflow is detected.
+    */
+    qFP16_t qFP16_Add_Sat( const qFP16_t X,
+                           const qFP16_t Y );
+
+    /**
+    * @brief Returns the fixed-point addition @a X + @a Y, non-saturating.
+    * @param[in] X The fixed-point(q16.16) value.
+    * @param[in] Y The fixed-point(q16.16) value.
+    * @return This function returns the result or @c qFP16.overflow when an
+    * operation overflow is detected.
+    */
+    qFP16_t qFP16_Add_NoSat( const qFP16_t X,
+                             const qFP16_t Y );
+
     /**
     * @brief Returns the fixed-point subtraction  @a x - @a y.
     * @param[in] X The fixed-point(q16.16) value.
@@ -198,6 +285,38 @@ extern "C" {
     qFP16_t qFP16_Sub( const qFP16_t X,
                        const qFP16_t Y );
 
+    /**
+    * @brief Same as qFP16_Sub(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] X The fixed-point(q16.16) value.
+    * @param[in] Y The fixed-point(q16.16) value.
+    * @return Same as qFP16_Sub().
+    */
+    qFP16_t qFP16_Sub_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t X,
+                           const qFP16_t Y );
+
+    /**
+    * @brief Returns the fixed-point subtraction @a X - @a Y, saturating.
+    * @param[in] X The fixed-point(q16.16) value.
+    * @param[in] Y The fixed-point(q16.16) value.
+    * @return This function returns the result saturated to the full Q16.16 range
+    * when an operation overflow is detected.
+    */
+    qFP16_t qFP16_Sub_Sat( const qFP16_t X,
+                           const qFP16_t Y );
+
+    /**
+    * @brief Returns the fixed-point subtraction @a X - @a Y, non-saturating.
+    * @param[in] X The fixed-point(q16.16) value.
+    * @param[in] Y The fixed-point(q16.16) value.
+    * @return This function returns the result or @c qFP16.overflow when an
+    * operation overflow is detected.
+    */
+    qFP16_t qFP16_Sub_NoSat( const qFP16_t X,
+                             const qFP16_t Y );
+
     /**
     * @brief Returns the fixed-point product operation  @a x * @a y.
     * @param[in] x The fixed-point(q16.16) value.
@@ -208,6 +327,58 @@ extern "C" {
     qFP16_t qFP16_Mul( const qFP16_t x,
                        const qFP16_t y );
 
+    /**
+    * @brief Same as qFP16_Mul(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return Same as qFP16_Mul().
+    */
+    qFP16_t qFP16_Mul_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t x,
+                           const qFP16_t y );
+
+    /**
+    * @brief Returns the fixed-point product @a x * @a y, rounding and saturating.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return This function returns the result saturated to the full Q16.16 range
+    * when an operation overflow is detected.
+    */
+    qFP16_t qFP16_Mul_RoundSat( const qFP16_t x,
+                                const qFP16_t y );
+
+    /**
+    * @brief Returns the fixed-point product @a x * @a y, rounding and non-saturating.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return This function returns the result or @c qFP16.overflow when an
+    * operation overflow is detected.
+    */
+    qFP16_t qFP16_Mul_Round( const qFP16_t x,
+                             const qFP16_t y );
+
+    /**
+    * @brief Returns the fixed-point product @a x * @a y, truncating and saturating.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return This function returns the result saturated to the full Q16.16 range
+    * when an operation overflow is detected.
+    */
+    qFP16_t qFP16_Mul_TruncSat( const qFP16_t x,
+                                const qFP16_t y );
+
+    /**
+    * @brief Returns the fixed-point product @a x * @a y, truncating and non-saturating.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return This function returns the result or @c qFP16.overflow when an
+    * operation overflow is detected.
+    */
+    qFP16_t qFP16_Mul_Trunc( const qFP16_t x,
+                             const qFP16_t y );
+
     /**
     * @brief Returns the fixed-point division operation  @a x / @a y.
     * @param[in] x The fixed-point(q16.16) value.
@@ -218,6 +389,58 @@ extern "C" {
     qFP16_t qFP16_Div( const qFP16_t x,
                        const qFP16_t y );
 
+    /**
+    * @brief Same as qFP16_Div(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return Same as qFP16_Div().
+    */
+    qFP16_t qFP16_Div_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t x,
+                           const qFP16_t y );
+
+    /**
+    * @brief Returns the fixed-point division @a x / @a y, rounding and saturating.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return This function returns the result saturated to the full Q16.16 range
+    * when an operation overflow is detected.
+    */
+    qFP16_t qFP16_Div_RoundSat( const qFP16_t x,
+                                const qFP16_t y );
+
+    /**
+    * @brief Returns the fixed-point division @a x / @a y, rounding and non-saturating.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return This function returns the result or @c qFP16.overflow when an
+    * operation overflow is detected.
+    */
+    qFP16_t qFP16_Div_Round( const qFP16_t x,
+                             const qFP16_t y );
+
+    /**
+    * @brief Returns the fixed-point division @a x / @a y, truncating and saturating.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return This function returns the result saturated to the full Q16.16 range
+    * when an operation overflow is detected.
+    */
+    qFP16_t qFP16_Div_TruncSat( const qFP16_t x,
+                                const qFP16_t y );
+
+    /**
+    * @brief Returns the fixed-point division @a x / @a y, truncating and non-saturating.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @param[in] y The fixed-point(q16.16) value.
+    * @return This function returns the result or @c qFP16.overflow when an
+    * operation overflow is detected.
+    */
+    qFP16_t qFP16_Div_Trunc( const qFP16_t x,
+                             const qFP16_t y );
+
     /**
     * @brief Returns the fixed-point modulo operation  @a x % @a y.
     * @param[in] x The fixed-point(q16.16) value.
@@ -235,6 +458,16 @@ extern "C" {
     */
     qFP16_t qFP16_Sqrt( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Sqrt(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return Same as qFP16_Sqrt().
+    */
+    qFP16_t qFP16_Sqrt_Ctx( const qFP16_Settings_t * const ctx,
+                            qFP16_t x );
+
     /**
     * @brief Returns the fixed-point value of e raised to the xth power.
     * @param[in] x The fixed-point(q16.16) value.
@@ -243,6 +476,16 @@ extern "C" {
     */
     qFP16_t qFP16_Exp( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Exp(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return Same as qFP16_Exp().
+    */
+    qFP16_t qFP16_Exp_Ctx( const qFP16_Settings_t * const ctx,
+                           qFP16_t x );
+
     /**
     * @brief Returns the fixed-point natural logarithm (base-e logarithm) of @a x.
     * @param[in] x The fixed-point(q16.16) value.
@@ -251,6 +494,16 @@ extern "C" {
     */
     qFP16_t qFP16_Log( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Log(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return Same as qFP16_Log().
+    */
+    qFP16_t qFP16_Log_Ctx( const qFP16_Settings_t * const ctx,
+                           qFP16_t x );
+
     /**
     * @brief Returns the fixed-point log base 2 of @a x.
     * @param[in] x The fixed-point(q16.16) value.
@@ -259,6 +512,16 @@ extern "C" {
     */
     qFP16_t qFP16_Log2( const qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Log2(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return Same as qFP16_Log2().
+    */
+    qFP16_t qFP16_Log2_Ctx( const qFP16_Settings_t * const ctx,
+                            const qFP16_t x );
+
     /**
     * @brief Converts angle units from radians to degrees.
     * @param[in] x The fixed-point(q16.16) value representing an angle expressed
@@ -267,6 +530,17 @@ extern "C" {
     */
     qFP16_t qFP16_RadToDeg( const qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_RadToDeg(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value representing an angle expressed
+    * in radians.
+    * @return Same as qFP16_RadToDeg().
+    */
+    qFP16_t qFP16_RadToDeg_Ctx( const qFP16_Settings_t * const ctx,
+                                const qFP16_t x );
+
     /**
     * @brief Converts angle units from degrees to radians.
     * @param[in] x The fixed-point(q16.16) value representing an angle expressed
@@ -275,6 +549,17 @@ extern "C" {
     */
     qFP16_t qFP16_DegToRad( const qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_DegToRad(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value representing an angle expressed
+    * in degrees.
+    * @return Same as qFP16_DegToRad().
+    */
+    qFP16_t qFP16_DegToRad_Ctx( const qFP16_Settings_t * const ctx,
+                                const qFP16_t x );
+
     /**
     * @brief Wrap the fixed-point angle in radians to [−pi pi]
     * @param[in] x The fixed-point(q16.16) value representing an angle expressed
@@ -301,6 +586,17 @@ extern "C" {
     */
     qFP16_t qFP16_Sin( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Sin(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value representing an angle expressed
+    * in radians.
+    * @return Same as qFP16_Sin().
+    */
+    qFP16_t qFP16_Sin_Ctx( const qFP16_Settings_t * const ctx,
+                           qFP16_t x );
+
     /**
     * @brief Computes the fixed-point cosine of the radian angle @a x.
     * @param[in] x The fixed-point(q16.16) value representing an angle expressed
@@ -309,6 +605,17 @@ extern "C" {
     */
     qFP16_t qFP16_Cos( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Cos(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value representing an angle expressed
+    * in radians.
+    * @return Same as qFP16_Cos().
+    */
+    qFP16_t qFP16_Cos_Ctx( const qFP16_Settings_t * const ctx,
+                           qFP16_t x );
+
     /**
     * @brief Computes the fixed-point tangent  of the radian angle @a x.
     * @param[in] x The fixed-point(q16.16) value representing an angle expressed
@@ -317,6 +624,17 @@ extern "C" {
     */
     qFP16_t qFP16_Tan( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Tan(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value representing an angle expressed
+    * in radians.
+    * @return Same as qFP16_Tan().
+    */
+    qFP16_t qFP16_Tan_Ctx( const qFP16_Settings_t * const ctx,
+                           qFP16_t x );
+
     /**
     * @brief Computes the fixed-point arc tangent in radians of @a y / @a x
     * based on the signs of both values to determine the correct quadrant.
@@ -328,6 +646,61 @@ extern "C" {
     qFP16_t qFP16_Atan2( const qFP16_t y,
                          const qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Atan2(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] y The fixed-point(q16.16) value representing an x-coordinate.
+    * @param[in] x The fixed-point(q16.16) value representing an y-coordinate.
+    * @return Same as qFP16_Atan2().
+    */
+    qFP16_t qFP16_Atan2_Ctx( const qFP16_Settings_t * const ctx,
+                             const qFP16_t y,
+                             const qFP16_t x );
+
+    /**
+    * @brief Computes both the fixed-point sine and cosine of the radian angle
+    * @a x in a single pass of the CORDIC engine. The angle is reduced to
+    * [-pi,+pi] with two 64-bit multiplications and the iterations use only
+    * shifts and additions. The results are within 0.62 units of the last place
+    * for any @a x.
+    * @param[in] x The fixed-point(q16.16) value representing an angle expressed
+    * in radians.
+    * @param[out] s Where the sine of @a x will be stored. To ignore pass
+    * @c NULL.
+    * @param[out] c Where the cosine of @a x will be stored. To ignore pass
+    * @c NULL.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qFP16_CordicSinCos( const qFP16_t x,
+                            qFP16_t * const s,
+                            qFP16_t * const c );
+
+    /**
+    * @brief Computes the fixed-point arc tangent in radians of @a y / @a x and
+    * the magnitude of the vector ( @a x, @a y ) in a single pass of the
+    * CORDIC engine.
+    * @param[in] y The fixed-point(q16.16) value representing an y-coordinate.
+    * @param[in] x The fixed-point(q16.16) value representing an x-coordinate.
+    * @param[out] mag Where the magnitude <tt>sqrt( x^2 + y^2 )</tt> will be
+    * stored, or @c qFP16.overflow if it can not be represented. With 16 or
+    * more iterations it is correctly rounded. To ignore pass @c NULL.
+    * @return This function returns the principal arc tangent of y/x, in the
+    * interval [-pi,+pi] radians.
+    */
+    qFP16_t qFP16_CordicAtan2( const qFP16_t y,
+                               const qFP16_t x,
+                               qFP16_t * const mag );
+
+    /**
+    * @brief Returns the fixed-point square root of @a x computed by the
+    * hyperbolic CORDIC engine, using only shifts and additions.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return This function returns the square root of @a x. For negative
+    * numbers, returns @c qFP16.overflow .
+    */
+    qFP16_t qFP16_CordicSqrt( const qFP16_t x );
+
     /**
     * @brief Computes the fixed-point arc tangent of @a x in radians.
     * @param[in] x The fixed-point(q16.16) value representing an angle expressed
@@ -336,6 +709,17 @@ extern "C" {
     */
     qFP16_t qFP16_Atan( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Atan(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value representing an angle expressed
+    * in radians.
+    * @return Same as qFP16_Atan().
+    */
+    qFP16_t qFP16_Atan_Ctx( const qFP16_Settings_t * const ctx,
+                            qFP16_t x );
+
     /**
     * @brief Computes the fixed-point arc sine of @a x in radians.
     * @param[in] x The fixed-point(q16.16) value representing an angle expressed
@@ -344,6 +728,17 @@ extern "C" {
     */
     qFP16_t qFP16_Asin( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Asin(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value representing an angle expressed
+    * in radians.
+    * @return Same as qFP16_Asin().
+    */
+    qFP16_t qFP16_Asin_Ctx( const qFP16_Settings_t * const ctx,
+                            qFP16_t x );
+
     /**
     * @brief Computes the fixed-point arc cosine of @a x in radians.
     * @param[in] x The fixed-point(q16.16) value representing an angle expressed
@@ -352,6 +747,17 @@ extern "C" {
     */
     qFP16_t qFP16_Acos( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Acos(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value representing an angle expressed
+    * in radians.
+    * @return Same as qFP16_Acos().
+    */
+    qFP16_t qFP16_Acos_Ctx( const qFP16_Settings_t * const ctx,
+                            qFP16_t x );
+
     /**
     * @brief Computes the fixed-point hyperbolic cosine of @a x.
     * @param[in] x The fixed-point(q16.16) value.
@@ -361,6 +767,16 @@ extern "C" {
     */
     qFP16_t qFP16_Cosh( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Cosh(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return Same as qFP16_Cosh().
+    */
+    qFP16_t qFP16_Cosh_Ctx( const qFP16_Settings_t * const ctx,
+                            qFP16_t x );
+
     /**
     * @brief Computes the fixed-point hyperbolic sine of @a x.
     * @param[in] x The fixed-point(q16.16) value.
@@ -370,6 +786,16 @@ extern "C" {
     */
     qFP16_t qFP16_Sinh( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Sinh(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return Same as qFP16_Sinh().
+    */
+    qFP16_t qFP16_Sinh_Ctx( const qFP16_Settings_t * const ctx,
+                            qFP16_t x );
+
     /**
     * @brief Computes the fixed-point hyperbolic tangent  of @a x.
     * @param[in] x The fixed-point(q16.16) value.
@@ -379,6 +805,16 @@ extern "C" {
     */
     qFP16_t qFP16_Tanh( qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Tanh(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) value.
+    * @return Same as qFP16_Tanh().
+    */
+    qFP16_t qFP16_Tanh_Ctx( const qFP16_Settings_t * const ctx,
+                            qFP16_t x );
+
     /**
     * @brief Evaluates the fixed-point polynomial @a p at the point @a x. The
     * argument @a p is a vector of length n+1 whose elements are the coefficients
@@ -394,6 +830,21 @@ extern "C" {
                            const size_t n,
                            const qFP16_t x );
 
+    /**
+    * @brief Same as qFP16_Polyval(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] p Polynomial coefficients, specified as a fixed-point(q16.16)
+    * array.
+    * @param[in] n The number of elements of the fixed-point array @a p.
+    * @param[in] x The fixed-point(q16.16) value to evaluate the polynomial.
+    * @return Same as qFP16_Polyval().
+    */
+    qFP16_t qFP16_Polyval_Ctx( const qFP16_Settings_t * const ctx,
+                               const qFP16_t * const p,
+                               const size_t n,
+                               const qFP16_t x );
+
     /**
     * @brief Returns @a x raised to the power of the integer part of @a y. (x^y)
     * @param[in] x The fixed-point(q16.16) base value.
@@ -405,6 +856,19 @@ extern "C" {
     qFP16_t qFP16_IPow( const qFP16_t x,
                         const qFP16_t y );
 
+    /**
+    * @brief Same as qFP16_IPow(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) base value.
+    * @param[in] y The fixed-point(q16.16) power value. Only the integer part is
+    * taken
+    * @return Same as qFP16_IPow().
+    */
+    qFP16_t qFP16_IPow_Ctx( const qFP16_Settings_t * const ctx,
+                            const qFP16_t x,
+                            const qFP16_t y );
+
     /**
     * @brief Returns @a x raised to the power of @a y. (x^y)
     * @param[in] x The fixed-point(q16.16) base value.
@@ -415,6 +879,211 @@ extern "C" {
     qFP16_t qFP16_Pow( const qFP16_t x,
                        const qFP16_t y );
 
+    /**
+    * @brief Same as qFP16_Pow(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x The fixed-point(q16.16) base value.
+    * @param[in] y The fixed-point(q16.16) power value.
+    * @return Same as qFP16_Pow().
+    */
+    qFP16_t qFP16_Pow_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t x,
+                           const qFP16_t y );
+
+    /**
+    * @brief Computes the element-wise addition of the fixed-point arrays
+    * @a x and @a y : <tt>dst[i] = x[i] + y[i]</tt>.
+    * @note The result is the same as calling qFP16_Add() on each element.
+    * @a dst can be the same array as @a x or @a y.
+    * @param[out] dst The array where the result will be stored.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return A pointer to @a dst. If any of the arrays is @c NULL, returns
+    * @c NULL.
+    */
+    qFP16_t* qFP16_ArrayAdd( qFP16_t * const dst,
+                             const qFP16_t * const x,
+                             const qFP16_t * const y,
+                             const size_t n );
+
+    /**
+    * @brief Same as qFP16_ArrayAdd(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[out] dst The array where the result will be stored.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return Same as qFP16_ArrayAdd().
+    */
+    qFP16_t* qFP16_ArrayAdd_Ctx( const qFP16_Settings_t * const ctx,
+                                 qFP16_t * const dst,
+                                 const qFP16_t * const x,
+                                 const qFP16_t * const y,
+                                 const size_t n );
+
+    /**
+    * @brief Computes the element-wise subtraction of the fixed-point arrays
+    * @a x and @a y : <tt>dst[i] = x[i] - y[i]</tt>.
+    * @note The result is the same as calling qFP16_Sub() on each element.
+    * @a dst can be the same array as @a x or @a y.
+    * @param[out] dst The array where the result will be stored.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return A pointer to @a dst. If any of the arrays is @c NULL, returns
+    * @c NULL.
+    */
+    qFP16_t* qFP16_ArraySub( qFP16_t * const dst,
+                             const qFP16_t * const x,
+                             const qFP16_t * const y,
+                             const size_t n );
+
+    /**
+    * @brief Same as qFP16_ArraySub(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[out] dst The array where the result will be stored.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return Same as qFP16_ArraySub().
+    */
+    qFP16_t* qFP16_ArraySub_Ctx( const qFP16_Settings_t * const ctx,
+                                 qFP16_t * const dst,
+                                 const qFP16_t * const x,
+                                 const qFP16_t * const y,
+                                 const size_t n );
+
+    /**
+    * @brief Computes the element-wise product of the fixed-point arrays
+    * @a x and @a y : <tt>dst[i] = x[i]*y[i]</tt>.
+    * @note The result is the same as calling qFP16_Mul() on each element.
+    * @a dst can be the same array as @a x or @a y.
+    * @param[out] dst The array where the result will be stored.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return A pointer to @a dst. If any of the arrays is @c NULL, returns
+    * @c NULL.
+    */
+    qFP16_t* qFP16_ArrayMul( qFP16_t * const dst,
+                             const qFP16_t * const x,
+                             const qFP16_t * const y,
+                             const size_t n );
+
+    /**
+    * @brief Same as qFP16_ArrayMul(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[out] dst The array where the result will be stored.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return Same as qFP16_ArrayMul().
+    */
+    qFP16_t* qFP16_ArrayMul_Ctx( const qFP16_Settings_t * const ctx,
+                                 qFP16_t * const dst,
+                                 const qFP16_t * const x,
+                                 const qFP16_t * const y,
+                                 const size_t n );
+
+    /**
+    * @brief Computes the element-wise product of the fixed-point arrays
+    * @a x and @a y and accumulates it on @a dst :
+    * <tt>dst[i] = dst[i] + x[i]*y[i]</tt>.
+    * @note The result is the same as calling qFP16_Mul() and then qFP16_Add()
+    * on each element. @a dst can be the same array as @a x or @a y.
+    * @param[in,out] dst The accumulator array.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return A pointer to @a dst. If any of the arrays is @c NULL, returns
+    * @c NULL.
+    */
+    qFP16_t* qFP16_ArrayMAC( qFP16_t * const dst,
+                             const qFP16_t * const x,
+                             const qFP16_t * const y,
+                             const size_t n );
+
+    /**
+    * @brief Same as qFP16_ArrayMAC(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in,out] dst The accumulator array.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return Same as qFP16_ArrayMAC().
+    */
+    qFP16_t* qFP16_ArrayMAC_Ctx( const qFP16_Settings_t * const ctx,
+                                 qFP16_t * const dst,
+                                 const qFP16_t * const x,
+                                 const qFP16_t * const y,
+                                 const size_t n );
+
+    /**
+    * @brief Scales the fixed-point array @a x : <tt>dst[i] = k*x[i]</tt>.
+    * @note The result is the same as calling qFP16_Mul() on each element.
+    * @a dst can be the same array as @a x.
+    * @param[out] dst The array where the result will be stored.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] k The fixed-point(q16.16) scale factor.
+    * @param[in] n The number of elements of the arrays.
+    * @return A pointer to @a dst. If any of the arrays is @c NULL, returns
+    * @c NULL.
+    */
+    qFP16_t* qFP16_ArrayScale( qFP16_t * const dst,
+                               const qFP16_t * const x,
+                               const qFP16_t k,
+                               const size_t n );
+
+    /**
+    * @brief Same as qFP16_ArrayScale(), but using the settings pointed by
+    * @a ctx instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[out] dst The array where the result will be stored.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] k The fixed-point(q16.16) scale factor.
+    * @param[in] n The number of elements of the arrays.
+    * @return Same as qFP16_ArrayScale().
+    */
+    qFP16_t* qFP16_ArrayScale_Ctx( const qFP16_Settings_t * const ctx,
+                                   qFP16_t * const dst,
+                                   const qFP16_t * const x,
+                                   const qFP16_t k,
+                                   const size_t n );
+
+    /**
+    * @brief Computes the dot product of the fixed-point arrays @a x and @a y.
+    * @note The result is the same as accumulating, from the first element,
+    * with qFP16_Add() the products obtained with qFP16_Mul().
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return This function returns the dot product of @a x and @a y. If any
+    * of the arrays is @c NULL, returns zero.
+    */
+    qFP16_t qFP16_ArrayDot( const qFP16_t * const x,
+                            const qFP16_t * const y,
+                            const size_t n );
+
+    /**
+    * @brief Same as qFP16_ArrayDot(), but using the settings pointed by
+    * @a ctx instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] y A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the arrays.
+    * @return Same as qFP16_ArrayDot().
+    */
+    qFP16_t qFP16_ArrayDot_Ctx( const qFP16_Settings_t * const ctx,
+                                const qFP16_t * const x,
+                                const qFP16_t * const y,
+                                const size_t n );
+
     /**
     * @brief Converts the fixed-point value to a formatted string.
     * @param[in] num The fixed-point(q16.16) value to be converted to string.
@@ -429,6 +1098,21 @@ extern "C" {
                        char *str,
                        int decimals );
 
+    /**
+    * @brief Same as qFP16_FPToA(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] num The fixed-point(q16.16) value to be converted to string.
+    * @param[in] str Array in memory where to store the resulting null-terminated
+    * string.
+    * @param[in] decimals Number of decimals to show in the string representation.
+    * @return Same as qFP16_FPToA().
+    */
+    char* qFP16_FPToA_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t num,
+                           char *str,
+                           int decimals );
+
     /**
     * @brief Parses the C string @a s, interpreting its content as a fixed-point
     * (q16.16) number and returns its value as a qFP16_t. The function first
@@ -448,6 +1132,115 @@ extern "C" {
     */
     qFP16_t qFP16_AToFP( const char *s );
 
+    /**
+    * @brief Same as qFP16_AToFP(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] s The string beginning with the representation of a
+    * floating-point number.
+    * @return Same as qFP16_AToFP().
+    */
+    qFP16_t qFP16_AToFP_Ctx( const qFP16_Settings_t * const ctx,
+                             const char *s );
+
+    /**
+    * @brief Formats the fixed-point array @a x as text into the buffer @a str,
+    * writing the values one after another separated by the @a delim
+    * character. Each value is formatted exactly as qFP16_FPToA() does, but
+    * the settings and the number of decimals are resolved only once per call
+    * and the digits are emitted in pairs from a precomputed table.
+    * @note The output never ends with a partial value. If the next value does
+    * not fit in the remaining space, the conversion stops and the buffer is
+    * terminated after the last complete value. Each value takes at most
+    * 13 characters including its delimiter.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the array.
+    * @param[out] str Array in memory where to store the resulting
+    * null-terminated string.
+    * @param[in] size The size in bytes of @a str.
+    * @param[in] decimals Number of decimals to show in the string representation.
+    * @note: Max decimal allowed = 5
+    * @param[in] delim The character used to separate the values, for example
+    * <tt>','</tt> or <tt>'\n'</tt>.
+    * @return The number of characters written to @a str, not including the
+    * terminating null character. If the arguments are not valid or @a size is
+    * zero, nothing is written and zero is returned.
+    */
+    size_t qFP16_ArrayToA( const qFP16_t * const x,
+                           const size_t n,
+                           char * const str,
+                           const size_t size,
+                           int decimals,
+                           const char delim );
+
+    /**
+    * @brief Same as qFP16_ArrayToA(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] x A fixed-point(q16.16) array.
+    * @param[in] n The number of elements of the array.
+    * @param[out] str Array in memory where to store the resulting
+    * null-terminated string.
+    * @param[in] size The size in bytes of @a str.
+    * @param[in] decimals Number of decimals to show in the string representation.
+    * @param[in] delim The character used to separate the values.
+    * @return Same as qFP16_ArrayToA().
+    */
+    size_t qFP16_ArrayToA_Ctx( const qFP16_Settings_t * const ctx,
+                               const qFP16_t * const x,
+                               const size_t n,
+                               char * const str,
+                               const size_t size,
+                               int decimals,
+                               const char delim );
+
+    /**
+    * @brief Parses a text buffer holding fixed-point numbers separated by the
+    * @a delim character and stores them in the array @a x in a single pass.
+    * Whitespace around each value is discarded and each value is interpreted
+    * as in qFP16_AToFP(), giving the same result for up to nine fractional
+    * digits. Further digits are ignored, while qFP16_AToFP() overflows its
+    * scale with them. Values whose integer part is out of range, and the
+    * text @c "overflow" that qFP16_FPToA() and qFP16_ArrayToA() write for
+    * it, are stored as @c qFP16.overflow and the parsing continues with the
+    * next one.
+    * @note The parsing stops at the end of the string, once @a n values have
+    * been stored, at the first field that is not a number, or after a value
+    * that is not followed by a delimiter.
+    * @param[in] s The null-terminated string to parse.
+    * @param[out] x The array where the parsed values are stored.
+    * @param[in] n The maximum number of values to store in @a x.
+    * @param[in] delim The character that separates the values. It should not
+    * be a digit, a sign or a point.
+    * @param[out] end If not @c NULL, receives a pointer to the first character
+    * in @a s that was not consumed, so a stream can be resumed from there.
+    * @return The number of values stored in @a x.
+    */
+    size_t qFP16_AToArray( const char *s,
+                           qFP16_t * const x,
+                           const size_t n,
+                           const char delim,
+                           const char ** const end );
+
+    /**
+    * @brief Same as qFP16_AToArray(), but using the settings pointed by @a ctx
+    * instead of the ones selected with qFP16_SettingsSelect().
+    * @param[in] ctx A pointer to the fixed-point settings instance.
+    * @param[in] s The null-terminated string to parse.
+    * @param[out] x The array where the parsed values are stored.
+    * @param[in] n The maximum number of values to store in @a x.
+    * @param[in] delim The character that separates the values.
+    * @param[out] end If not @c NULL, receives a pointer to the first character
+    * in @a s that was not consumed.
+    * @return Same as qFP16_AToArray().
+    */
+    size_t qFP16_AToArray_Ctx( const qFP16_Settings_t * const ctx,
+                               const char *s,
+                               qFP16_t * const x,
+                               const size_t n,
+                               const char delim,
+                               const char ** const end );
+
     /** @}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,133 @@
+/*!
+ * @file qfpq.h
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Fixed-Point math for the Q15, Q31 and Q8.24 formats with rounding
+ * and saturated arithmetic.
+ **/
+
+#ifndef QFPQ_H
+#define QFPQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include "qfp16.h"
+
+    /** @addtogroup qfpq Q-format fixed-point math
+    * @brief API for the Q15, Q31 and Q8.24 fixed-point formats
+    *  @{
+    */
+
+    /**  @brief Fixed-point Q15 (Q0.15) type with width of exactly 16 bits.
+    * Range [ -1, 1 ).*/
+    typedef int16_t qQ15_t;
+
+    /**  @brief Fixed-point Q31 (Q0.31) type with width of exactly 32 bits.
+    * Range [ -1, 1 ).*/
+    typedef int32_t qQ31_t;
+
+    /**  @brief Fixed-point Q8.24 type with width of exactly 32 bits.
+    * Range [ -128, 128 ).*/
+    typedef int32_t qQ8_24_t;
+
+    /**
+    * @brief A macro for defining a Q15 fixed-point constant value.
+    * @note You should only use this for constant values. For runtime-conversions
+    * use qQ15_FloatToQ() or qQ15_DoubleToQ() instead.
+    * @param[in] x A literal value
+    * @return The literal argument @a x converted to qQ15_t.
+    */
+    #define qQ15_Constant(x)                                                \
+    ( (qQ15_t)( ( (x) >= 0 ) ? ( (x) * 32768.0 + 0.5 )                      \
+                             : ( (x) * 32768.0 - 0.5 ) ) )                  \
+
+    /**
+    * @brief A macro for defining a Q31 fixed-point constant value.
+    * @note You should only use this for constant values. For runtime-conversions
+    * use qQ31_FloatToQ() or qQ31_DoubleToQ() instead.
+    * @param[in] x A literal value
+    * @return The literal argument @a x converted to qQ31_t.
+    */
+    #define qQ31_Constant(x)                                                \
+    ( (qQ31_t)( ( (x) >= 0 ) ? ( (x) * 2147483648.0 + 0.5 )                 \
+                             : ( (x) * 2147483648.0 - 0.5 ) ) )             \
+
+    /**
+    * @brief A macro for defining a Q8.24 fixed-point constant value.
+    * @note You should only use this for constant values. For runtime-conversions
+    * use qQ8_24_FloatToQ() or qQ8_24_DoubleToQ() instead.
+    * @param[in] x A literal value
+    * @return The literal argument @a x converted to qQ8_24_t.
+    */
+    #define qQ8_24_Constant(x)                                              \
+    ( (qQ8_24_t)( ( (x) >= 0 ) ? ( (x) * 16777216.0 + 0.5 )                 \
+                               : ( (x) * 16777216.0 - 0.5 ) ) )             \
+
+    /**
+    * @brief Declares the API of a Q-format. For a format @c Q with type
+    * @c Q_t, the following functions are provided :
+    *
+    * - <tt>Q_t Q_FloatToQ( const float x )</tt> : Converts a float value.
+    * - <tt>float Q_QToFloat( const Q_t x )</tt> : Converts to float.
+    * - <tt>Q_t Q_DoubleToQ( const double x )</tt> : Converts a double value.
+    * - <tt>double Q_QToDouble( const Q_t x )</tt> : Converts to double.
+    * - <tt>Q_t Q_FP16ToQ( const qFP16_t x )</tt> : Converts a Q16.16 value.
+    * - <tt>qFP16_t Q_QToFP16( const Q_t x )</tt> : Converts to Q16.16.
+    * - <tt>Q_t Q_Abs( const Q_t x )</tt> : Absolute value.
+    * - <tt>Q_t Q_Add( const Q_t x, const Q_t y )</tt> : Addition.
+    * - <tt>Q_t Q_Sub( const Q_t x, const Q_t y )</tt> : Subtraction.
+    * - <tt>Q_t Q_Mul( const Q_t x, const Q_t y )</tt> : Multiplication.
+    * - <tt>Q_t Q_Div( const Q_t x, const Q_t y )</tt> : Division. When @a y
+    * is zero, returns the limit of the range with the sign of @a x.
+    * - <tt>Q_t Q_Sqrt( const Q_t x )</tt> : Square root. For negative
+    * values returns zero.
+    * - <tt>Q_t Q_Exp( const Q_t x )</tt> : Exponential.
+    * - <tt>Q_t Q_Log( const Q_t x )</tt> : Natural logarithm. For values
+    * not greater than zero returns the lower limit of the range.
+    * - <tt>Q_t Q_Sin( const Q_t x )</tt> : Sine of an angle in radians.
+    * - <tt>Q_t Q_Cos( const Q_t x )</tt> : Cosine of an angle in radians.
+    * - <tt>Q_t Q_Atan2( const Q_t y, const Q_t x )</tt> : Four-quadrant arc
+    * tangent in radians.
+    *
+    * All the operations round to the nearest value and saturate to the range
+    * of the format, so no overflow marker is used. Results that can not be
+    * represented, such as <tt>Q15_Atan2()</tt> beyond one radian, saturate.
+    * @param[in] Q The prefix of the format
+    */
+    #define QFPQ_DECLARE( Q )                                               \
+    Q##_t Q##_FloatToQ( const float x );                                    \
+    float Q##_QToFloat( const Q##_t x );                                    \
+    Q##_t Q##_DoubleToQ( const double x );                                  \
+    double Q##_QToDouble( const Q##_t x );                                  \
+    Q##_t Q##_FP16ToQ( const qFP16_t x );                                   \
+    qFP16_t Q##_QToFP16( const Q##_t x );                                   \
+    Q##_t Q##_Abs( const Q##_t x );                                         \
+    Q##_t Q##_Add( const Q##_t x, const Q##_t y );                          \
+    Q##_t Q##_Sub( const Q##_t x, const Q##_t y );                          \
+    Q##_t Q##_Mul( const Q##_t x, const Q##_t y );                          \
+    Q##_t Q##_Div( const Q##_t x, const Q##_t y );                          \
+    Q##_t Q##_Sqrt( const Q##_t x );                                        \
+    Q##_t Q##_Exp( const Q##_t x );                                         \
+    Q##_t Q##_Log( const Q##_t x );                                         \
+    Q##_t Q##_Sin( const Q##_t x );                                         \
+    Q##_t Q##_Cos( const Q##_t x );                                         \
+    Q##_t Q##_Atan2( const Q##_t y, const Q##_t x )                         \
+
+    /*! @cond  */
+    QFPQ_DECLARE( qQ15 );
+    QFPQ_DECLARE( qQ31 );
+    QFPQ_DECLARE( qQ8_24 );
+    /*! @endcond  */
+
+    /** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
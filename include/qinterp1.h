@@ -40,6 +40,19 @@ extern "C" {
     } qInterp1Method_t;
 
 
+    /**
+    * @brief The state of a segment lookup over a table of x points. It keeps
+    * the segment of the last lookup and the inverse step of equally spaced
+    * tables.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct {
+        /*! @cond  */
+        size_t index;
+        float invStep;
+        /*! @endcond  */
+    } qInterp1Segment_t;
+
     /**
     * @brief A 1D interpolation object.
     */
@@ -48,15 +61,33 @@ extern "C" {
         float (*method)( const float x,
                          const float * const tx,
                          const float * const ty,
-                         const size_t tableSize );
+                         const size_t tableSize,
+                         qInterp1Segment_t * const hint );
         const float *xData;
         const float *yData;
         size_t dataSize;
+        qInterp1Segment_t segment;
+        float *coeff;
+        size_t coeffSize;
+        size_t inverseSegment;
+        qInterp1Method_t mode;
+        uint8_t coeffReady;
+        int8_t monotonic;
         /*! @endcond  */
     } qInterp1_t;
 
     /**
-    * @brief Setup and initialize the 1D interpolation instance.
+    * @brief The number of elements required by the coefficient buffer of a
+    * table with @a n points. See qInterp1_SetCoeffBuffer().
+    * @param[in] n The number of points of the table.
+    */
+    #define QINTERP1_COEFF_SIZE( n )    ( 4U*( (size_t)(n) - 1U ) )
+
+    /**
+    * @brief Setup and initialize the 1D interpolation instance. If the x
+    * points are equally spaced, this is detected here and the segment lookup
+    * is resolved by direct indexing. The y points are also checked here to
+    * enable qInterp1_GetInverse() on monotonic tables.
     * @param[in] i A pointer to the interpolation instance.
     * @param[in] xTable An array of size @a sizeTable with the x points sorted in ascending order.
     * @param[in] yTable An array of size @a sizeTable with the y points.
@@ -69,7 +100,11 @@ extern "C" {
                          const size_t sizeTable );
 
     /**
-    * @brief Set the data table for the 1D interpolation instance.
+    * @brief Set the data table for the 1D interpolation instance. The current
+    * method and coefficient buffer are kept, the coefficients are
+    * recomputed and the spacing of the x points and the monotonicity of the
+    * y points are checked again for the new table.
+    * @pre Instance must be previously initialized with qInterp1_Setup().
     * @param[in] i A pointer to the interpolation instance.
     * @param[in] xTable An array of size @a sizeTable with the x points sorted in ascending order.
     * @param[in] yTable An array of size @a sizeTable with the y points.
@@ -90,11 +125,40 @@ extern "C" {
     int qInterp1_SetMethod( qInterp1_t * const i,
                             const qInterp1Method_t m );
 
+    /**
+    * @brief Set a buffer where the interpolation coefficients are stored.
+    * When a buffer is provided, the cubic, Hermite, spline and constrained
+    * spline methods compute the polynomial of every segment once, when the
+    * data or the method are set, so each query only takes the segment lookup
+    * and the evaluation of a cubic polynomial. For the Hermite method, the
+    * buffer holds the weights of the barycentric form and each query takes a
+    * single pass over the table.
+    * @note The buffer is not used by the other methods. If the buffer is too
+    * small for the current table, the coefficients are computed on every
+    * query as if no buffer was provided.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] c A buffer with at least QINTERP1_COEFF_SIZE( n ) elements,
+    * where @c n is the number of points of the table. Pass @c NULL to stop
+    * using the buffer.
+    * @param[in] size The number of elements of @a c.
+    * @return 1 if the coefficients are in use for the current method,
+    * otherwise return 0.
+    */
+    int qInterp1_SetCoeffBuffer( qInterp1_t * const i,
+                                 float * const c,
+                                 const size_t size );
+
 
     /**
     * @brief Interpolate input point @a x to determine the value of @a y
     * at the points @a xi using the current method. If value is beyond
     * the endpoints, extrapolation is performed using the current method.
+    * @note The interval that contains @a x is found with a binary search, so
+    * the cost grows with the logarithm of the table size. The interval of the
+    * last call is checked first, so slowly varying inputs, such as the ones
+    * of a control loop, are found in constant time. When the x points of the
+    * table are equally spaced, the interval is computed directly from @a x
+    * and the lookup always takes constant time.
     * @param[in] i A pointer to the interpolation instance.
     * @param[in] x The input point.
     * @return The interpolated-extrapolated @a y value.
@@ -102,6 +166,75 @@ extern "C" {
     float qInterp1_Get( qInterp1_t * const i,
                         const float x );
 
+    /**
+    * @brief Setup a segment lookup over the table @a tx. This is the lookup
+    * used internally by qInterp1 and it's provided for classes that need to
+    * locate points in their own tables, such as \ref qinterpn.
+    * @param[in] s A pointer to the segment lookup instance.
+    * @param[in] tx An array of size @a n with the x points sorted in ascending order.
+    * @param[in] n The number of points in @a tx.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qInterp1_SegmentSetup( qInterp1Segment_t * const s,
+                               const float * const tx,
+                               const size_t n );
+
+    /**
+    * @brief Find the segment of the table @a tx that contains the point @a x,
+    * that is, the index @c k that satisfies @c tx[k] <= x < tx[k+1]. Points
+    * beyond the endpoints are assigned to the first or the last segment.
+    * @pre Instance must be previously initialized with
+    * qInterp1_SegmentSetup() for the same table.
+    * @param[in] s A pointer to the segment lookup instance.
+    * @param[in] tx An array of size @a n with the x points sorted in ascending order.
+    * @param[in] n The number of points in @a tx.
+    * @param[in] x The point to locate.
+    * @return The segment index in the range [ 0, n - 2 ].
+    */
+    size_t qInterp1_SegmentFind( qInterp1Segment_t * const s,
+                                 const float * const tx,
+                                 const size_t n,
+                                 const float x );
+
+    /**
+    * @brief Find the input point @a x at which the interpolation takes the
+    * value @a y using the current method, that is, the inverse of
+    * qInterp1_Get(). This is only available when the y points of the table
+    * are strictly increasing or strictly decreasing.
+    * @note The interval that contains @a y is found with a binary search on
+    * the y points, starting from the interval of the previous call. The
+    * linear method is inverted in closed form, the sine and polynomial
+    * methods are solved iteratively inside that interval, starting from the
+    * linear inverse, and the step methods are inverted as linear. If @a y is
+    * beyond the endpoints, the first or the last interval is inverted as
+    * linear.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] y The output value.
+    * @return The input point @a x. If the y points are not monotonic, @c NaN
+    * is returned.
+    */
+    float qInterp1_GetInverse( qInterp1_t * const i,
+                               const float y );
+
+    /**
+    * @brief Interpolate all the points of the array @a xq and store the
+    * results in @a yq using the current method. This is equivalent to
+    * calling qInterp1_Get() for each point, but runs of ascending points are
+    * resolved by walking the table forward, so resampling a sorted trace
+    * costs a single pass over the table and the queries. Unsorted points
+    * fall back to the search of qInterp1_Get().
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] xq An array of @a n input points.
+    * @param[out] yq An array of @a n elements where the interpolated values
+    * will be stored.
+    * @param[in] n The number of points in @a xq and @a yq.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qInterp1_GetArray( qInterp1_t * const i,
+                           const float * const xq,
+                           float * const yq,
+                           const size_t n );
+
     /** @}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,131 @@
+/*!
+ * @file qinterp1fp16.h
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Fixed-point Q16.16 one-dimensional interpolation over qFP16 and
+ * int16 tables
+ **/
+
+#ifndef QINTERP1FP16_H
+#define QINTERP1FP16_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #include <stdlib.h>
+    #include <stdint.h>
+    #include "qinterp1.h"
+    #include "qfp16.h"
+
+    /** @addtogroup qinterp1
+    *  @{
+    */
+
+    /*! @cond  */
+    typedef struct
+    {
+        const qFP16_t *fp;
+        const int16_t *raw;
+        qFP16_t scale, offset;
+    } qInterp1FP16_Table_t;
+    /*! @endcond  */
+
+    /**
+    * @brief A fixed-point 1D interpolation object.
+    * @details The instance should be initialized using the qInterp1FP16_Setup()
+    * or the qInterp1FP16_SetupInt16() API.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct _qInterp1FP16_s //skipcq: CXX-E2000
+    {
+        /*! @cond  */
+        qFP16_t (*method)( struct _qInterp1FP16_s * const i,
+                           const qFP16_t x );
+        qInterp1FP16_Table_t xData;
+        qInterp1FP16_Table_t yData;
+        size_t dataSize;
+        size_t segment;
+        /*! @endcond  */
+    } qInterp1FP16_t;
+
+    /**
+    * @brief Setup and initialize the fixed-point 1D interpolation instance
+    * over tables of qFP16_t values.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] xTable An array of size @a sizeTable with the x points sorted in ascending order.
+    * @param[in] yTable An array of size @a sizeTable with the y points.
+    * @param[in] sizeTable The number of points in @a xTable @a yTable
+    * @return 1 on success, otherwise return 0.
+    */
+    int qInterp1FP16_Setup( qInterp1FP16_t * const i,
+                            const qFP16_t * const xTable,
+                            const qFP16_t * const yTable,
+                            const size_t sizeTable );
+
+    /**
+    * @brief Setup and initialize the fixed-point 1D interpolation instance
+    * over tables of 16-bit integers. Each element is read as
+    * <tt>offset + raw*scale</tt>, with a unit scale and a zero offset by
+    * default. Use qInterp1FP16_SetScale() to change them.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] xTable An array of size @a sizeTable with the x points sorted in ascending order.
+    * @param[in] yTable An array of size @a sizeTable with the y points.
+    * @param[in] sizeTable The number of points in @a xTable @a yTable
+    * @return 1 on success, otherwise return 0.
+    */
+    int qInterp1FP16_SetupInt16( qInterp1FP16_t * const i,
+                                 const int16_t * const xTable,
+                                 const int16_t * const yTable,
+                                 const size_t sizeTable );
+
+    /**
+    * @brief Set the scale and the offset used to read the elements of the
+    * 16-bit integer tables, so the element @c raw represents the value
+    * <tt>offset + raw*scale</tt>.
+    * @pre Instance must be previously initialized with qInterp1FP16_SetupInt16().
+    * @note The represented values must fit in the qFP16_t range.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] xScale The scale of the x table.
+    * @param[in] xOffset The offset of the x table.
+    * @param[in] yScale The scale of the y table.
+    * @param[in] yOffset The offset of the y table.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qInterp1FP16_SetScale( qInterp1FP16_t * const i,
+                               const qFP16_t xScale,
+                               const qFP16_t xOffset,
+                               const qFP16_t yScale,
+                               const qFP16_t yOffset );
+
+    /**
+    * @brief Specify the interpolation method to use.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] m The interpolation method.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qInterp1FP16_SetMethod( qInterp1FP16_t * const i,
+                                const qInterp1Method_t m );
+
+    /**
+    * @brief Interpolate input point @a x to determine the value of @a y
+    * at the points @a xi using the current method. If value is beyond
+    * the endpoints, extrapolation is performed using the current method.
+    * @note The operations are performed with the qFP16 API, so the result
+    * follows the settings selected with qFP16_SettingsSelect().
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] x The input point.
+    * @return The interpolated-extrapolated @a y value. If the method requires
+    * more points than the ones in the table, @c qFP16.overflow is returned.
+    */
+    qFP16_t qInterp1FP16_Get( qInterp1FP16_t * const i,
+                              const qFP16_t x );
+
+    /** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
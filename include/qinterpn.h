@@ -0,0 +1,125 @@
+/*!
+ * @file qinterpn.h
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Class for interpolation on N-dimensional gridded tables
+ **/
+
+#ifndef QINTERPN_H
+#define QINTERPN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #include <stdlib.h>
+    #include <stdint.h>
+    #include "qinterp1.h"
+
+    /** @addtogroup qinterpn qInterpN
+    * @brief N-dimensional gridded interpolation class.
+    *  @{
+    */
+
+    #ifndef QINTERPN_MAX_DIMS
+        /**
+        * @brief The maximum number of dimensions of a table. It can be
+        * overridden at compile time to reduce the size of the instances.
+        */
+        #define QINTERPN_MAX_DIMS   ( 4U )
+    #endif
+
+    /**
+    * @brief An enum with all the available N-dimensional interpolation methods.
+    */
+    typedef enum {
+        QINTERPN_LINEAR = 0,    /*!< Multilinear interpolation: bilinear on 2D tables, trilinear on 3D tables.*/
+        QINTERPN_CUBIC,         /*!< Cubic Hermite interpolation on every axis: bicubic on 2D tables, tricubic on 3D tables.*/
+        /*! @cond  */
+        QINTERPN_MAX,
+        /*! @endcond  */
+    } qInterpNMethod_t;
+
+    /**
+    * @brief An N-dimensional gridded interpolation object.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct {
+        /*! @cond  */
+        const float *data;
+        const float *axis[ QINTERPN_MAX_DIMS ];
+        size_t size[ QINTERPN_MAX_DIMS ];
+        size_t stride[ QINTERPN_MAX_DIMS ];
+        qInterp1Segment_t segment[ QINTERPN_MAX_DIMS ];
+        size_t dims;
+        qInterpNMethod_t method;
+        /*! @endcond  */
+    } qInterpN_t;
+
+    /**
+    * @brief Setup and initialize the N-dimensional interpolation instance.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] axes An array of @a dims pointers, one for each axis, to the
+    * breakpoints of that axis sorted in ascending order.
+    * @param[in] sizes An array of @a dims elements with the number of
+    * breakpoints of each axis. Each axis needs at least two breakpoints.
+    * @param[in] dims The number of dimensions of the table. Must be between
+    * 1 and ::QINTERPN_MAX_DIMS.
+    * @param[in] data The table values in row-major order, that is, the last
+    * axis varies the fastest. For a 2D table, @c data[r*sizes[1] + c] is the
+    * value at @c axes[0][r], @c axes[1][c].
+    * @return 1 on success, otherwise return 0.
+    */
+    int qInterpN_Setup( qInterpN_t * const i,
+                        const float * const * const axes,
+                        const size_t * const sizes,
+                        const size_t dims,
+                        const float * const data );
+
+    /**
+    * @brief Specify the interpolation method to use.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] m The interpolation method.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qInterpN_SetMethod( qInterpN_t * const i,
+                            const qInterpNMethod_t m );
+
+    /**
+    * @brief Interpolate the table at the point @a x using the current
+    * method. If a coordinate is beyond the endpoints of its axis,
+    * extrapolation is performed using the current method.
+    * @note Each coordinate is located with the segment lookup of
+    * \ref qinterp1, so equally spaced axes are indexed directly and the
+    * others start from the segment of the previous call.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] x An array with one coordinate for each dimension of the table.
+    * @return The interpolated-extrapolated value.
+    */
+    float qInterpN_Get( qInterpN_t * const i,
+                        const float * const x );
+
+    /**
+    * @brief Interpolate the table at all the points of the array @a xq and
+    * store the results in @a yq using the current method.
+    * @param[in] i A pointer to the interpolation instance.
+    * @param[in] xq An array of @a n points, each one given by consecutive
+    * coordinates, one for each dimension of the table.
+    * @param[out] yq An array of @a n elements where the interpolated values
+    * will be stored.
+    * @param[in] n The number of points in @a xq and @a yq.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qInterpN_GetArray( qInterpN_t * const i,
+                           const float * const xq,
+                           float * const yq,
+                           const size_t n );
+
+    /** @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -62,6 +62,30 @@ extern "C" {
         /*! @endcond  */
     } qLTISys_t;
 
+    #ifndef QLTISYS_SOS_MAX_ORDER
+        /**
+        * @brief The maximum order of the transfer functions that can be
+        * converted with qLTISys_TFToSOS(). It can be overridden at compile
+        * time to reduce the stack usage of the conversion.
+        */
+        #define QLTISYS_SOS_MAX_ORDER   ( 16U )
+    #endif
+
+    /**
+    * @brief A discrete LTI system evaluated as a cascade of second-order
+    * sections (biquads) in transposed direct form II.
+    * @details The instance should be initialized using the qLTISys_SOSSetup() API.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        const float *c;
+        float *x;
+        size_t ns;
+        /*! @endcond  */
+    } qLTISysSOS_t;
+
     /**
     * @brief Drives the LTI system recursively using the input signal provided
     * @pre Instance must be previously initialized by qLTISys_Setup()
@@ -75,6 +99,28 @@ extern "C" {
     float qLTISys_Excite( qLTISys_t * const sys,
                           float u );
 
+    /**
+    * @brief Drives the LTI system with a block of @a n samples of the input
+    * signal. The result is the same as calling qLTISys_Excite() for each
+    * sample, up to floating-point contraction, since the compiler may fuse
+    * the multiply-adds of the unrolled recurrence differently and change the
+    * last bit of some outputs. The checks, the delay and the saturation are
+    * handled once per block, and discrete systems with up to three states,
+    * that is max(na,nb) <= 3, keep their states in locals for the whole
+    * block.
+    * @pre Instance must be previously initialized by qLTISys_Setup()
+    * @param[in] sys A pointer to the LTI system instance
+    * @param[in] u An array of @a n samples of the input signal.
+    * @param[out] y An array of @a n elements where the system response will
+    * be stored. It can be the same array as @a u.
+    * @param[in] n The number of samples in @a u and @a y.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qLTISys_ExciteBlock( qLTISys_t * const sys,
+                             const float * const u,
+                             float * const y,
+                             const size_t n );
+
     /**
     * @brief Set the input delay for LTI system.
     * @param[in] sys A pointer to the LTI system instance
@@ -177,6 +223,34 @@ extern "C" {
                                      const size_t wsize,
                                      const float x );
 
+    /**
+    * @brief Evaluate the discrete FIR filter by inserting the sample @a x in
+    * the circular window @a w of size @a wsize, with the coefficients given
+    * in @a c. This is equivalent to qLTISys_DiscreteFIRUpdate(), but instead
+    * of shifting the whole window, only the newest sample is written, so the
+    * cost per sample is just the evaluation of the filter. The delay line of
+    * @a x at tap @c i is located at <tt>w[ ( head + i ) % wsize ]</tt>.
+    * If @a c it's not supplied, this function just perform the window update.
+    * @param[in,out] w An array of @a wsize elements that holds the window with
+    * the delay lines of @a x.
+    * @param[in] c An array of @a wsize elements with the coefficients of the
+    * FIR filter. Coefficients should be given in descending powers of the
+    * nth-degree polynomial. To ignore pass @c NULL.
+    * @param[in] wsize The number of elements of @a w.
+    * @param[in,out] head The index of the newest sample in @a w. Must be
+    * initialized with a value lower than @a wsize, e.g. zero, and not modified
+    * afterwards.
+    * @param[in] x A sample of the input signal.
+    * @return If @a c is provided, returns the evaluation of the FIR filter.
+    * otherwise return the sum of the updated window @a w. Returns zero if
+    * @a w or @a head are @c NULL or @a wsize is zero.
+    */
+    float qLTISys_DiscreteFIRCircular( float * const w,
+                                       const float * const c,
+                                       const size_t wsize,
+                                       size_t * const head,
+                                       const float x );
+
     /**
     * @brief Set integration method for continuos systems.
     * @param[in] sys A pointer to the continuous LTI system instance
@@ -193,6 +267,86 @@ extern "C" {
     int qLTISys_SetIntegrationMethod( qLTISys_t * const sys,
                                       qNumA_IntegrationMethod_t im );
 
+    /**
+    * @brief Convert the discrete transfer function given by @a num and @a den
+    * to a cascade of second-order sections. The roots of both polynomials
+    * are computed and the complex conjugate pairs are grouped together. Each
+    * pair of poles is matched with the zeros closest to it, starting from
+    * the poles closest to the unit circle, and the sections are sorted so
+    * the last one holds those poles. The gain of the transfer function is
+    * applied to the first section.
+    * @param[out] sos An array of 5*ns elements where the coefficients of the
+    * sections will be stored. Each section takes the five consecutive values
+    * \f$ b_{0}, b_{1}, b_{2}, a_{1}, a_{2} \f$ of
+    * \f$ \frac{ b_{0} + b_{1}z^{-1} + b_{2}z^{-2} }{ 1 + a_{1}z^{-1} + a_{2}z^{-2} } \f$
+    * @param[in] ns The number of sections in @a sos. Should be at least
+    * half of the order of the transfer function, rounded up. The sections
+    * not required by the transfer function are set as a unit gain.
+    * @param[in] num An array of @a nb elements with the numerator
+    * coefficients, in the same way as for qLTISys_Setup().
+    * @param[in] nb The number of elements of @a num.
+    * @param[in] den An array of @a na+1 elements with the denominator
+    * coefficients, in the same way as for qLTISys_Setup().
+    * @param[in] na The order of polynomial @a den.
+    * @return 1 on success, otherwise return 0. The conversion fails if the
+    * order is greater than ::QLTISYS_SOS_MAX_ORDER.
+    * @note The roots are computed in double precision, so the sections are
+    * as accurate as the given coefficients allow. This function is meant to
+    * be called once at setup.
+    */
+    int qLTISys_TFToSOS( float * const sos,
+                         const size_t ns,
+                         const float * const num,
+                         const size_t nb,
+                         const float * const den,
+                         const size_t na );
+
+    /**
+    * @brief Setup and initialize a discrete LTI system as a cascade of
+    * second-order sections. Unlike the single polynomial of qLTISys_Setup(),
+    * the sections keep high order filters accurate in single precision.
+    * @param[in] sys A pointer to the SOS system instance
+    * @param[in] sos An array of 5*ns elements with the coefficients of the
+    * sections as produced by qLTISys_TFToSOS(): \f$ b_{0}, b_{1}, b_{2},
+    * a_{1}, a_{2} \f$ for each section, with \f$ a_{0} = 1 \f$.
+    * @param[in] x An array of 2*ns elements to hold the states of the
+    * sections. States are set to zero.
+    * @param[in] ns The number of sections.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qLTISys_SOSSetup( qLTISysSOS_t * const sys,
+                          const float * const sos,
+                          float * const x,
+                          const size_t ns );
+
+    /**
+    * @brief Drives the SOS system using the input sample provided.
+    * @pre Instance must be previously initialized by qLTISys_SOSSetup()
+    * @param[in] sys A pointer to the SOS system instance
+    * @param[in] u A sample of the input signal that excites the system
+    * @return The system response.
+    */
+    float qLTISys_SOSExcite( qLTISysSOS_t * const sys,
+                             const float u );
+
+    /**
+    * @brief Drives the SOS system with a block of @a n samples of the input
+    * signal. The result is the same as calling qLTISys_SOSExcite() for each
+    * sample, up to floating-point contraction, but the block is passed through one section at a time, so the
+    * coefficients and the states of the section are held in locals.
+    * @pre Instance must be previously initialized by qLTISys_SOSSetup()
+    * @param[in] sys A pointer to the SOS system instance
+    * @param[in] u An array of @a n samples of the input signal.
+    * @param[out] y An array of @a n elements where the system response will
+    * be stored. It can be the same array as @a u.
+    * @param[in] n The number of samples in @a u and @a y.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qLTISys_SOSExciteBlock( qLTISysSOS_t * const sys,
+                                const float * const u,
+                                float * const y,
+                                const size_t n );
+
     /** @}*/
 
 #ifdef __cplusplus
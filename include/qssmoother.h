@@ -81,7 +81,7 @@ extern "C" {
         /*! @cond  */
         _qSSmoother_t f;
         float *w;
-        size_t wsize;
+        size_t wsize, head;
         /*! @endcond  */
     } qSSmoother_MWM1_t;
 
@@ -107,7 +107,7 @@ extern "C" {
         /*! @cond  */
         _qSSmoother_t f;
         float *w, m, alpha;
-        size_t wsize;
+        size_t wsize, head;
         /*! @endcond  */
     } qSSmoother_MOR1_t;
 
@@ -132,7 +132,7 @@ extern "C" {
         /*! @cond  */
         _qSSmoother_t f;
         float *w, *k;
-        size_t wsize;
+        size_t wsize, head;
         /*! @endcond  */
     } qSSmoother_GMWF_t;
 
@@ -101,8 +101,34 @@ static float qFIS_Sum( const float a,
 static float qFIS_Bound( float y,
                          const float yMin,
                          const float yMax );
+static float qFIS_Ramp( const float num,
+                        const float den );
 static void qFIS_EvalInputMFs( qFIS_t * const f );
+static void qFIS_GroupGather( const qFIS_t * const f,
+                              const size_t *idx,
+                              float * const x,
+                              const size_t n );
+static void qFIS_GroupScatter( qFIS_t * const f,
+                               const size_t *idx,
+                               const float * const y,
+                               const size_t n );
+static void qFIS_EvalGroupTriMF( qFIS_t * const f,
+                                 const size_t *idx,
+                                 float * const k,
+                                 const size_t n );
+static void qFIS_EvalGroupTrapMF( qFIS_t * const f,
+                                  const size_t *idx,
+                                  float * const k,
+                                  const size_t n );
+static void qFIS_EvalGroupGaussMF( qFIS_t * const f,
+                                   const size_t *idx,
+                                   float * const k,
+                                   const size_t n );
+static void qFIS_EvalGroupGeneric( qFIS_t * const f,
+                                   const size_t *idx,
+                                   const size_t n );
 static void qFIS_TruncateInputs( qFIS_t * const f );
+static void qFIS_Invalidate( qFIS_t * const f );
 static float qFIS_ParseFuzzValue( qFIS_MF_t * const mfIO,
                                   qFIS_Rules_t index );
 static qFIS_FuzzyOperator_t qFIS_GetFuzzOperator( const qFIS_t * const f );
@@ -130,8 +156,79 @@ static float qFIS_DeFuzz_WtAverage( qFIS_Output_t * const o,
 static float qFIS_DeFuzz_WtSum( qFIS_Output_t * const o,
                                 const qFIS_DeFuzzState_t stage );
 static void qFIS_Aggregate( qFIS_t * const f );
+static float qFIS_DeFuzzSample( qFIS_t * const f,
+                                qFIS_Output_t * const o,
+                                const float x );
+static float qFIS_DeFuzzSweep( qFIS_t * const f,
+                               qFIS_Output_t * const o,
+                               const float * const yc,
+                               const float tolA,
+                               const float target );
+static float qFIS_DeFuzzAdaptive( qFIS_t * const f,
+                                  qFIS_Output_t * const o );
+static void qFIS_InferenceRule( qFIS_t * const f,
+                                const size_t r );
+static void qFIS_AggregateRule( qFIS_t * const f,
+                                const size_t r );
+static void qFIS_InferenceSparse( qFIS_t * const f );
+static size_t qFIS_RuleIndexScan( const qFIS_t * const f,
+                                  size_t *start,
+                                  size_t *cnt );
+static void qFIS_EvalLowerMFs( qFIS_t * const f );
+static void qFIS_InferenceType2( qFIS_t * const f );
+static void qFIS_Type2Centroids( qFIS_t * const f );
+static void qFIS_Type2Sort( qFIS_t * const f,
+                            const size_t o );
+static float qFIS_Type2EKM( const float * const y,
+                            const float * const a,
+                            const float * const b,
+                            const size_t n,
+                            const bool right );
+static void qFIS_DeFuzzType2( qFIS_t * const f,
+                              const size_t o );
+#ifdef QFIS_PROFILING
+static uint32_t qFIS_ProfileNow( const qFIS_t * const f );
+static void qFIS_ProfileStage( const qFIS_t * const f,
+                               const qFIS_Stage_t s,
+                               const uint32_t t0 );
+static void qFIS_ProfileRules( const qFIS_t * const f );
+#endif
 
 #define QFIS_INFERENCE_ERROR         ( 0U )
+#define QFIS_DEFUZZ_MAX_DEPTH        ( 8U )
+#define QFIS_DEFUZZ_MAX_COARSE       ( 32U )
+
+/*! @cond  */
+enum {
+    QFIS_GROUP_TRIMF = 0,
+    QFIS_GROUP_TRAPMF,
+    QFIS_GROUP_GAUSSMF,
+    QFIS_GROUP_GENERIC,
+    QFIS_GROUP_MAX
+};
+/*! @endcond  */
+
+static const qFIS_FuzzyOperator_t qFIS_Operator[ 5 ] = { &qFIS_Min, &qFIS_Prod,
+                                                        &qFIS_Max, &qFIS_ProbOR,
+                                                        &qFIS_Sum
+                                                      };
+static const qFIS_DeFuzz_Fcn_t qFIS_DeFuzzMethod[ _NUM_DFUZZ ] = {
+    &qFIS_DeFuzz_Centroid, &qFIS_DeFuzz_Bisector, &qFIS_DeFuzz_MOM,
+    &qFIS_DeFuzz_LOM, &qFIS_DeFuzz_SOM, &qFIS_DeFuzz_WtAverage,
+    &qFIS_DeFuzz_WtSum
+};
+static const qFIS_MF_Fcn_t qFIS_Shape[ _NUM_MFS ] = {  &qFIS_ConstantMF,
+    /* Conventional membership functions, applies on any antecedent*/
+    &qFIS_TriMF, &qFIS_TrapMF, &qFIS_GBellMF, &qFIS_GaussMF, &qFIS_Gauss2MF,
+    &qFIS_SigMF, &qFIS_DSigMF, &qFIS_PSigMF, &qFIS_PiMF, &qFIS_SMF, &qFIS_ZMF,
+    &qFIS_SingletonMF, &qFIS_ConcaveMF, &qFIS_SpikeMF,
+    &qFIS_LinSMF, &qFIS_LinZMF, &qFIS_RectangleMF, &qFIS_CosineMF,
+    /* Only for Sugeno consequents*/
+    &qFIS_ConstantMF, &qFIS_LinearMF,
+    /* Only for Tsukamoto consequents*/
+    &qFIS_TLinSMF, &qFIS_TLinZMF, &qFIS_TConcaveMF,&qFIS_TSigMF, &qFIS_TSMF,
+    &qFIS_TZMF
+};
 
 /*============================================================================*/
 int qFIS_SetParameter( qFIS_t * const f,
@@ -139,50 +236,54 @@ int qFIS_SetParameter( qFIS_t * const f,
                        const qFIS_ParamValue_t x )
 {
     int retVal = 0;
-    typedef float (*methods_fcn)( const float a, const float b );
-    static const methods_fcn method[ 5 ] = { &qFIS_Min, &qFIS_Prod, &qFIS_Max,
-                                             &qFIS_ProbOR, &qFIS_Sum
-                                           };
 
     if ( NULL != f ) {
         switch ( p ) {
             case qFIS_Implication:
                 if ( x <= qFIS_PROD ) {
                     /*cppcheck-suppress misra-c2012-11.1 */
-                    f->implicate = method[ x ];
+                    f->implicate = qFIS_Operator[ x ];
                     retVal = 1;
                 }
                 break;
             case qFIS_Aggregation:
                 if ( ( x >= qFIS_MAX ) && ( x <= qFIS_SUM ) ) {
                     /*cppcheck-suppress misra-c2012-11.1 */
-                    f->aggregate = method[ x ];
+                    f->aggregate = qFIS_Operator[ x ];
                     retVal = 1;
                 }
                 break;
             case qFIS_AND:
                 if ( x <= qFIS_PROD ) {
                     /*cppcheck-suppress misra-c2012-11.1 */
-                    f->andOp = method[ x ];
+                    f->andOp = qFIS_Operator[ x ];
                     retVal = 1;
                 }
                 break;
             case qFIS_OR:
                 if ( ( x >= qFIS_MAX ) && ( x <= qFIS_PROBOR ) ) {
                     /*cppcheck-suppress misra-c2012-11.1 */
-                    f->orOp = method[ x ];
+                    f->orOp = qFIS_Operator[ x ];
                     retVal = 1;
                 }
                 break;
             case qFIS_EvalPoints:
                 if ( (int)x >= 20 ) {
+                    size_t i;
+
                     f->nPoints = (size_t)x;
+                    for ( i = 0U ; i < f->nOutputs ; ++i ) {
+                        /*cstat -CERT-FLP36-C*/
+                        f->output[ i ].res = ( f->output[ i ].b.max - f->output[ i ].b.min )/(float)f->nPoints;
+                        /*cstat +CERT-FLP36-C*/
+                    }
                     retVal = 1;
                 }
                 break;
             default:
                 break;
         }
+        qFIS_Invalidate( f );
     }
 
     return retVal;
@@ -193,24 +294,118 @@ int qFIS_SetDeFuzzMethod( qFIS_t * const f,
 {
     int retVal = 0;
 
-    static const qFIS_DeFuzz_Fcn_t method[ _NUM_DFUZZ ] = { &qFIS_DeFuzz_Centroid,
-                                                            &qFIS_DeFuzz_Bisector,
-                                                            &qFIS_DeFuzz_MOM,
-                                                            &qFIS_DeFuzz_LOM,
-                                                            &qFIS_DeFuzz_SOM,
-                                                            &qFIS_DeFuzz_WtAverage,
-                                                            &qFIS_DeFuzz_WtSum
-                                                          };
-
     if ( ( NULL != f ) || ( m < _NUM_DFUZZ ) ) {
         if ( ( ( Mamdani == f->type ) && ( m <= som ) ) ||
              ( ( Sugeno == f->type ) && ( m >= wtaver ) && ( m <= wtsum ) ) ||
              ( ( Tsukamoto == f->type ) && ( wtaver == m ) )) {
             /*cppcheck-suppress misra-c2012-11.1 */
-            f->deFuzz = method[ m ];
+            f->deFuzz = qFIS_DeFuzzMethod[ m ];
+            qFIS_Invalidate( f );
+            retVal = 1;
+        }
+    }
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_GetParameter( const qFIS_t * const f,
+                       const qFIS_Parameter_t p,
+                       qFIS_ParamValue_t * const x )
+{
+    int retVal = 0;
+
+    if ( ( NULL != f ) && ( NULL != x ) ) {
+        qFIS_FuzzyOperator_t op;
+        size_t i;
+
+        switch ( p ) {
+            case qFIS_Implication:
+                op = f->implicate;
+                break;
+            case qFIS_Aggregation:
+                op = f->aggregate;
+                break;
+            case qFIS_AND:
+                op = f->andOp;
+                break;
+            case qFIS_OR:
+                op = f->orOp;
+                break;
+            default:
+                op = NULL; /*not an operator*/
+                break;
+        }
+        for ( i = 0U ; i < ( sizeof(qFIS_Operator)/sizeof(qFIS_Operator[ 0 ]) ) ; ++i ) {
+            if ( ( NULL != op ) && ( qFIS_Operator[ i ] == op ) ) {
+                *x = (qFIS_ParamValue_t)i;
+                retVal = 1;
+                break;
+            }
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_GetDeFuzzMethod( const qFIS_t * const f,
+                          qFIS_DeFuzz_Method_t * const m )
+{
+    int retVal = 0;
+
+    if ( ( NULL != f ) && ( NULL != m ) ) {
+        size_t i;
+
+        for ( i = 0U ; i < (size_t)_NUM_DFUZZ ; ++i ) {
+            if ( qFIS_DeFuzzMethod[ i ] == f->deFuzz ) {
+                *m = (qFIS_DeFuzz_Method_t)i;
+                retVal = 1;
+                break;
+            }
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_GetMFName( const qFIS_MF_t * const m,
+                    qFIS_MF_Name_t * const s )
+{
+    int retVal = 0;
+
+    if ( ( NULL != m ) && ( NULL != s ) ) {
+        size_t i;
+
+        *s = custommf; /*user-defined membership function*/
+        /*the first entry is the placeholder of custommf*/
+        for ( i = 1U ; i < (size_t)_NUM_MFS ; ++i ) {
+            if ( qFIS_Shape[ i ] == m->shape ) {
+                *s = (qFIS_MF_Name_t)i;
+                break;
+            }
+        }
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_Refresh( qFIS_t * const f )
+{
+    int retVal = 0;
+
+    if ( NULL != f ) {
+        if ( ( NULL != f->lowMF ) && ( Mamdani == f->type ) ) {
+            qFIS_Type2Centroids( f );
+        }
+        if ( NULL != f->gCoeff ) {
+            /*the grouped coefficients are derived from the parameters*/
+            retVal = qFIS_SetMFGroups( f, f->gCoeff, f->gIndex, f->nMFInputs );
+        }
+        else {
+            qFIS_Invalidate( f );
             retVal = 1;
         }
     }
+
     return retVal;
 }
 /*============================================================================*/
@@ -255,6 +450,18 @@ int qFIS_Setup( qFIS_t * const f,
         f->deFuzz = ( Mamdani == t ) ? &qFIS_DeFuzz_Centroid
                                      : &qFIS_DeFuzz_WtAverage;
         f->ruleWeight = NULL;
+        f->gCoeff = NULL;
+        f->gIndex = NULL;
+        f->rStart = NULL;
+        f->nActive = 0U;
+        f->nKept = 0U;
+        f->lowMF = NULL;
+        f->nCoarse = 0U;
+        f->dTol = 0.0F;
+        f->pending = 1U;
+    #ifdef QFIS_PROFILING
+        f->profile = NULL;
+    #endif
         for ( i = 0U ; i < f->nOutputs ; ++i ) {
             /*cstat -CERT-FLP36-C*/
             f->output[ i ].res = ( f->output[ i ].b.max - f->output[ i ].b.min )/(float)f->nPoints;
@@ -276,6 +483,9 @@ int qFIS_InputSetup( qFIS_Input_t * const v,
     if ( ( NULL != v ) && ( t >= 0 ) ) {
         v[ t ].b.min = min;
         v[ t ].b.max = max;
+        v[ t ].prev = min;
+        v[ t ].tol = -1.0F;
+        v[ t ].dirty = 1U;
         retVal = 1;
     }
 
@@ -313,7 +523,27 @@ int qFIS_SetInput( qFIS_Input_t * const v,
     int retVal = 0;
 
     if ( ( NULL != v ) && ( t >= 0 ) ) {
+        const float x = qFIS_Bound( value, v[ t ].b.min, v[ t ].b.max );
+
         v[ t ].b.value = value;
+        if ( QLIB_ABS( x - v[ t ].prev ) > v[ t ].tol ) {
+            v[ t ].dirty = 1U;
+        }
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_SetInputTolerance( qFIS_Input_t * const v,
+                            const qFIS_Tag_t t,
+                            const float tol )
+{
+    int retVal = 0;
+
+    if ( ( NULL != v ) && ( t >= 0 ) ) {
+        v[ t ].tol = tol;
+        v[ t ].dirty = 1U;
         retVal = 1;
     }
 
@@ -332,6 +562,29 @@ float qFIS_GetOutput( const qFIS_Output_t * const v,
     return retVal;
 }
 
+/*============================================================================*/
+int qFIS_GetOutputInterval( const qFIS_Output_t * const v,
+                            const qFIS_Tag_t t,
+                            float * const yl,
+                            float * const yr )
+{
+    int retVal = 0;
+
+    if ( ( NULL != v ) && ( t >= 0 ) && ( NULL != yl ) && ( NULL != yr ) ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        /*cppcheck-suppress misra-c2012-11.5 */
+        const qFIS_t *f = (const qFIS_t*)v[ t ].owner;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+
+        if ( ( NULL != f ) && ( NULL != f->lowMF ) ) {
+            *yl = v[ t ].data[ 2 ];
+            *yr = v[ t ].data[ 3 ];
+            retVal = 1;
+        }
+    }
+
+    return retVal;
+}
 /*============================================================================*/
 int qFIS_SetMF( qFIS_MF_t * const m,
                 const qFIS_Tag_t io,
@@ -342,18 +595,6 @@ int qFIS_SetMF( qFIS_MF_t * const m,
                 float h )
 {
     int retVal = 0;
-    static const qFIS_MF_Fcn_t fShape[ _NUM_MFS ] = {  &qFIS_ConstantMF,
-    /* Conventional membership functions, applies on any antecedent*/
-    &qFIS_TriMF, &qFIS_TrapMF, &qFIS_GBellMF, &qFIS_GaussMF, &qFIS_Gauss2MF,
-    &qFIS_SigMF, &qFIS_DSigMF, &qFIS_PSigMF, &qFIS_PiMF, &qFIS_SMF, &qFIS_ZMF,
-    &qFIS_SingletonMF, &qFIS_ConcaveMF, &qFIS_SpikeMF,
-    &qFIS_LinSMF, &qFIS_LinZMF, &qFIS_RectangleMF, &qFIS_CosineMF,
-    /* Only for Sugeno consequents*/
-    &qFIS_ConstantMF, &qFIS_LinearMF,
-    /* Only for Tsukamoto consequents*/
-    &qFIS_TLinSMF, &qFIS_TLinZMF, &qFIS_TConcaveMF,&qFIS_TSigMF, &qFIS_TSMF,
-    &qFIS_TZMF
-    };
 
     if ( ( NULL != m ) && ( io >= 0 ) && ( mf >= 0 ) && ( s < _NUM_MFS ) ) {
         if ( NULL != custom_mf ) {
@@ -361,7 +602,7 @@ int qFIS_SetMF( qFIS_MF_t * const m,
         }
         else {
             /*cppcheck-suppress misra-c2012-11.1 */
-            m[ mf ].shape = fShape[ s ];
+            m[ mf ].shape = qFIS_Shape[ s ];
         }
         m[ mf ].index = (size_t)io;
         m[ mf ].points = cp;
@@ -398,18 +639,257 @@ int qFIS_StoreAggregatedRegion( qFIS_Output_t * const o,
 /*============================================================================*/
 static void qFIS_EvalInputMFs( qFIS_t * const f )
 {
-    size_t i;
-    qFIS_MF_t *mf;
+    if ( NULL != f->gCoeff ) {
+        const size_t *idx = f->gIndex;
+        float *k = f->gCoeff;
+
+        qFIS_EvalGroupTriMF( f, idx, k, f->gCount[ QFIS_GROUP_TRIMF ] );
+        idx += f->gCount[ QFIS_GROUP_TRIMF ];
+        k += QFIS_MFGROUP_NCOEF*f->gCount[ QFIS_GROUP_TRIMF ];
+        qFIS_EvalGroupTrapMF( f, idx, k, f->gCount[ QFIS_GROUP_TRAPMF ] );
+        idx += f->gCount[ QFIS_GROUP_TRAPMF ];
+        k += QFIS_MFGROUP_NCOEF*f->gCount[ QFIS_GROUP_TRAPMF ];
+        qFIS_EvalGroupGaussMF( f, idx, k, f->gCount[ QFIS_GROUP_GAUSSMF ] );
+        idx += f->gCount[ QFIS_GROUP_GAUSSMF ];
+        qFIS_EvalGroupGeneric( f, idx, f->gCount[ QFIS_GROUP_GENERIC ] );
+    }
+    else {
+        size_t i;
+        qFIS_MF_t *mf;
+
+        for ( i = 0U ; i < f->nMFInputs ; ++i ) {
+            mf = &f->inMF[ i ];
+            if ( 0U != f->input[ mf->index ].dirty ) {
+                /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+                /*cppcheck-suppress misra-c2012-11.3 */
+                mf->fx = mf->h*mf->shape( (qFIS_IO_Base_t*)&f->input[ mf->index ],
+                                          mf->points,
+                                          1U );
+                /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+            }
+        }
+    }
+}
+/*============================================================================*/
+static void qFIS_GroupGather( const qFIS_t * const f,
+                              const size_t *idx,
+                              float * const x,
+                              const size_t n )
+{
+    size_t j;
 
-    for ( i = 0U ; i < f->nMFInputs ; ++i ) {
-        mf = &f->inMF[ i ];
-        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
-        /*cppcheck-suppress misra-c2012-11.3 */
-        mf->fx = mf->h*mf->shape( (qFIS_IO_Base_t*)&f->input[ mf->index ],
-                                  mf->points,
-                                  1U );
-        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    for ( j = 0U ; j < n ; ++j ) {
+        x[ j ] = f->input[ f->inMF[ idx[ j ] ].index ].b.value;
+    }
+}
+/*============================================================================*/
+static void qFIS_GroupScatter( qFIS_t * const f,
+                               const size_t *idx,
+                               const float * const y,
+                               const size_t n )
+{
+    size_t j;
+
+    for ( j = 0U ; j < n ; ++j ) {
+        qFIS_MF_t *mf = &f->inMF[ idx[ j ] ];
+
+        if ( 0U != f->input[ mf->index ].dirty ) {
+            mf->fx = y[ j ];
+        }
+    }
+}
+/*============================================================================*/
+static void qFIS_EvalGroupTriMF( qFIS_t * const f,
+                                 const size_t *idx,
+                                 float * const k,
+                                 const size_t n )
+{
+    /*coefficients layout : [ a | 1/(b-a) | c | 1/(c-b) | h | x | y ]*/
+    const float *a = k;
+    const float *ia = &k[ n ];
+    const float *c = &k[ 2U*n ];
+    const float *ic = &k[ 3U*n ];
+    const float *h = &k[ 4U*n ];
+    float *x = &k[ 5U*n ];
+    float *y = &k[ 6U*n ];
+    size_t j;
+
+    qFIS_GroupGather( f, idx, x, n );
+    /*contiguous inputs and degrees, so this loop can be vectorized*/
+    for ( j = 0U ; j < n ; ++j ) {
+        const float l = ( x[ j ] - a[ j ] )*ia[ j ];
+        const float r = ( c[ j ] - x[ j ] )*ic[ j ];
+        float v = ( l < r ) ? l : r;
+
+        v = ( v > 0.0F ) ? v : 0.0F;
+        v = ( v < 1.0F ) ? v : 1.0F;
+        y[ j ] = h[ j ]*v;
+    }
+    qFIS_GroupScatter( f, idx, y, n );
+}
+/*============================================================================*/
+static void qFIS_EvalGroupTrapMF( qFIS_t * const f,
+                                  const size_t *idx,
+                                  float * const k,
+                                  const size_t n )
+{
+    /*coefficients layout : [ a | 1/(b-a) | d | 1/(d-c) | h | x | y ]*/
+    const float *a = k;
+    const float *ia = &k[ n ];
+    const float *d = &k[ 2U*n ];
+    const float *id = &k[ 3U*n ];
+    const float *h = &k[ 4U*n ];
+    float *x = &k[ 5U*n ];
+    float *y = &k[ 6U*n ];
+    size_t j;
+
+    qFIS_GroupGather( f, idx, x, n );
+    for ( j = 0U ; j < n ; ++j ) {
+        const float l = ( x[ j ] - a[ j ] )*ia[ j ];
+        const float r = ( d[ j ] - x[ j ] )*id[ j ];
+        float v = ( l < r ) ? l : r;
+
+        v = ( v > 0.0F ) ? v : 0.0F;
+        v = ( v < 1.0F ) ? v : 1.0F;
+        y[ j ] = h[ j ]*v;
+    }
+    qFIS_GroupScatter( f, idx, y, n );
+}
+/*============================================================================*/
+static void qFIS_EvalGroupGaussMF( qFIS_t * const f,
+                                   const size_t *idx,
+                                   float * const k,
+                                   const size_t n )
+{
+    /*coefficients layout : [ c | -0.5/s^2 | - | - | h | x | y ]*/
+    const float *c = k;
+    const float *g = &k[ n ];
+    const float *h = &k[ 4U*n ];
+    float *x = &k[ 5U*n ];
+    float *y = &k[ 6U*n ];
+    size_t j;
+
+    qFIS_GroupGather( f, idx, x, n );
+    /*the exponent is computed in a vectorizable loop, the exponential
+    itself is a library call per element*/
+    for ( j = 0U ; j < n ; ++j ) {
+        const float dx = x[ j ] - c[ j ];
+
+        y[ j ] = g[ j ]*dx*dx;
+    }
+    for ( j = 0U ; j < n ; ++j ) {
+        y[ j ] = h[ j ]*QLIB_EXP( y[ j ] );
+    }
+    qFIS_GroupScatter( f, idx, y, n );
+}
+/*============================================================================*/
+static void qFIS_EvalGroupGeneric( qFIS_t * const f,
+                                   const size_t *idx,
+                                   const size_t n )
+{
+    size_t j;
+
+    for ( j = 0U ; j < n ; ++j ) {
+        qFIS_MF_t *mf = &f->inMF[ idx[ j ] ];
+
+        if ( 0U != f->input[ mf->index ].dirty ) {
+            /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+            /*cppcheck-suppress misra-c2012-11.3 */
+            mf->fx = mf->h*mf->shape( (qFIS_IO_Base_t*)&f->input[ mf->index ],
+                                      mf->points,
+                                      1U );
+            /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+        }
+    }
+}
+/*============================================================================*/
+int qFIS_SetMFGroups( qFIS_t * const f,
+                      float *k,
+                      size_t *idx,
+                      const size_t n )
+{
+    int retVal = 0;
+
+    if ( NULL != f ) {
+        if ( NULL == k ) {
+            f->gCoeff = NULL;
+            f->gIndex = NULL;
+            retVal = 1;
+        }
+        else if ( ( NULL != idx ) && ( n >= f->nMFInputs ) ) {
+            size_t i, g, pos = 0U;
+            float *kg = k;
+
+            f->gCoeff = NULL; /*disable the grouped evaluation while rebuilding*/
+            for ( g = 0U ; g < (size_t)QFIS_GROUP_MAX ; ++g ) {
+                size_t cnt = 0U;
+
+                for ( i = 0U ; i < f->nMFInputs ; ++i ) {
+                    const qFIS_MF_t *mf = &f->inMF[ i ];
+                    size_t mg = (size_t)QFIS_GROUP_GENERIC;
+
+                    /*a vertical side is left to the shape function, so the
+                    kernels only handle finite slopes*/
+                    if ( ( &qFIS_TriMF == mf->shape ) &&
+                         ( mf->points[ 1 ] > mf->points[ 0 ] ) &&
+                         ( mf->points[ 2 ] > mf->points[ 1 ] ) ) {
+                        mg = (size_t)QFIS_GROUP_TRIMF;
+                    }
+                    else if ( ( &qFIS_TrapMF == mf->shape ) &&
+                              ( mf->points[ 1 ] > mf->points[ 0 ] ) &&
+                              ( mf->points[ 3 ] > mf->points[ 2 ] ) ) {
+                        mg = (size_t)QFIS_GROUP_TRAPMF;
+                    }
+                    else if ( &qFIS_GaussMF == mf->shape ) {
+                        mg = (size_t)QFIS_GROUP_GAUSSMF;
+                    }
+                    else {
+                        /*evaluated through the shape function*/
+                    }
+                    if ( g == mg ) {
+                        idx[ pos + cnt ] = i;
+                        ++cnt;
+                    }
+                }
+                f->gCount[ g ] = cnt;
+                if ( g < (size_t)QFIS_GROUP_GENERIC ) {
+                    /*store the pre-processed coefficients as SoA blocks*/
+                    for ( i = 0U ; i < cnt ; ++i ) {
+                        const qFIS_MF_t *mf = &f->inMF[ idx[ pos + i ] ];
+                        const float *p = mf->points;
+
+                        if ( (size_t)QFIS_GROUP_GAUSSMF == g ) {
+                            kg[ i ] = p[ 1 ];
+                            kg[ cnt + i ] = -0.5F/( p[ 0 ]*p[ 0 ] );
+                            kg[ ( 2U*cnt ) + i ] = 0.0F;
+                            kg[ ( 3U*cnt ) + i ] = 0.0F;
+                        }
+                        else {
+                            /*trimf(a,b,c) falls-off at [b,c], trapmf(a,b,c,d) at [c,d]*/
+                            const size_t e = ( (size_t)QFIS_GROUP_TRIMF == g ) ? 2U : 3U;
+
+                            kg[ i ] = p[ 0 ];
+                            kg[ cnt + i ] = 1.0F/( p[ 1 ] - p[ 0 ] );
+                            kg[ ( 2U*cnt ) + i ] = p[ e ];
+                            kg[ ( 3U*cnt ) + i ] = 1.0F/( p[ e ] - p[ e - 1U ] );
+                        }
+                        kg[ ( 4U*cnt ) + i ] = mf->h;
+                    }
+                    kg += QFIS_MFGROUP_NCOEF*cnt;
+                }
+                pos += cnt;
+            }
+            f->gIndex = idx;
+            f->gCoeff = k;
+            qFIS_Invalidate( f );
+            retVal = 1;
+        }
+        else {
+            /*nothing to do*/
+        }
     }
+
+    return retVal;
 }
 /*============================================================================*/
 static void qFIS_TruncateInputs( qFIS_t * const f )
@@ -417,10 +897,27 @@ static void qFIS_TruncateInputs( qFIS_t * const f )
     size_t i;
 
     for ( i = 0U ; i < f->nInputs ; ++i ) {
-        f->input[ i ].b.value = qFIS_Bound( f->input[ i ].b.value,
-                                            f->input[ i ].b.min,
-                                            f->input[ i ].b.max );
+        qFIS_Input_t *in = &f->input[ i ];
+
+        in->b.value = qFIS_Bound( in->b.value, in->b.min, in->b.max );
+        if ( in->tol < 0.0F ) { /*untracked input, always evaluated*/
+            in->dirty = 1U;
+        }
+        if ( 0U != in->dirty ) {
+            in->prev = in->b.value;
+            f->pending = 1U;
+        }
+    }
+}
+/*============================================================================*/
+static void qFIS_Invalidate( qFIS_t * const f )
+{
+    size_t i;
+
+    for ( i = 0U ; i < f->nInputs ; ++i ) {
+        f->input[ i ].dirty = 1U;
     }
+    f->pending = 1U;
 }
 /*============================================================================*/
 int qFIS_Fuzzify( qFIS_t * const f )
@@ -428,8 +925,17 @@ int qFIS_Fuzzify( qFIS_t * const f )
     int retVal = 0;
 
     if ( NULL != f ) {
+    #ifdef QFIS_PROFILING
+        const uint32_t t0 = qFIS_ProfileNow( f );
+    #endif
         qFIS_TruncateInputs( f );
         qFIS_EvalInputMFs( f );
+        if ( NULL != f->lowMF ) {
+            qFIS_EvalLowerMFs( f );
+        }
+    #ifdef QFIS_PROFILING
+        qFIS_ProfileStage( f, qFIS_StageFuzzify, t0 );
+    #endif
         retVal = 1;
     }
 
@@ -595,7 +1101,14 @@ static size_t qFIS_InferenceConsequent( struct _qFIS_s * const f,
 static void qFIS_Aggregate( qFIS_t * const f )
 {
     if ( NULL != f ) {
-        if ( QFIS_RULES_BEGIN == f->rules[ 0 ] ) {
+        if ( NULL != f->rStart ) {
+            size_t j;
+
+            for ( j = 0U ; j < f->nActive ; ++j ) {
+                qFIS_AggregateRule( f, f->rActive[ j ] );
+            }
+        }
+        else if ( QFIS_RULES_BEGIN == f->rules[ 0 ] ) {
             size_t i = 1U;
 
             f->aggregationState = &qFIS_AggregationFindConsequent;
@@ -608,6 +1121,22 @@ static void qFIS_Aggregate( qFIS_t * const f )
                 ++i;
             }
         }
+        else {
+            /*nothing to do*/
+        }
+    }
+}
+/*============================================================================*/
+static void qFIS_AggregateRule( qFIS_t * const f,
+                                const size_t r )
+{
+    size_t i = f->rStart[ r ];
+
+    f->aggregationState = &qFIS_AggregationFindConsequent;
+    f->ruleCount = r;
+    while ( r == f->ruleCount ) {
+        i = f->aggregationState( f, i );
+        ++i;
     }
 }
 /*============================================================================*/
@@ -793,14 +1322,31 @@ int qFIS_DeFuzzify( qFIS_t * const f )
 {
     int retVal = 0;
 
-    if ( NULL != f ) {
+    /*when no input has changed, the previous outputs are kept*/
+    if ( ( NULL != f ) && ( 0U != f->pending ) ) {
         size_t i;
+        bool adaptive = ( Mamdani == f->type ) && ( 0U != f->nCoarse );
+    #ifdef QFIS_PROFILING
+        const uint32_t t0 = qFIS_ProfileNow( f );
+    #endif
 
+        f->pending = 0U;
         for ( i = 0U; i < f->nOutputs ; ++i ) {
             f->deFuzz( &f->output[ i ] , DeFuzz_Init );
+            if ( NULL != f->output[ i ].xag ) {
+                adaptive = false; /*the aggregated region needs all the points*/
+            }
         }
 
-        if ( Mamdani == f->type  ) {
+        if ( NULL != f->lowMF ) {
+            for ( i = 0U; i < f->nOutputs ; ++i ) {
+                qFIS_DeFuzzType2( f, i );
+            }
+        }
+        else if ( adaptive ) {
+            /*each output is sampled by qFIS_DeFuzzAdaptive()*/
+        }
+        else if ( Mamdani == f->type  ) {
             size_t k;
 
             for ( k = 0U ; k < f->nPoints ; ++k ) {
@@ -833,64 +1379,972 @@ int qFIS_DeFuzzify( qFIS_t * const f )
         }
 
         for ( i = 0U; i < f->nOutputs ; ++i ) {
-            f->output[ i ].b.value = f->deFuzz( &f->output[ i ] , DeFuzz_End );
+            if ( NULL != f->lowMF ) {
+                /*center of the type-reduced interval*/
+                f->output[ i ].b.value = 0.5F*( f->output[ i ].data[ 2 ] + f->output[ i ].data[ 3 ] );
+            }
+            else if ( adaptive ) {
+                f->output[ i ].b.value = qFIS_DeFuzzAdaptive( f, &f->output[ i ] );
+            }
+            else {
+                f->output[ i ].b.value = f->deFuzz( &f->output[ i ] , DeFuzz_End );
+            }
             f->output[ i ].b.value = qFIS_Bound( f->output[ i ].b.value,
                                                  f->output[ i ].b.min,
                                                  f->output[ i ].b.max );
         }
+    #ifdef QFIS_PROFILING
+        qFIS_ProfileStage( f, qFIS_StageDeFuzzify, t0 );
+    #endif
     }
 
     return retVal;
 }
 /*============================================================================*/
-int qFIS_SetRuleWeights( qFIS_t * const f,
-                         float *rWeights )
+int qFIS_SetType2( qFIS_t * const f,
+                   qFIS_MF_t * const mf_lower,
+                   const size_t nml,
+                   float *w,
+                   const size_t nw,
+                   size_t *idx,
+                   const size_t ni )
 {
     int retVal = 0;
 
     if ( NULL != f ) {
-        f->ruleWeight = rWeights;
-        retVal = 1;
+        if ( NULL == mf_lower ) {
+            f->lowMF = NULL;
+            qFIS_Invalidate( f );
+            retVal = 1;
+        }
+        else if ( ( Tsukamoto != f->type ) &&
+                  ( nml == ( f->nMFInputs*sizeof(qFIS_MF_t) ) ) &&
+                  ( NULL != w ) && ( nw >= QFIS_TYPE2_WORK_SIZE( f->nRules, f->nOutputs ) ) &&
+                  ( NULL != idx ) && ( ni >= QFIS_TYPE2_INDEX_SIZE( f->nRules, f->nOutputs ) ) ) {
+            const size_t cap = f->nRules*f->nOutputs;
+            size_t *seg = idx;
+            size_t *rule = &idx[ f->nOutputs + 1U ];
+            size_t *pos = &rule[ cap ];
+            size_t o, r, i, n = 0U;
+
+            /*group the rule consequents by output*/
+            for ( o = 0U ; o < f->nOutputs ; ++o ) {
+                seg[ o ] = n;
+                i = 1U;
+                for ( r = 0U ; r < f->nRules ; ++r ) {
+                    bool more;
+
+                    while ( _QFIS_THEN != f->rules[ i + 2U ] ) {
+                        i += 3U;
+                    }
+                    i += 3U;
+                    do {
+                        if ( ( o == (size_t)f->rules[ i ] ) && ( n < cap ) ) {
+                            rule[ n ] = r;
+                            pos[ n ] = i;
+                            ++n;
+                        }
+                        more = ( f->nOutputs > 1U ) && ( _QFIS_AND == f->rules[ i + 2U ] );
+                        if ( more ) {
+                            i += 3U;
+                        }
+                    } while ( more );
+                    i += 2U;
+                }
+            }
+            seg[ f->nOutputs ] = n;
+            f->lowMF = mf_lower;
+            f->wl = w;
+            f->t2Map = idx;
+            for ( o = 0U ; o < f->nOutputs ; ++o ) {
+                f->output[ o ].data[ 2 ] = 0.5F*( f->output[ o ].b.min + f->output[ o ].b.max );
+                f->output[ o ].data[ 3 ] = f->output[ o ].data[ 2 ];
+            }
+            if ( Mamdani == f->type ) {
+                qFIS_Type2Centroids( f );
+            }
+            qFIS_Invalidate( f );
+            retVal = 1;
+        }
+        else {
+            /*nothing to do*/
+        }
     }
 
     return retVal;
 }
 /*============================================================================*/
-int qFIS_Inference( qFIS_t * const f )
+static void qFIS_EvalLowerMFs( qFIS_t * const f )
 {
-    int retVal = 0;
+    size_t i;
 
-    if ( NULL != f  ) {
-        size_t i = 0U;
+    for ( i = 0U ; i < f->nMFInputs ; ++i ) {
+        qFIS_MF_t *mf = &f->lowMF[ i ];
 
-        if ( QFIS_RULES_BEGIN == f->rules[ 0 ] ) {
-            f->inferenceState = &qFIS_InferenceAntecedent;
-            f->rStrength = 0.0F;
-            f->lastConnector = -1;
-            f->ruleCount = 0U;
-            i = 1U;
-            while ( ( _QFIS_RULES_END != f->rules[ i ] ) && ( f->ruleCount < f->nRules ) ) {
-                i = f->inferenceState( f, i );
-                if ( QFIS_INFERENCE_ERROR == i ) {
-                    break;
-                }
-                ++i;
-            }
-        }
-        if ( ( _QFIS_RULES_END == f->rules[ i ] ) && ( f->ruleCount == f->nRules) ) {
-            retVal = 1;
+        if ( 0U != f->input[ mf->index ].dirty ) {
+            /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+            /*cppcheck-suppress misra-c2012-11.3 */
+            mf->fx = mf->h*mf->shape( (qFIS_IO_Base_t*)&f->input[ mf->index ],
+                                      mf->points,
+                                      1U );
+            /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+            /*the lower membership can not exceed the upper one*/
+            mf->fx = qFIS_Bound( mf->fx, 0.0F, f->inMF[ i ].fx );
         }
     }
-
-    return retVal;
 }
 /*============================================================================*/
-static float qFIS_GetNextX( const float init,
-                            const float res,
-                            const size_t i )
+static void qFIS_InferenceType2( qFIS_t * const f )
 {
-    /*cstat -CERT-FLP36-C*/
-    return init + ( ( (float)i + 0.5F )*res );
+    size_t i = 1U;
+    size_t r;
+
+    for ( r = 0U ; r < f->nRules ; ++r ) {
+        float lo = 0.0F, up = 0.0F;
+        qFIS_Rules_t connector = -1;
+
+        do {
+            const qFIS_Rules_t mf = f->rules[ i + 1U ];
+            /*cstat -CERT-INT32-C_a*/
+            const size_t k = (size_t)( ( mf < 0 ) ? -mf : mf ) - 1U;
+            /*cstat +CERT-INT32-C_a*/
+            const float vl = f->lowMF[ k ].fx;
+            const float vu = qFIS_Bound( f->inMF[ k ].fx, 0.0F, 1.0F );
+            qFIS_FuzzyOperator_t op;
+
+            f->lastConnector = connector;
+            op = qFIS_GetFuzzOperator( f );
+            if ( mf < 0 ) { /*the complement swaps the bounds*/
+                lo = op( lo, 1.0F - vu );
+                up = op( up, 1.0F - vl );
+            }
+            else {
+                lo = op( lo, vl );
+                up = op( up, vu );
+            }
+            connector = f->rules[ i + 2U ];
+            i += 3U;
+        } while ( _QFIS_THEN != connector );
+        while ( ( f->nOutputs > 1U ) && ( _QFIS_AND == f->rules[ i + 2U ] ) ) {
+            i += 3U;
+        }
+        i += 2U;
+        if ( NULL != f->ruleWeight ) {
+            const float rw = qFIS_Bound( f->ruleWeight[ r ], 0.0F, 1.0F );
+
+            lo *= rw;
+            up *= rw;
+        }
+        f->wl[ r ] = lo;
+        f->wi[ r ] = up;
+    }
+    f->lastConnector = -1;
+}
+/*============================================================================*/
+static void qFIS_Type2Centroids( qFIS_t * const f )
+{
+    const size_t cap = f->nRules*f->nOutputs;
+    const size_t *seg = f->t2Map;
+    const size_t *pos = &f->t2Map[ f->nOutputs + 1U + cap ];
+    float *y = &f->wl[ f->nRules ];
+    size_t o, k, j;
+
+    /*the centroid of each consequent set is fixed, so it is only computed
+    and sorted when the type-2 evaluation is enabled or refreshed*/
+    for ( o = 0U ; o < f->nOutputs ; ++o ) {
+        const qFIS_Output_t *out = &f->output[ o ];
+
+        for ( k = seg[ o ] ; k < seg[ o + 1U ] ; ++k ) {
+            const qFIS_Rules_t mf = f->rules[ pos[ k ] + 1U ];
+            /*cstat -CERT-INT32-C_a*/
+            const qFIS_MF_t *m = &f->outMF[ (size_t)( ( mf < 0 ) ? -mf : mf ) - 1U ];
+            /*cstat +CERT-INT32-C_a*/
+            qFIS_IO_Base_t io = out->b;
+            float num = 0.0F, den = 0.0F;
+
+            for ( j = 0U ; j < f->nPoints ; ++j ) {
+                float v;
+
+                io.value = qFIS_GetNextX( out->b.min, out->res, j );
+                v = m->h*m->shape( &io, m->points, 1U );
+                /*cppcheck-suppress misra-c2012-12.1 */
+                v = ( mf < 0 ) ? ( 1.0F - v ) : v;
+                num += io.value*v;
+                den += v;
+            }
+            /*cppcheck-suppress misra-c2012-12.1 */
+            y[ k ] = ( den > 0.0F ) ? ( num/den ) : ( 0.5F*( out->b.min + out->b.max ) );
+        }
+        qFIS_Type2Sort( f, o );
+    }
+}
+/*============================================================================*/
+static void qFIS_Type2Sort( qFIS_t * const f,
+                            const size_t o )
+{
+    const size_t cap = f->nRules*f->nOutputs;
+    const size_t *seg = f->t2Map;
+    size_t *rule = &f->t2Map[ f->nOutputs + 1U ];
+    size_t *pos = &rule[ cap ];
+    float *y = &f->wl[ f->nRules ];
+    size_t i, j;
+
+    /*insertion sort, linear when the order from the previous call holds*/
+    for ( i = seg[ o ] + 1U ; i < seg[ o + 1U ] ; ++i ) {
+        const float yi = y[ i ];
+        const size_t ri = rule[ i ];
+        const size_t pi = pos[ i ];
+
+        for ( j = i ; ( j > seg[ o ] ) && ( y[ j - 1U ] > yi ) ; --j ) {
+            y[ j ] = y[ j - 1U ];
+            rule[ j ] = rule[ j - 1U ];
+            pos[ j ] = pos[ j - 1U ];
+        }
+        y[ j ] = yi;
+        rule[ j ] = ri;
+        pos[ j ] = pi;
+    }
+}
+/*============================================================================*/
+static float qFIS_Type2EKM( const float * const y,
+                            const float * const a,
+                            const float * const b,
+                            const size_t n,
+                            const bool right )
+{
+    float yv = y[ 0 ];
+
+    if ( n > 1U ) {
+        float num = 0.0F, den = 0.0F;
+        size_t i, k, kn, it;
+        /*cstat -CERT-FLP36-C -CERT-FLP34-C*/
+        const float k0 = ( (float)n/( ( right ) ? 1.7F : 2.4F ) ) + 0.5F;
+
+        k = (size_t)k0;
+        /*cstat +CERT-FLP36-C +CERT-FLP34-C*/
+        k = ( k < 1U ) ? 1U : k;
+        k = ( k > ( n - 1U ) ) ? ( n - 1U ) : k;
+        /*the points below the switch point k take the upper weight for the
+        left end-point and the lower weight for the right end-point*/
+        for ( i = 0U ; i < n ; ++i ) {
+            /*cppcheck-suppress misra-c2012-12.1 */
+            const float w = ( ( i < k ) != right ) ? b[ i ] : a[ i ];
+
+            num += y[ i ]*w;
+            den += w;
+        }
+        yv = num/den;
+        for ( it = 0U ; it < n ; ++it ) {
+            float dn = 0.0F, ds = 0.0F;
+            size_t lo, hi;
+
+            kn = k;
+            while ( ( kn < ( n - 1U ) ) && ( y[ kn ] <= yv ) ) {
+                ++kn;
+            }
+            while ( ( kn > 1U ) && ( y[ kn - 1U ] > yv ) ) {
+                --kn;
+            }
+            if ( kn == k ) {
+                break;
+            }
+            lo = ( kn < k ) ? kn : k;
+            hi = ( kn < k ) ? k : kn;
+            /*only the points between both switch points change their weight*/
+            for ( i = lo ; i < hi ; ++i ) {
+                const float d = b[ i ] - a[ i ];
+
+                dn += y[ i ]*d;
+                ds += d;
+            }
+            if ( ( kn > k ) != right ) {
+                num += dn;
+                den += ds;
+            }
+            else {
+                num -= dn;
+                den -= ds;
+            }
+            k = kn;
+            yv = num/den;
+        }
+    }
+
+    return yv;
+}
+/*============================================================================*/
+static void qFIS_DeFuzzType2( qFIS_t * const f,
+                              const size_t o )
+{
+    const size_t cap = f->nRules*f->nOutputs;
+    const size_t *seg = f->t2Map;
+    const size_t *rule = &f->t2Map[ f->nOutputs + 1U ];
+    const size_t *pos = &rule[ cap ];
+    float *y = &f->wl[ f->nRules ];
+    float *yk = &y[ cap ];
+    float *ak = &yk[ cap ];
+    float *bk = &ak[ cap ];
+    size_t k, n = 0U;
+
+    if ( Sugeno == f->type ) {
+        for ( k = seg[ o ] ; k < seg[ o + 1U ] ; ++k ) {
+            const qFIS_Rules_t mf = f->rules[ pos[ k ] + 1U ];
+            /*cstat -CERT-INT32-C_a*/
+            const qFIS_MF_t *m = &f->outMF[ (size_t)( ( mf < 0 ) ? -mf : mf ) - 1U ];
+            /*cstat +CERT-INT32-C_a*/
+
+            /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+            /*cppcheck-suppress misra-c2012-11.3 */
+            y[ k ] = m->shape( (qFIS_IO_Base_t*)f->input, m->points, f->nInputs );
+            /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+        }
+        qFIS_Type2Sort( f, o );
+    }
+    for ( k = seg[ o ] ; k < seg[ o + 1U ] ; ++k ) {
+        const size_t r = rule[ k ];
+
+        if ( f->wi[ r ] > 0.0F ) {
+            yk[ n ] = y[ k ];
+            ak[ n ] = f->wl[ r ];
+            bk[ n ] = f->wi[ r ];
+            ++n;
+        }
+    }
+    if ( n > 0U ) { /*otherwise, the previous interval is kept*/
+        f->output[ o ].data[ 2 ] = qFIS_Type2EKM( yk, ak, bk, n, false );
+        f->output[ o ].data[ 3 ] = qFIS_Type2EKM( yk, ak, bk, n, true );
+    }
+}
+/*============================================================================*/
+int qFIS_SetDeFuzzAdaptive( qFIS_t * const f,
+                            const size_t n,
+                            const float tol )
+{
+    int retVal = 0;
+
+    if ( NULL != f ) {
+        if ( ( 0U == n ) || ( tol <= 0.0F ) ) {
+            f->nCoarse = 0U;
+            f->dTol = 0.0F;
+            retVal = 1;
+        }
+        else if ( ( Mamdani == f->type ) && ( n >= 2U ) && ( n <= QFIS_DEFUZZ_MAX_COARSE ) ) {
+            f->nCoarse = n;
+            f->dTol = tol;
+            retVal = 1;
+        }
+        else {
+            /*nothing to do*/
+        }
+        qFIS_Invalidate( f );
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static float qFIS_DeFuzzSample( qFIS_t * const f,
+                                qFIS_Output_t * const o,
+                                const float x )
+{
+    size_t i;
+
+    for ( i = 0U; i < f->nOutputs ; ++i ) {
+        f->output[ i ].y = 0.0F;
+    }
+    o->x = x;
+    o->b.value = x;
+    qFIS_Aggregate( f );
+
+    return o->y;
+}
+/*============================================================================*/
+static float qFIS_DeFuzzSweep( qFIS_t * const f,
+                               qFIS_Output_t * const o,
+                               const float * const yc,
+                               const float tolA,
+                               const float target )
+{
+    struct {
+        float x, y;
+        size_t depth;
+    } stack[ QFIS_DEFUZZ_MAX_DEPTH + 1U ];
+    /*cstat -CERT-FLP36-C*/
+    const float w0 = ( o->b.max - o->b.min )/(float)f->nCoarse;
+    /*cstat +CERT-FLP36-C*/
+    const bool integral = ( &qFIS_DeFuzz_Centroid == f->deFuzz ) ||
+                          ( &qFIS_DeFuzz_Bisector == f->deFuzz );
+    float a = o->b.min, ya = yc[ 0 ], area = 0.0F, xb = o->b.max;
+    bool found = false;
+    size_t c;
+
+    if ( ( !integral ) && ( target < 0.0F ) ) {
+        o->x = a;
+        o->y = ya;
+        f->deFuzz( o, DeFuzz_Compute );
+    }
+    for ( c = 1U ; ( c <= f->nCoarse ) && ( !found ) ; ++c ) {
+        size_t sp = 1U;
+
+        /*cstat -CERT-FLP36-C*/
+        stack[ 0 ].x = ( c == f->nCoarse ) ? o->b.max : ( o->b.min + ( (float)c*w0 ) );
+        /*cstat +CERT-FLP36-C*/
+        stack[ 0 ].y = yc[ c ];
+        stack[ 0 ].depth = 0U;
+        while ( ( sp > 0U ) && ( !found ) ) {
+            const float b = stack[ sp - 1U ].x;
+            const float yb = stack[ sp - 1U ].y;
+            const size_t d = stack[ sp - 1U ].depth;
+            const float m = 0.5F*( a + b );
+            const float ym = qFIS_DeFuzzSample( f, o, m );
+            /*difference between the trapezoidal areas of the whole interval
+            and its two halves*/
+            const float e = 0.25F*( b - a )*QLIB_ABS( ( 2.0F*ym ) - ya - yb );
+
+            if ( ( d < QFIS_DEFUZZ_MAX_DEPTH ) && ( e > tolA ) ) {
+                stack[ sp - 1U ].depth = d + 1U; /*split, left half first*/
+                stack[ sp ].x = m;
+                stack[ sp ].y = ym;
+                stack[ sp ].depth = d + 1U;
+                ++sp;
+            }
+            else { /*accept the interval as two linear segments*/
+                const float px[ 3 ] = { a, m, b };
+                const float py[ 3 ] = { ya, ym, yb };
+                size_t k;
+
+                for ( k = 0U ; ( k < 2U ) && ( !found ) ; ++k ) {
+                    const float h = px[ k + 1U ] - px[ k ];
+                    const float s = py[ k ] + py[ k + 1U ];
+                    const float ak = 0.5F*h*s;
+
+                    if ( target >= 0.0F ) { /*bisector search*/
+                        if ( ( ak > 0.0F ) && ( ( area + ak ) >= target ) ) {
+                            xb = px[ k ] + ( h*( target - area )/ak );
+                            found = true;
+                        }
+                    }
+                    else if ( integral ) {
+                        if ( ak > 0.0F ) { /*centroid of the trapezoid*/
+                            o->x = px[ k ] + ( h*( py[ k ] + ( 2.0F*py[ k + 1U ] ) )/( 3.0F*s ) );
+                            o->y = ak;
+                            f->deFuzz( o, DeFuzz_Compute );
+                        }
+                    }
+                    else {
+                        o->x = px[ k + 1U ];
+                        o->y = py[ k + 1U ];
+                        f->deFuzz( o, DeFuzz_Compute );
+                    }
+                    area += ak;
+                }
+                a = b;
+                ya = yb;
+                --sp;
+            }
+        }
+    }
+
+    return ( target >= 0.0F ) ? xb : area;
+}
+/*============================================================================*/
+static float qFIS_DeFuzzAdaptive( qFIS_t * const f,
+                                  qFIS_Output_t * const o )
+{
+    float yc[ QFIS_DEFUZZ_MAX_COARSE + 1U ];
+    const float span = o->b.max - o->b.min;
+    /*cstat -CERT-FLP36-C*/
+    const float w0 = span/(float)f->nCoarse;
+    /*cstat +CERT-FLP36-C*/
+    float a0 = 0.0F, tolA, d;
+    size_t c;
+
+    /*the coarse pass estimates the area A to scale the tolerance : when the
+    area error of an interval is below tol*A/span, it moves the estimate less
+    than tol*/
+    yc[ 0 ] = qFIS_DeFuzzSample( f, o, o->b.min );
+    for ( c = 1U ; c <= f->nCoarse ; ++c ) {
+        /*cstat -CERT-FLP36-C*/
+        yc[ c ] = qFIS_DeFuzzSample( f, o, ( c == f->nCoarse ) ? o->b.max
+                                                              : ( o->b.min + ( (float)c*w0 ) ) );
+        /*cstat +CERT-FLP36-C*/
+        a0 += 0.5F*w0*( yc[ c - 1U ] + yc[ c ] );
+    }
+    a0 = QLIB_MAX( a0, 0.5F*w0 );
+    tolA = f->dTol*a0/span;
+
+    f->deFuzz( o, DeFuzz_Init );
+    if ( &qFIS_DeFuzz_Bisector == f->deFuzz ) {
+        d = qFIS_DeFuzzSweep( f, o, yc, tolA, -1.0F );
+        d = ( d > 0.0F ) ? qFIS_DeFuzzSweep( f, o, yc, tolA, 0.5F*d ) : o->b.min;
+    }
+    else {
+        (void)qFIS_DeFuzzSweep( f, o, yc, tolA, -1.0F );
+        d = f->deFuzz( o, DeFuzz_End );
+    }
+
+    return d;
+}
+/*============================================================================*/
+int qFIS_SetRuleWeights( qFIS_t * const f,
+                         float *rWeights )
+{
+    int retVal = 0;
+
+    if ( NULL != f ) {
+        f->ruleWeight = rWeights;
+        qFIS_Invalidate( f );
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_Inference( qFIS_t * const f )
+{
+    int retVal = 0;
+
+    if ( NULL != f  ) {
+        size_t i = 0U;
+    #ifdef QFIS_PROFILING
+        const uint32_t t0 = qFIS_ProfileNow( f );
+    #endif
+
+        if ( 0U == f->pending ) {
+            retVal = 1; /*no input has changed, keep the previous strengths*/
+        }
+        else if ( NULL != f->lowMF ) {
+            qFIS_InferenceType2( f );
+            retVal = 1;
+        }
+        else if ( NULL != f->rStart ) {
+            qFIS_InferenceSparse( f );
+            retVal = 1;
+        }
+        else {
+            if ( QFIS_RULES_BEGIN == f->rules[ 0 ] ) {
+                f->inferenceState = &qFIS_InferenceAntecedent;
+                f->rStrength = 0.0F;
+                f->lastConnector = -1;
+                f->ruleCount = 0U;
+                i = 1U;
+                while ( ( _QFIS_RULES_END != f->rules[ i ] ) && ( f->ruleCount < f->nRules ) ) {
+                    i = f->inferenceState( f, i );
+                    if ( QFIS_INFERENCE_ERROR == i ) {
+                        break;
+                    }
+                    ++i;
+                }
+            }
+            if ( ( _QFIS_RULES_END == f->rules[ i ] ) && ( f->ruleCount == f->nRules) ) {
+                retVal = 1;
+            }
+        }
+        for ( i = 0U ; i < f->nInputs ; ++i ) {
+            f->input[ i ].dirty = 0U;
+        }
+    #ifdef QFIS_PROFILING
+        /*pending is cleared by qFIS_DeFuzzify(), so here it tells whether
+        the rules were evaluated or the inference was skipped*/
+        if ( ( 1 == retVal ) && ( 0U != f->pending ) ) {
+            qFIS_ProfileRules( f );
+        }
+        qFIS_ProfileStage( f, qFIS_StageInference, t0 );
+    #endif
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static void qFIS_InferenceRule( qFIS_t * const f,
+                                const size_t r )
+{
+    size_t i = f->rStart[ r ];
+
+    f->inferenceState = &qFIS_InferenceAntecedent;
+    f->rStrength = 0.0F;
+    f->lastConnector = -1;
+    f->ruleCount = r;
+    while ( r == f->ruleCount ) {
+        i = f->inferenceState( f, i );
+        if ( QFIS_INFERENCE_ERROR == i ) {
+            f->wi[ r ] = 0.0F;
+            break;
+        }
+        ++i;
+    }
+}
+/*============================================================================*/
+static void qFIS_InferenceSparse( qFIS_t * const f )
+{
+    size_t j, k, nc = 0U, na = 0U;
+    size_t *cand = &f->rActive[ f->nRules ];
+
+    /*collect the candidate rules : the ones that depend on a changed input
+    and either have a non-zero premise or were previously active. The last
+    bucket holds the rules with negated premises*/
+    for ( j = 0U ; j <= f->nMFInputs ; ++j ) {
+        bool changed, all;
+
+        if ( j == f->nMFInputs ) {
+            changed = ( 0U != f->pending );
+            all = true;
+        }
+        else {
+            changed = ( 0U != f->input[ f->inMF[ j ].index ].dirty );
+            all = ( f->inMF[ j ].fx > 0.0F );
+        }
+        if ( changed ) {
+            for ( k = f->mfStart[ j ] ; k < f->mfStart[ j + 1U ] ; ++k ) {
+                const size_t r = f->mfRef[ k ];
+
+                if ( ( f->wi[ r ] >= 0.0F ) && ( all || ( f->wi[ r ] > 0.0F ) ) ) {
+                    f->wi[ r ] = -1.0F; /*mark as candidate*/
+                    cand[ nc++ ] = r;
+                }
+            }
+        }
+    }
+    /*keep the active rules that are not affected*/
+    for ( j = 0U ; j < f->nActive ; ++j ) {
+        const size_t r = f->rActive[ j ];
+
+        if ( f->wi[ r ] > 0.0F ) {
+            f->rActive[ na++ ] = r;
+        }
+    }
+    f->nKept = na;
+    /*evaluate the candidates and keep only the ones that fired*/
+    for ( j = 0U ; j < nc ; ++j ) {
+        const size_t r = cand[ j ];
+
+        qFIS_InferenceRule( f, r );
+        if ( f->wi[ r ] > 0.0F ) {
+            f->rActive[ na++ ] = r;
+        }
+    }
+    f->nActive = na;
+}
+/*============================================================================*/
+static size_t qFIS_RuleIndexScan( const qFIS_t * const f,
+                                  size_t *start,
+                                  size_t *cnt )
+{
+    size_t i = 1U, r = 0U, nRefs = 0U;
+
+    while ( ( r < f->nRules ) && ( _QFIS_RULES_END != f->rules[ i ] ) ) {
+        bool always = false;
+
+        if ( NULL != start ) {
+            start[ r ] = i;
+        }
+        for ( ;; ) { /*antecedents*/
+            const qFIS_Rules_t in = f->rules[ i ];
+            const qFIS_Rules_t mf = f->rules[ i + 1U ];
+            const qFIS_Rules_t connector = f->rules[ i + 2U ];
+
+            if ( ( in < 0 ) || ( (size_t)in >= f->nInputs ) || ( 0 == mf ) ) {
+                nRefs = SIZE_MAX;
+                break;
+            }
+            if ( mf < 0 ) {
+                always = true;
+            }
+            else if ( (size_t)mf <= f->nMFInputs ) {
+                ++nRefs;
+                if ( NULL != cnt ) {
+                    ++cnt[ mf - 1 ];
+                }
+            }
+            else {
+                nRefs = SIZE_MAX;
+                break;
+            }
+            i += 3U;
+            if ( _QFIS_THEN == connector ) {
+                break;
+            }
+            if ( ( _QFIS_AND != connector ) && ( _QFIS_OR != connector ) ) {
+                nRefs = SIZE_MAX;
+                break;
+            }
+        }
+        if ( SIZE_MAX == nRefs ) {
+            break;
+        }
+        if ( always ) {
+            ++nRefs;
+            if ( NULL != cnt ) {
+                ++cnt[ f->nMFInputs ];
+            }
+        }
+        i += 2U; /*consequents*/
+        while ( _QFIS_AND == f->rules[ i ] ) {
+            i += 3U;
+        }
+        ++r;
+    }
+    if ( ( r != f->nRules ) || ( _QFIS_RULES_END != f->rules[ i ] ) ) {
+        nRefs = SIZE_MAX;
+    }
+
+    return nRefs;
+}
+/*============================================================================*/
+int qFIS_SetRuleIndex( qFIS_t * const f,
+                       size_t *w,
+                       const size_t n )
+{
+    int retVal = 0;
+
+    if ( NULL != f ) {
+        f->rStart = NULL;
+        f->nActive = 0U;
+        f->nKept = 0U;
+        if ( NULL == w ) {
+            retVal = 1;
+        }
+        else if ( QFIS_RULES_BEGIN == f->rules[ 0 ] ) {
+            const size_t nRefs = qFIS_RuleIndexScan( f, NULL, NULL );
+            const size_t nBuckets = f->nMFInputs + 2U;
+
+            if ( ( SIZE_MAX != nRefs ) && ( n >= ( ( 3U*f->nRules ) + nBuckets + nRefs ) ) ) {
+                size_t i, j, r;
+                size_t *start = w;
+                size_t *bucket = &w[ f->nRules ];
+                size_t *ref = &bucket[ nBuckets ];
+
+                for ( j = 0U ; j < nBuckets ; ++j ) {
+                    bucket[ j ] = 0U;
+                }
+                /*count the references of every membership function*/
+                (void)qFIS_RuleIndexScan( f, start, &bucket[ 1 ] );
+                for ( j = 1U ; j < nBuckets ; ++j ) {
+                    bucket[ j ] += bucket[ j - 1U ];
+                }
+                /*fill the references, bucket[ j ] is used as the write
+                cursor of the bucket j*/
+                for ( r = 0U ; r < f->nRules ; ++r ) {
+                    bool always = false;
+
+                    i = start[ r ];
+                    for ( ;; ) {
+                        const qFIS_Rules_t mf = f->rules[ i + 1U ];
+
+                        if ( mf < 0 ) {
+                            always = true;
+                        }
+                        else {
+                            /*cstat -CERT-INT30-C_a*/
+                            ref[ bucket[ mf - 1 ]++ ] = r;
+                            /*cstat +CERT-INT30-C_a*/
+                        }
+                        if ( _QFIS_THEN == f->rules[ i + 2U ] ) {
+                            break;
+                        }
+                        i += 3U;
+                    }
+                    if ( always ) {
+                        ref[ bucket[ f->nMFInputs ]++ ] = r;
+                    }
+                }
+                for ( j = ( nBuckets - 1U ) ; j > 0U ; --j ) {
+                    bucket[ j ] = bucket[ j - 1U ];
+                }
+                bucket[ 0 ] = 0U;
+                for ( r = 0U ; r < f->nRules ; ++r ) {
+                    f->wi[ r ] = 0.0F;
+                }
+                f->mfStart = bucket;
+                f->mfRef = ref;
+                f->rActive = &ref[ nRefs ];
+                f->rStart = start;
+                qFIS_Invalidate( f );
+                retVal = 1;
+            }
+        }
+        else {
+            /*nothing to do*/
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+const size_t* qFIS_GetActiveRules( const qFIS_t * const f,
+                                   size_t * const n )
+{
+    const size_t *retVal = NULL;
+    size_t nActive = 0U;
+
+    if ( ( NULL != f ) && ( NULL != f->rStart ) ) {
+        retVal = f->rActive;
+        nActive = f->nActive;
+    }
+    if ( NULL != n ) {
+        *n = nActive;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+#ifdef QFIS_PROFILING
+/*============================================================================*/
+int qFIS_SetProfile( qFIS_t * const f,
+                     qFIS_Profile_t * const p,
+                     qFIS_ProfileClock_t clk,
+                     uint32_t *fired,
+                     float *strength )
+{
+    int retVal = 0;
+
+    if ( NULL != f ) {
+        if ( NULL != p ) {
+            p->clock = clk;
+            if ( ( NULL != fired ) && ( NULL != strength ) ) {
+                p->fired = fired;
+                p->strength = strength;
+                p->nRules = f->nRules;
+            }
+            else {
+                p->fired = NULL;
+                p->strength = NULL;
+                p->nRules = 0U;
+            }
+            (void)qFIS_ResetProfile( p );
+        }
+        f->profile = p;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_ResetProfile( qFIS_Profile_t * const p )
+{
+    int retVal = 0;
+
+    if ( NULL != p ) {
+        size_t i;
+
+        for ( i = 0U ; i < (size_t)_NUM_QFIS_STAGES ; ++i ) {
+            p->ticks[ i ] = 0U;
+            p->maxTicks[ i ] = 0U;
+            p->calls[ i ] = 0U;
+        }
+        p->inferences = 0U;
+        for ( i = 0U ; i < p->nRules ; ++i ) {
+            p->fired[ i ] = 0U;
+            p->strength[ i ] = 0.0F;
+        }
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+float qFIS_GetRuleMeanStrength( const qFIS_Profile_t * const p,
+                                const size_t r )
+{
+    float retVal = 0.0F;
+
+    if ( ( NULL != p ) && ( r < p->nRules ) && ( p->inferences > 0U ) ) {
+        retVal = p->strength[ r ]/(float)p->inferences;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+size_t qFIS_GetUnfiredRules( const qFIS_Profile_t * const p,
+                             size_t * const list,
+                             const size_t n )
+{
+    size_t nUnfired = 0U;
+
+    if ( NULL != p ) {
+        size_t r;
+
+        for ( r = 0U ; r < p->nRules ; ++r ) {
+            if ( 0U == p->fired[ r ] ) {
+                if ( ( NULL != list ) && ( nUnfired < n ) ) {
+                    list[ nUnfired ] = r;
+                }
+                ++nUnfired;
+            }
+        }
+    }
+
+    return nUnfired;
+}
+/*============================================================================*/
+static uint32_t qFIS_ProfileNow( const qFIS_t * const f )
+{
+    uint32_t t = 0U;
+
+    if ( ( NULL != f->profile ) && ( NULL != f->profile->clock ) ) {
+        t = f->profile->clock();
+    }
+
+    return t;
+}
+/*============================================================================*/
+static void qFIS_ProfileStage( const qFIS_t * const f,
+                               const qFIS_Stage_t s,
+                               const uint32_t t0 )
+{
+    qFIS_Profile_t * const p = f->profile;
+
+    if ( NULL != p ) {
+        if ( NULL != p->clock ) {
+            const uint32_t dt = p->clock() - t0; /*wrap-around safe*/
+
+            p->ticks[ s ] += (uint64_t)dt;
+            if ( dt > p->maxTicks[ s ] ) {
+                p->maxTicks[ s ] = dt;
+            }
+        }
+        ++p->calls[ s ];
+    }
+}
+/*============================================================================*/
+static void qFIS_ProfileRules( const qFIS_t * const f )
+{
+    qFIS_Profile_t * const p = f->profile;
+
+    if ( ( NULL != p ) && ( p->nRules == f->nRules ) && ( p->nRules > 0U ) ) {
+        size_t j;
+
+        /*the type-2 inference takes precedence over the sparse one and does
+        not update the active set, its upper strengths are in wi*/
+        if ( ( NULL == f->lowMF ) && ( NULL != f->rStart ) ) {
+            /*only the active rules have a non-zero strength, and the first
+            nKept of them were kept from the previous inference without
+            being evaluated*/
+            for ( j = f->nKept ; j < f->nActive ; ++j ) {
+                const size_t r = f->rActive[ j ];
+
+                ++p->fired[ r ];
+                p->strength[ r ] += f->wi[ r ];
+            }
+        }
+        else {
+            for ( j = 0U ; j < f->nRules ; ++j ) {
+                if ( f->wi[ j ] > 0.0F ) {
+                    ++p->fired[ j ];
+                    p->strength[ j ] += f->wi[ j ];
+                }
+            }
+        }
+        ++p->inferences;
+    }
+}
+/*============================================================================*/
+#endif
+static float qFIS_GetNextX( const float init,
+                            const float res,
+                            const size_t i )
+{
+    /*cstat -CERT-FLP36-C*/
+    return init + ( ( (float)i + 0.5F )*res );
     /*cstat +CERT-FLP36-C*/
 }
 /*============================================================================*/
@@ -898,23 +2352,22 @@ static float qFIS_TriMF( const qFIS_IO_Base_t * const in,
                          const float *p,
                          const size_t n )
 {
-    float a, b, c, tmp;
+    float a, b, c;
     float x = in[ 0 ].value;
     (void)n;
 
     a = p[ 0 ];
     b = p[ 1 ];
     c = p[ 2 ];
-    tmp = qFIS_Min( ( x - a )/( b - a ) , ( c - x )/( c - b ) );
 
-    return qFIS_Max( tmp , 0.0F );
+    return qFIS_Min( qFIS_Ramp( x - a, b - a ), qFIS_Ramp( c - x, c - b ) );
 }
 /*============================================================================*/
 static float qFIS_TrapMF( const qFIS_IO_Base_t * const in,
                           const float *p,
                           const size_t n )
 {
-    float a, b, c, d, tmp;
+    float a, b, c, d;
     float x = in[ 0 ].value;
     (void)n;
 
@@ -922,10 +2375,8 @@ static float qFIS_TrapMF( const qFIS_IO_Base_t * const in,
     b = p[ 1 ];
     c = p[ 2 ];
     d = p[ 3 ];
-    tmp = qFIS_Min( ( x - a )/( b - a ) , 1.0F );
-    tmp = qFIS_Min( tmp, ( d - x )/( d - c ) ) ;
 
-    return qFIS_Max( tmp , 0.0F );
+    return qFIS_Min( qFIS_Ramp( x - a, b - a ), qFIS_Ramp( d - x, d - c ) );
 }
 /*============================================================================*/
 static float qFIS_GBellMF( const qFIS_IO_Base_t * const in,
@@ -1173,7 +2624,7 @@ static float qFIS_LinZMF( const qFIS_IO_Base_t * const in,
             y = 0.0F;
         }
         else {
-            y = ( a - x )/( a - b );
+            y = ( b - x )/( b - a );
         }
     }
     else if ( qFFMath_IsEqual( a, b ) ) {
@@ -1352,11 +2803,16 @@ static float qFIS_LinearMF( const qFIS_IO_Base_t * const in,
                             const float *p,
                             const size_t n )
 {
+    /*in points to the array of inputs, that are larger than the base*/
+    /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    /*cppcheck-suppress misra-c2012-11.3 */
+    const qFIS_Input_t * const x = (const qFIS_Input_t *)in;
+    /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
     float px = 0.0F;
     size_t i;
 
     for ( i = 0U ; i < n ; ++i ) {
-        px += in[ i ].value*p[ i ];
+        px += x[ i ].b.value*p[ i ];
     }
     px += p[ i ];
 
@@ -1402,3 +2858,21 @@ static float qFIS_Bound( float y,
     return y;
 }
 /*============================================================================*/
+static float qFIS_Ramp( const float num,
+                        const float den )
+{
+    float y;
+    /*num/den bounded to [0,1], a vertical side ( den = 0 ) is one from num = 0*/
+    if ( num >= den ) {
+        y = 1.0F;
+    }
+    else if ( num <= 0.0F ) {
+        y = 0.0F;
+    }
+    else {
+        y = num/den;
+    }
+
+    return y;
+}
+/*============================================================================*/
@@ -0,0 +1,1476 @@
+/*!
+ * @file qfisfp16.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ **/
+
+#include "qfisfp16.h"
+
+typedef qFP16_t (*qFISFP16_FuzzyOperator_t)( const qFP16_t a, const qFP16_t b );
+
+static qFP16_t qFISFP16_TriMF( const qFISFP16_IO_Base_t * const in,
+                               const qFP16_t *p,
+                               const size_t n );
+static qFP16_t qFISFP16_TrapMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n );
+static qFP16_t qFISFP16_GBellMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n );
+static qFP16_t qFISFP16_GaussMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n );
+static qFP16_t qFISFP16_Gauss2MF( const qFISFP16_IO_Base_t * const in,
+                                  const qFP16_t *p,
+                                  const size_t n );
+static qFP16_t qFISFP16_SigMF( const qFISFP16_IO_Base_t * const in,
+                               const qFP16_t *p,
+                               const size_t n );
+static qFP16_t qFISFP16_TSigMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n );
+static qFP16_t qFISFP16_DSigMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n );
+static qFP16_t qFISFP16_PSigMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n );
+static qFP16_t qFISFP16_SMF( const qFISFP16_IO_Base_t * const in,
+                             const qFP16_t *p,
+                             const size_t n );
+static qFP16_t qFISFP16_TSMF( const qFISFP16_IO_Base_t * const in,
+                              const qFP16_t *p,
+                              const size_t n );
+static qFP16_t qFISFP16_ZMF( const qFISFP16_IO_Base_t * const in,
+                             const qFP16_t *p,
+                             const size_t n );
+static qFP16_t qFISFP16_LinSMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n );
+static qFP16_t qFISFP16_LinZMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n );
+static qFP16_t qFISFP16_TZMF( const qFISFP16_IO_Base_t * const in,
+                              const qFP16_t *p,
+                              const size_t n );
+static qFP16_t qFISFP16_PiMF( const qFISFP16_IO_Base_t * const in,
+                              const qFP16_t *p,
+                              const size_t n );
+static qFP16_t qFISFP16_SingletonMF( const qFISFP16_IO_Base_t * const in,
+                                     const qFP16_t *p,
+                                     const size_t n );
+static qFP16_t qFISFP16_ConcaveMF( const qFISFP16_IO_Base_t * const in,
+                                   const qFP16_t *p,
+                                   const size_t n );
+static qFP16_t qFISFP16_TConcaveMF( const qFISFP16_IO_Base_t * const in,
+                                    const qFP16_t *p,
+                                    const size_t n );
+static qFP16_t qFISFP16_SpikeMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n );
+static qFP16_t qFISFP16_TLinSMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n );
+static qFP16_t qFISFP16_TLinZMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n );
+static qFP16_t qFISFP16_RectangleMF( const qFISFP16_IO_Base_t * const in,
+                                     const qFP16_t *p,
+                                     const size_t n );
+static qFP16_t qFISFP16_CosineMF( const qFISFP16_IO_Base_t * const in,
+                                  const qFP16_t *p,
+                                  const size_t n );
+static qFP16_t qFISFP16_ConstantMF( const qFISFP16_IO_Base_t * const in,
+                                    const qFP16_t *p,
+                                    const size_t n );
+static qFP16_t qFISFP16_LinearMF( const qFISFP16_IO_Base_t * const in,
+                                  const qFP16_t *p,
+                                  const size_t n );
+static qFP16_t qFISFP16_Min( const qFP16_t a,
+                             const qFP16_t b );
+static qFP16_t qFISFP16_Max( const qFP16_t a,
+                             const qFP16_t b );
+static qFP16_t qFISFP16_Prod( const qFP16_t a,
+                              const qFP16_t b );
+static qFP16_t qFISFP16_ProbOR( const qFP16_t a,
+                                const qFP16_t b );
+static qFP16_t qFISFP16_Sum( const qFP16_t a,
+                             const qFP16_t b );
+static qFP16_t qFISFP16_Bound( qFP16_t y,
+                               const qFP16_t yMin,
+                               const qFP16_t yMax );
+static qFP16_t qFISFP16_SatMul( const qFP16_t a,
+                                const qFP16_t b );
+static qFP16_t qFISFP16_SatDiv( const qFP16_t a,
+                                const qFP16_t b );
+static qFP16_t qFISFP16_Ramp( const qFP16_t num,
+                              const qFP16_t den );
+static qFP16_t qFISFP16_Logistic( const qFP16_t z );
+static qFP16_t qFISFP16_Sqrt( const qFP16_t x );
+static qFP16_t qFISFP16_ParseFuzzValue( qFISFP16_MF_t * const mfIO,
+                                        qFIS_Rules_t index );
+static qFISFP16_FuzzyOperator_t qFISFP16_GetFuzzOperator( const qFISFP16_t * const f );
+static qFP16_t qFISFP16_GetNextT( const size_t i,
+                                  const size_t n );
+static void qFISFP16_SetNextX( qFISFP16_Output_t * const o,
+                               const size_t i,
+                               const size_t n );
+static size_t qFISFP16_InferenceAntecedent( struct _qFISFP16_s * const f,
+                                            size_t i );
+static size_t qFISFP16_InferenceConsequent( struct _qFISFP16_s * const f,
+                                            size_t i );
+static size_t qFISFP16_InferenceReachEnd( struct _qFISFP16_s * const f,
+                                          size_t i );
+static size_t qFISFP16_AggregationFindConsequent( struct _qFISFP16_s * const f,
+                                                  size_t i );
+static qFP16_t qFISFP16_DeFuzz_Centroid( qFISFP16_Output_t * const o,
+                                         const qFIS_DeFuzzState_t stage );
+static qFP16_t qFISFP16_DeFuzz_Bisector( qFISFP16_Output_t * const o,
+                                         const qFIS_DeFuzzState_t stage );
+static qFP16_t qFISFP16_DeFuzz_LOM( qFISFP16_Output_t * const o,
+                                    const qFIS_DeFuzzState_t stage );
+static qFP16_t qFISFP16_DeFuzz_SOM( qFISFP16_Output_t * const o,
+                                    const qFIS_DeFuzzState_t stage );
+static qFP16_t qFISFP16_DeFuzz_MOM( qFISFP16_Output_t * const o,
+                                    const qFIS_DeFuzzState_t stage );
+static qFP16_t qFISFP16_DeFuzz_WtAverage( qFISFP16_Output_t * const o,
+                                          const qFIS_DeFuzzState_t stage );
+static qFP16_t qFISFP16_DeFuzz_WtSum( qFISFP16_Output_t * const o,
+                                      const qFIS_DeFuzzState_t stage );
+static void qFISFP16_Aggregate( qFISFP16_t * const f );
+
+#define QFISFP16_INFERENCE_ERROR        ( 0U )
+/*sums of up to nPoints values in [0,1] should fit in the Q16.16 format*/
+#define QFISFP16_MAX_EVAL_POINTS        ( 16383 )
+
+/*! @cond  */
+/*beyond this distance, the gaussian is below the Q16.16 resolution*/
+static const qFP16_t qFISFP16_GaussArgMax = 393216; /* [ 6 ] */
+static const qFP16_t qFISFP16_Ten = 655360;         /* [ 10 ] */
+/*! @endcond  */
+
+/*============================================================================*/
+int qFISFP16_SetParameter( qFISFP16_t * const f,
+                           const qFIS_Parameter_t p,
+                           const qFIS_ParamValue_t x )
+{
+    int retVal = 0;
+    typedef qFP16_t (*methods_fcn)( const qFP16_t a, const qFP16_t b );
+    static const methods_fcn method[ 5 ] = { &qFISFP16_Min, &qFISFP16_Prod,
+                                             &qFISFP16_Max, &qFISFP16_ProbOR,
+                                             &qFISFP16_Sum
+                                           };
+
+    if ( NULL != f ) {
+        switch ( p ) {
+            case qFIS_Implication:
+                if ( x <= qFIS_PROD ) {
+                    /*cppcheck-suppress misra-c2012-11.1 */
+                    f->implicate = method[ x ];
+                    retVal = 1;
+                }
+                break;
+            case qFIS_Aggregation:
+                if ( ( x >= qFIS_MAX ) && ( x <= qFIS_SUM ) ) {
+                    /*cppcheck-suppress misra-c2012-11.1 */
+                    f->aggregate = method[ x ];
+                    retVal = 1;
+                }
+                break;
+            case qFIS_AND:
+                if ( x <= qFIS_PROD ) {
+                    /*cppcheck-suppress misra-c2012-11.1 */
+                    f->andOp = method[ x ];
+                    retVal = 1;
+                }
+                break;
+            case qFIS_OR:
+                if ( ( x >= qFIS_MAX ) && ( x <= qFIS_PROBOR ) ) {
+                    /*cppcheck-suppress misra-c2012-11.1 */
+                    f->orOp = method[ x ];
+                    retVal = 1;
+                }
+                break;
+            case qFIS_EvalPoints:
+                if ( ( (int)x >= 20 ) && ( (int)x <= QFISFP16_MAX_EVAL_POINTS ) ) {
+                    f->nPoints = (size_t)x;
+                    retVal = 1;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_SetDeFuzzMethod( qFISFP16_t * const f,
+                              qFIS_DeFuzz_Method_t m )
+{
+    int retVal = 0;
+
+    static const qFISFP16_DeFuzz_Fcn_t method[ _NUM_DFUZZ ] = { &qFISFP16_DeFuzz_Centroid,
+                                                                &qFISFP16_DeFuzz_Bisector,
+                                                                &qFISFP16_DeFuzz_MOM,
+                                                                &qFISFP16_DeFuzz_LOM,
+                                                                &qFISFP16_DeFuzz_SOM,
+                                                                &qFISFP16_DeFuzz_WtAverage,
+                                                                &qFISFP16_DeFuzz_WtSum
+                                                              };
+
+    if ( ( NULL != f ) && ( m < _NUM_DFUZZ ) ) {
+        if ( ( ( Mamdani == f->type ) && ( m <= som ) ) ||
+             ( ( Sugeno == f->type ) && ( m >= wtaver ) && ( m <= wtsum ) ) ||
+             ( ( Tsukamoto == f->type ) && ( wtaver == m ) )) {
+            /*cppcheck-suppress misra-c2012-11.1 */
+            f->deFuzz = method[ m ];
+            retVal = 1;
+        }
+    }
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_Setup( qFISFP16_t * const f,
+                    const qFIS_Type_t t,
+                    qFISFP16_Input_t * const inputs,
+                    const size_t ni,
+                    qFISFP16_Output_t * const outputs,
+                    const size_t no,
+                    qFISFP16_MF_t * const mf_inputs,
+                    const size_t nmi,
+                    qFISFP16_MF_t *const mf_outputs,
+                    const size_t nmo,
+                    const qFIS_Rules_t * const r,
+                    qFP16_t *wi,
+                    const size_t n )
+{
+    int retVal = 0;
+
+    if ( ( NULL != f ) && ( t <= Tsukamoto ) && ( NULL != r ) && ( NULL != wi ) ) {
+        size_t i;
+
+        f->nInputs = ni/sizeof(qFISFP16_Input_t);
+        f->nOutputs = no/sizeof(qFISFP16_Output_t);
+        f->nMFInputs = nmi/sizeof(qFISFP16_MF_t);
+        f->nMFOutputs = nmo/sizeof(qFISFP16_MF_t);
+        f->input = inputs;
+        f->output = outputs;
+        f->inMF = mf_inputs;
+        f->outMF = mf_outputs;
+        f->wi = wi;
+        f->rules = r;
+        f->nRules = n;
+        f->type = t;
+        retVal += qFISFP16_SetParameter( f, qFIS_EvalPoints, (qFIS_ParamValue_t)100 );
+        retVal += qFISFP16_SetParameter( f, qFIS_AND, qFIS_MIN );
+        retVal += qFISFP16_SetParameter( f, qFIS_OR, qFIS_MAX );
+        retVal += qFISFP16_SetParameter( f, qFIS_Implication, qFIS_MIN );
+        retVal += qFISFP16_SetParameter( f, qFIS_Aggregation, qFIS_MAX );
+        /*cppcheck-suppress misra-c2012-10.6 */
+        retVal = ( 5 == retVal ) ? 1 : 0;
+        f->deFuzz = ( Mamdani == t ) ? &qFISFP16_DeFuzz_Centroid
+                                     : &qFISFP16_DeFuzz_WtAverage;
+        f->ruleWeight = NULL;
+        for ( i = 0U ; i < f->nOutputs ; ++i ) {
+            f->output[ i ].owner = f;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_InputSetup( qFISFP16_Input_t * const v,
+                         const qFIS_Tag_t t,
+                         const qFP16_t min,
+                         const qFP16_t max )
+{
+    int retVal = 0;
+
+    if ( ( NULL != v ) && ( t >= 0 ) && ( max > min ) ) {
+        v[ t ].b.min = min;
+        v[ t ].b.max = max;
+        v[ t ].b.value = min;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_OutputSetup( qFISFP16_Output_t * const v,
+                          const qFIS_Tag_t t,
+                          const qFP16_t min,
+                          const qFP16_t max )
+{
+    int retVal = 0;
+
+    if ( ( NULL != v ) && ( t >= 0 ) && ( max > min ) ) {
+        v[ t ].data[ 0 ] = 0;
+        v[ t ].data[ 1 ] = 0;
+        v[ t ].data[ 2 ] = 0;
+        v[ t ].data[ 3 ] = 0;
+        v[ t ].t = 0;
+        v[ t ].x = 0;
+        v[ t ].y = 0;
+        v[ t ].b.min = min;
+        v[ t ].b.max = max;
+        v[ t ].b.value = min;
+        v[ t ].xag = NULL;
+        v[ t ].yag = NULL;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_SetInput( qFISFP16_Input_t * const v,
+                       const qFIS_Tag_t t,
+                       const qFP16_t value )
+{
+    int retVal = 0;
+
+    if ( ( NULL != v ) && ( t >= 0 ) ) {
+        v[ t ].b.value = value;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+qFP16_t qFISFP16_GetOutput( const qFISFP16_Output_t * const v,
+                            const qFIS_Tag_t t )
+{
+    qFP16_t retVal = 0;
+
+    if ( ( NULL != v ) && ( t >= 0 ) ) {
+        retVal = v[ t ].b.value;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_SetMF( qFISFP16_MF_t * const m,
+                    const qFIS_Tag_t io,
+                    const qFIS_Tag_t mf,
+                    const qFIS_MF_Name_t s,
+                    qFISFP16_MF_Fcn_t custom_mf,
+                    const qFP16_t *cp,
+                    const qFP16_t h )
+{
+    int retVal = 0;
+    static const qFISFP16_MF_Fcn_t fShape[ _NUM_MFS ] = { &qFISFP16_ConstantMF,
+    /* Conventional membership functions, applies on any antecedent*/
+    &qFISFP16_TriMF, &qFISFP16_TrapMF, &qFISFP16_GBellMF, &qFISFP16_GaussMF,
+    &qFISFP16_Gauss2MF, &qFISFP16_SigMF, &qFISFP16_DSigMF, &qFISFP16_PSigMF,
+    &qFISFP16_PiMF, &qFISFP16_SMF, &qFISFP16_ZMF, &qFISFP16_SingletonMF,
+    &qFISFP16_ConcaveMF, &qFISFP16_SpikeMF, &qFISFP16_LinSMF,
+    &qFISFP16_LinZMF, &qFISFP16_RectangleMF, &qFISFP16_CosineMF,
+    /* Only for Sugeno consequents*/
+    &qFISFP16_ConstantMF, &qFISFP16_LinearMF,
+    /* Only for Tsukamoto consequents*/
+    &qFISFP16_TLinSMF, &qFISFP16_TLinZMF, &qFISFP16_TConcaveMF,
+    &qFISFP16_TSigMF, &qFISFP16_TSMF, &qFISFP16_TZMF
+    };
+
+    if ( ( NULL != m ) && ( io >= 0 ) && ( mf >= 0 ) && ( s < _NUM_MFS ) ) {
+        if ( NULL != custom_mf ) {
+            m[ mf ].shape = custom_mf; /*user-defined membership function*/
+        }
+        else {
+            /*cppcheck-suppress misra-c2012-11.1 */
+            m[ mf ].shape = fShape[ s ];
+        }
+        m[ mf ].index = (size_t)io;
+        m[ mf ].points = cp;
+        m[ mf ].fx = 0;
+        m[ mf ].h = qFISFP16_Bound( h, 0, qFP16.one );
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_StoreAggregatedRegion( qFISFP16_Output_t * const o,
+                                    const qFIS_Tag_t t,
+                                    qFP16_t *x,
+                                    qFP16_t *y,
+                                    const size_t n )
+{
+    int retVal = 0;
+
+    if ( ( NULL != o ) && ( t >= 0 ) && ( NULL != x ) && ( NULL != y ) ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        /*cppcheck-suppress misra-c2012-11.5 */
+        qFISFP16_t *f = (qFISFP16_t *)o[ t ].owner;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        if ( n >= f->nPoints ) {
+            o[ t ].xag = x;
+            o[ t ].yag = y;
+            retVal = 1;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_Fuzzify( qFISFP16_t * const f )
+{
+    int retVal = 0;
+
+    if ( NULL != f ) {
+        size_t i;
+
+        for ( i = 0U ; i < f->nInputs ; ++i ) {
+            f->input[ i ].b.value = qFISFP16_Bound( f->input[ i ].b.value,
+                                                    f->input[ i ].b.min,
+                                                    f->input[ i ].b.max );
+        }
+        for ( i = 0U ; i < f->nMFInputs ; ++i ) {
+            qFISFP16_MF_t *mf = &f->inMF[ i ];
+
+            mf->fx = qFISFP16_SatMul( mf->h, mf->shape( &f->input[ mf->index ].b,
+                                                        mf->points,
+                                                        1U ) );
+        }
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_ParseFuzzValue( qFISFP16_MF_t * const mfIO,
+                                        qFIS_Rules_t index )
+{
+    /*cstat -CERT-STR34-C*/
+    uint8_t neg = ( index < 0 ) ? 1U : 0U ;
+    /*cstat +CERT-STR34-C*/
+    qFP16_t y;
+
+    if ( 0U != neg ) {
+        index = -index;
+    }
+    /*cstat -CERT-INT32-C_a -CERT-STR34-C*/
+    y = qFISFP16_Bound( mfIO[ index - 1 ].fx, 0, qFP16.one );
+    /*cstat +CERT-INT32-C_a +CERT-STR34-C*/
+    /*cppcheck-suppress misra-c2012-12.1 */
+    y = ( 0U != neg ) ? ( qFP16.one - y ) : y ;
+
+    return y;
+}
+/*============================================================================*/
+static qFISFP16_FuzzyOperator_t qFISFP16_GetFuzzOperator( const qFISFP16_t * const f )
+{
+    qFISFP16_FuzzyOperator_t oper;
+
+    switch ( f->lastConnector ) {
+        case _QFIS_AND:
+            oper = f->andOp;
+            break;
+        case _QFIS_OR:
+            oper = f->orOp;
+            break;
+        default:
+            oper = &qFISFP16_Sum;
+            break;
+    }
+
+    return oper;
+}
+/*============================================================================*/
+static size_t qFISFP16_InferenceAntecedent( struct _qFISFP16_s * const f,
+                                            size_t i )
+{
+    qFIS_Rules_t inIndex, MFInIndex, connector;
+    qFISFP16_FuzzyOperator_t op;
+    /*cstat -CERT-INT30-C_a*/
+    inIndex = f->rules[ i ];
+    MFInIndex = f->rules[ i + 1U ];
+    connector = f->rules[ i + 2U ];
+    /*cstat -CERT-INT30-C_a*/
+    op = qFISFP16_GetFuzzOperator( f );
+    f->rStrength = op( f->rStrength, qFISFP16_ParseFuzzValue( f->inMF, MFInIndex ) );
+
+    if ( ( inIndex < 0 ) || ( (size_t)inIndex > f->nInputs ) ) {
+        i = QFISFP16_INFERENCE_ERROR;
+    }
+    else {
+        if ( ( _QFIS_AND == connector ) || ( _QFIS_OR == connector ) ) {
+            f->lastConnector = connector;
+            f->inferenceState = &qFISFP16_InferenceAntecedent;
+            i += 2U;
+        }
+        else if ( _QFIS_THEN == connector ) {
+            f->inferenceState = &qFISFP16_InferenceReachEnd;
+            i += 2U;
+        }
+        else {
+            i = QFISFP16_INFERENCE_ERROR;
+        }
+    }
+
+    return i;
+}
+/*============================================================================*/
+static size_t qFISFP16_InferenceReachEnd( struct _qFISFP16_s * const f,
+                                          size_t i )
+{
+    qFIS_Rules_t  connector;
+
+    connector = ( f->nOutputs > 1U )? f->rules[ i + 2U ] : -1;
+    i += 2U;
+    if ( _QFIS_AND != connector ) {
+        f->inferenceState = &qFISFP16_InferenceAntecedent;
+        f->lastConnector = -1;
+        f->wi[ f->ruleCount ] = f->rStrength;
+        if ( NULL != f->ruleWeight ) {
+            f->wi[ f->ruleCount ] = qFP16_Mul( f->wi[ f->ruleCount ],
+                                               qFISFP16_Bound( f->ruleWeight[ f->ruleCount ], 0, qFP16.one ) );
+        }
+        f->rStrength = 0;
+        ++f->ruleCount;
+        --i;
+    }
+
+    return i;
+}
+/*============================================================================*/
+static size_t qFISFP16_AggregationFindConsequent( struct _qFISFP16_s * const f,
+                                                  size_t i )
+{
+    while ( _QFIS_THEN != f->rules[ i++ ] ) {}
+    f->aggregationState = &qFISFP16_InferenceConsequent;
+    /*cstat -MISRAC2012-Rule-2.2_c*/
+    return --i; /*!ok*/
+    /*cstat +MISRAC2012-Rule-2.2_c*/
+}
+/*============================================================================*/
+static size_t qFISFP16_InferenceConsequent( struct _qFISFP16_s * const f,
+                                            size_t i )
+{
+    qFIS_Rules_t outIndex, MFOutIndex, connector;
+    uint8_t neg = 0U;
+
+    outIndex = f->rules[ i ];
+    MFOutIndex = f->rules[ i + 1U ];
+    connector = ( f->nOutputs > 1U )? f->rules[ i + 2U ] : -1;
+    if ( MFOutIndex < 0 ) {
+        MFOutIndex = -MFOutIndex;
+        neg = 1U;
+    }
+    MFOutIndex -= 1;
+
+    if ( f->wi[ f->ruleCount ] > 0 ) {
+        /*cstat -CERT-STR34-C*/
+        qFISFP16_Output_t *o = &f->output[ outIndex ];
+        qFISFP16_MF_t *m = &f->outMF[ MFOutIndex ];
+        /*cstat +CERT-STR34-C*/
+        if ( Mamdani == f->type ) {
+            qFP16_t v;
+
+            v = qFISFP16_Bound( m->shape( &o->b, m->points, 1U ), 0, qFP16.one );
+            v = qFP16_Mul( m->h, v );
+            /*cppcheck-suppress misra-c2012-12.1 */
+            v = ( 1U == neg )? ( qFP16.one - v ) : v;
+            o->y = f->aggregate( o->y, f->implicate( f->wi[ f->ruleCount ], v ) );
+        }
+        else { /* Sugeno and Tsukamoto*/
+            qFP16_t zi;
+            /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+            /*cppcheck-suppress misra-c2012-11.3 */
+            zi = m->shape( (qFISFP16_IO_Base_t*)f->input, m->points, f->nInputs );
+            /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+            o->data[ 0 ] = qFP16_Add( o->data[ 0 ], qFISFP16_SatMul( zi, f->wi[ f->ruleCount ] ) );
+            o->data[ 1 ] = qFP16_Add( o->data[ 1 ], f->wi[ f->ruleCount ] );
+        }
+    }
+
+    i += 2U;
+    if ( _QFIS_AND != connector ) {
+        f->aggregationState = &qFISFP16_AggregationFindConsequent;
+        ++f->ruleCount;
+        --i;
+    }
+
+    return i;
+}
+/*============================================================================*/
+static void qFISFP16_Aggregate( qFISFP16_t * const f )
+{
+    if ( ( NULL != f ) && ( QFIS_RULES_BEGIN == f->rules[ 0 ] ) ) {
+        size_t i = 1U;
+
+        f->aggregationState = &qFISFP16_AggregationFindConsequent;
+        f->ruleCount = 0U;
+        while ( ( _QFIS_RULES_END != f->rules[ i ] ) && ( f->ruleCount < f->nRules ) ) {
+            i = f->aggregationState( f, i );
+            if ( QFISFP16_INFERENCE_ERROR == i ) {
+                break;
+            }
+            ++i;
+        }
+    }
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_DeFuzz_Centroid( qFISFP16_Output_t * const o,
+                                         const qFIS_DeFuzzState_t stage )
+{
+    qFP16_t d = 0;
+
+    switch ( stage ) {
+        case DeFuzz_Compute:
+            /*the position is accumulated normalized to [0,1] to avoid overflow*/
+            o->data[ 0 ] += qFP16_Mul( o->t, o->y );
+            o->data[ 1 ] += o->y;
+            break;
+        case DeFuzz_Init:
+            o->data[ 0 ] = 0; /*store sum(t*y)*/
+            o->data[ 1 ] = 0; /*store sum(y)*/
+            break;
+        case DeFuzz_End:
+            if ( o->data[ 1 ] > 0 ) {
+                d = qFP16_Div( o->data[ 0 ], o->data[ 1 ] );
+            }
+            else {
+                d = qFP16.one_half;
+            }
+            d = o->b.min + qFP16_Mul( o->b.max - o->b.min, d );
+            break;
+        default:
+            break;
+    }
+
+    return d;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_DeFuzz_Bisector( qFISFP16_Output_t * const o,
+                                         const qFIS_DeFuzzState_t stage )
+{
+    size_t k;
+    qFP16_t d = 0;
+    qFISFP16_t *f;
+
+    switch ( stage ) {
+        case DeFuzz_Compute:
+            o->data[ 0 ] += o->y;
+            break;
+        case DeFuzz_Init:
+            o->data[ 0 ] = 0; /*store sum(y)*/
+            break;
+        case DeFuzz_End:
+            o->data[ 1 ] = 0;
+            /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+            /*cppcheck-suppress misra-c2012-11.5 */
+            f = (qFISFP16_t *)o->owner;
+            /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+            if ( o->data[ 0 ] > 0 ) {
+                for ( k = 0U ; k < f->nPoints ; ++k ) {
+                    o->y = 0;
+                    qFISFP16_SetNextX( o, k, f->nPoints );
+                    qFISFP16_Aggregate( f );
+                    o->data[ 1 ] += o->y;
+                    if ( o->data[ 1 ] >= ( o->data[ 0 ]/2 ) ) {
+                        break;
+                    }
+                }
+                d = o->x;
+            }
+            else {
+                d = o->b.min + ( ( o->b.max - o->b.min )/2 );
+            }
+            break;
+        default:
+            break;
+    }
+
+    return d;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_DeFuzz_LOM( qFISFP16_Output_t * const o,
+                                    const qFIS_DeFuzzState_t stage )
+{
+    qFP16_t d = 0;
+
+    switch ( stage ) {
+        case DeFuzz_Compute:
+            if ( o->y >= o->data[ 0 ] ) {
+                o->data[ 0 ] = o->y;
+                o->data[ 1 ] = o->x;
+            }
+            break;
+        case DeFuzz_Init:
+            o->data[ 0 ] = -qFP16.one; /*yMax*/
+            o->data[ 1 ] = o->b.max; /*xLargest*/
+            break;
+        case DeFuzz_End:
+            d = o->data[ 1 ];
+            break;
+        default:
+            break;
+    }
+
+    return d;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_DeFuzz_SOM( qFISFP16_Output_t * const o,
+                                    const qFIS_DeFuzzState_t stage )
+{
+    qFP16_t d = 0;
+
+    switch ( stage ) {
+        case DeFuzz_Compute:
+            if ( o->y > o->data[ 0 ] ) {
+                o->data[ 0 ] = o->y;
+                o->data[ 1 ] = o->x;
+            }
+            break;
+        case DeFuzz_Init:
+            o->data[ 0 ] = -qFP16.one; /*yMax*/
+            o->data[ 1 ] = o->b.min; /*xSmallest*/
+            break;
+        case DeFuzz_End:
+            d = o->data[ 1 ];
+            break;
+        default:
+            break;
+    }
+
+    return d;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_DeFuzz_MOM( qFISFP16_Output_t * const o,
+                                    const qFIS_DeFuzzState_t stage )
+{
+    qFP16_t d = 0;
+
+    switch ( stage ) {
+        case DeFuzz_Compute:
+            if ( o->y > o->data[ 0 ] ) {
+                o->data[ 0 ] = o->y;
+                o->data[ 1 ] = o->x;
+                o->data[ 2 ] = o->x;
+                o->data[ 3 ] = qFP16.one;
+            }
+            else if ( ( o->y == o->data[ 0 ] ) && ( o->data[ 3 ] > 0 ) ) {
+                o->data[ 2 ] = o->x;
+            }
+            else if ( o->y < o->data[ 0 ] ) {
+                o->data[ 3 ] = -qFP16.one;
+            }
+            else {
+                /*nothing to do*/
+            }
+            break;
+        case DeFuzz_Init:
+            o->data[ 0 ] = -qFP16.one; /* yMax */
+            o->data[ 1 ] = o->b.min; /*xSmallest*/
+            o->data[ 2 ] = o->b.max; /*xLargest*/
+            o->data[ 3 ] = -qFP16.one; /*sp*/
+            break;
+        case DeFuzz_End:
+            d = o->data[ 1 ] + ( ( o->data[ 2 ] - o->data[ 1 ] )/2 );
+            break;
+        default:
+            break;
+    }
+
+    return d;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_DeFuzz_WtAverage( qFISFP16_Output_t * const o,
+                                          const qFIS_DeFuzzState_t stage )
+{
+    qFP16_t d = 0;
+
+    if ( DeFuzz_End == stage ) {
+        if ( o->data[ 1 ] > 0 ) {
+            d = qFISFP16_SatDiv( o->data[ 0 ], o->data[ 1 ] );
+        }
+        else {
+            d = o->b.min + ( ( o->b.max - o->b.min )/2 );
+        }
+    }
+
+    return d;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_DeFuzz_WtSum( qFISFP16_Output_t * const o,
+                                      const qFIS_DeFuzzState_t stage )
+{
+    qFP16_t d = 0;
+
+    if ( DeFuzz_End == stage ) {
+        d = o->data[ 0 ];
+    }
+
+    return d;
+}
+/*============================================================================*/
+int qFISFP16_DeFuzzify( qFISFP16_t * const f )
+{
+    int retVal = 0;
+
+    if ( NULL != f ) {
+        size_t i;
+
+        for ( i = 0U; i < f->nOutputs ; ++i ) {
+            (void)f->deFuzz( &f->output[ i ] , DeFuzz_Init );
+        }
+
+        if ( Mamdani == f->type  ) {
+            size_t k;
+
+            for ( k = 0U ; k < f->nPoints ; ++k ) {
+                for ( i = 0U; i < f->nOutputs ; ++i ) { /* initialize*/
+                    f->output[ i ].y = 0;
+                    qFISFP16_SetNextX( &f->output[ i ], k, f->nPoints );
+                }
+                qFISFP16_Aggregate( f );
+                for ( i = 0U; i < f->nOutputs ; ++i ) {
+                    (void)f->deFuzz( &f->output[ i ] , DeFuzz_Compute );
+                    if ( NULL != f->output[ i ].xag ) { /*store aggregated*/
+                        f->output[ i ].xag[ k ] = f->output[ i ].x;
+                        f->output[ i ].yag[ k ] = f->output[ i ].y;
+                    }
+                }
+            }
+        }
+        else { /*Sugeno and Tsukamoto systems*/
+            for ( i = 0U; i < f->nOutputs ; ++i ) { /* initialize*/
+                f->output[ i ].data[ 0 ] = 0; /*store sum zi*wi*/
+                f->output[ i ].data[ 1 ] = 0; /*store sum wi*/
+            }
+            qFISFP16_Aggregate( f );
+        }
+
+        for ( i = 0U; i < f->nOutputs ; ++i ) {
+            f->output[ i ].b.value = f->deFuzz( &f->output[ i ] , DeFuzz_End );
+            f->output[ i ].b.value = qFISFP16_Bound( f->output[ i ].b.value,
+                                                     f->output[ i ].b.min,
+                                                     f->output[ i ].b.max );
+        }
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_SetRuleWeights( qFISFP16_t * const f,
+                             qFP16_t *rWeights )
+{
+    int retVal = 0;
+
+    if ( NULL != f ) {
+        f->ruleWeight = rWeights;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFISFP16_Inference( qFISFP16_t * const f )
+{
+    int retVal = 0;
+
+    if ( NULL != f  ) {
+        size_t i = 0U;
+
+        if ( QFIS_RULES_BEGIN == f->rules[ 0 ] ) {
+            f->inferenceState = &qFISFP16_InferenceAntecedent;
+            f->rStrength = 0;
+            f->lastConnector = -1;
+            f->ruleCount = 0U;
+            i = 1U;
+            while ( ( _QFIS_RULES_END != f->rules[ i ] ) && ( f->ruleCount < f->nRules ) ) {
+                i = f->inferenceState( f, i );
+                if ( QFISFP16_INFERENCE_ERROR == i ) {
+                    break;
+                }
+                ++i;
+            }
+        }
+        if ( ( _QFIS_RULES_END == f->rules[ i ] ) && ( f->ruleCount == f->nRules) ) {
+            retVal = 1;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_GetNextT( const size_t i,
+                                  const size_t n )
+{
+    /*( i + 0.5 )/n computed with integer arithmetic and rounding*/
+    /*cstat -CERT-INT30-C_a*/
+    return (qFP16_t)( ( ( ( ( 2U*(uint32_t)i ) + 1U )*32768U ) + ( (uint32_t)n/2U ) )/(uint32_t)n );
+    /*cstat +CERT-INT30-C_a*/
+}
+/*============================================================================*/
+static void qFISFP16_SetNextX( qFISFP16_Output_t * const o,
+                               const size_t i,
+                               const size_t n )
+{
+    o->t = qFISFP16_GetNextT( i, n );
+    o->x = o->b.min + qFP16_Mul( o->b.max - o->b.min, o->t );
+    o->b.value = o->x;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_TriMF( const qFISFP16_IO_Base_t * const in,
+                               const qFP16_t *p,
+                               const size_t n )
+{
+    qFP16_t a, b, c;
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+    c = p[ 2 ];
+
+    return qFISFP16_Min( qFISFP16_Ramp( x - a, b - a ),
+                         qFISFP16_Ramp( c - x, c - b ) );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_TrapMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n )
+{
+    qFP16_t a, b, c, d;
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+    c = p[ 2 ];
+    d = p[ 3 ];
+
+    return qFISFP16_Min( qFISFP16_Ramp( x - a, b - a ),
+                         qFISFP16_Ramp( d - x, d - c ) );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_GBellMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n )
+{
+    qFP16_t a, b, c, r, y = 0;
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+    c = p[ 2 ];
+    r = qFP16_Abs( qFISFP16_SatDiv( x - c, a ) );
+    if ( 0 == r ) {
+        y = qFP16.one;
+    }
+    else {
+        r = qFP16_Pow( r, 2*b );
+        /*an overflowed power means a negligible membership value*/
+        if ( ( r >= 0 ) && ( r < ( qFP16.max - qFP16.one ) ) ) {
+            y = qFP16_Div( qFP16.one, qFP16.one + r );
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_GaussMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n )
+{
+    qFP16_t a, c, tmp, y = 0;
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    a = p[ 0 ];
+    c = p[ 1 ];
+    tmp = qFP16_Abs( qFISFP16_SatDiv( x - c, a ) );
+    if ( tmp < qFISFP16_GaussArgMax ) {
+        y = qFP16_Exp( -qFP16_Mul( qFP16.one_half, qFP16_Mul( tmp, tmp ) ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_Gauss2MF( const qFISFP16_IO_Base_t * const in,
+                                  const qFP16_t *p,
+                                  const size_t n )
+{
+    qFP16_t c1, c2, f1, f2;
+    qFP16_t x = in[ 0 ].value;
+
+    c1 = p[ 1 ];
+    c2 = p[ 3 ];
+    f1 = ( x <= c1 ) ? qFISFP16_GaussMF( in , p, n ) : qFP16.one;
+    f2 = ( x <= c2 ) ? qFISFP16_GaussMF( in , &p[ 2 ], n ) : qFP16.one;
+
+    return qFP16_Mul( f1, f2 );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_SigMF( const qFISFP16_IO_Base_t * const in,
+                               const qFP16_t *p,
+                               const size_t n )
+{
+    qFP16_t a, b;
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+
+    return qFISFP16_Logistic( qFISFP16_SatMul( a, x - b ) );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_TSigMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n )
+{
+    qFP16_t a, b, y;
+    qFP16_t x = in[ 0 ].value;
+    qFP16_t min = in[ 0 ].min;
+    qFP16_t max = in[ 0 ].max;
+    (void)n;
+
+    a = p[ 0 ]; /*slope*/
+    b = p[ 1 ]; /*inflection*/
+    if ( x >= qFP16.one ) {
+        y = ( a >= 0 ) ? max : min;
+    }
+    else if ( x <= 0 ) {
+        y = ( a >= 0 ) ? min : max;
+    }
+    else {
+        y = b - qFISFP16_SatDiv( qFP16_Log( qFP16_Div( qFP16.one, x ) - qFP16.one ), a );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_DSigMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n )
+{
+    return qFP16_Abs( qFISFP16_SigMF( in , p, n ) - qFISFP16_SigMF( in , &p[ 2 ], n ) );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_PSigMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n )
+{
+    return qFP16_Abs( qFP16_Mul( qFISFP16_SigMF( in , p, n ),
+                                 qFISFP16_SigMF( in , &p[ 2 ], n ) ) );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_SMF( const qFISFP16_IO_Base_t * const in,
+                             const qFP16_t *p,
+                             const size_t n )
+{
+    qFP16_t a, b, tmp, y;
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+    if ( x <= a ) {
+        y = 0;
+    }
+    else if ( x >= b ) {
+        y = qFP16.one;
+    }
+    else if ( x <= ( a + ( ( b - a )/2 ) ) ) {
+        tmp = qFP16_Div( x - a, b - a );
+        y = 2*qFP16_Mul( tmp, tmp );
+    }
+    else {
+        tmp = qFP16_Div( x - b, b - a );
+        y = qFP16.one - ( 2*qFP16_Mul( tmp, tmp ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_TSMF( const qFISFP16_IO_Base_t * const in,
+                              const qFP16_t *p,
+                              const size_t n )
+{
+    qFP16_t diff, a, b, ta, tb, ma, mb;
+    qFP16_t x = in[ 0 ].value;
+    qFISFP16_IO_Base_t tmp = { 0, 0, 0 };
+    (void)n;
+
+    a = p[ 0 ]; /*start*/
+    b = p[ 1 ]; /*end*/
+    diff = b - a;
+    diff = qFP16_Mul( qFP16.one_half, qFISFP16_SatMul( diff, diff ) );
+    ta = a + qFISFP16_Sqrt( qFISFP16_SatMul( x, diff ) );
+    tmp.value = ta;
+    ma = qFISFP16_SMF( &tmp, p, n );
+    tb = b + qFISFP16_Sqrt( qFISFP16_SatMul( qFP16.one - x, diff ) );
+    tmp.value = tb;
+    mb = qFISFP16_SMF( &tmp, p, n );
+
+    return ( qFP16_Abs( x - ma ) < qFP16_Abs( x - mb ) ) ? ta : tb;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_ZMF( const qFISFP16_IO_Base_t * const in,
+                             const qFP16_t *p,
+                             const size_t n )
+{
+    qFP16_t a, b, tmp, y;
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+    if ( x <= a ) {
+        y = qFP16.one;
+    }
+    else if ( x >= b ) {
+        y = 0;
+    }
+    else if ( x <= ( a + ( ( b - a )/2 ) ) ) {
+        tmp = qFP16_Div( x - a, b - a );
+        y = qFP16.one - ( 2*qFP16_Mul( tmp, tmp ) );
+    }
+    else {
+        tmp = qFP16_Div( x - b, b - a );
+        y = 2*qFP16_Mul( tmp, tmp );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_LinSMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n )
+{
+    qFP16_t a, b, y;
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+    if ( a <= b ) {
+        y = ( x < a ) ? 0 : qFISFP16_Ramp( x - a, b - a );
+    }
+    else {
+        y = 0;
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_LinZMF( const qFISFP16_IO_Base_t * const in,
+                                const qFP16_t *p,
+                                const size_t n )
+{
+    qFP16_t a, b, y;
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+    if ( a <= b ) {
+        y = ( x < a ) ? qFP16.one : ( qFP16.one - qFISFP16_Ramp( x - a, b - a ) );
+    }
+    else {
+        y = 0;
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_TZMF( const qFISFP16_IO_Base_t * const in,
+                              const qFP16_t *p,
+                              const size_t n )
+{
+    qFP16_t diff, a, b, ta, tb, ma, mb;
+    qFP16_t x = in[ 0 ].value;
+    qFISFP16_IO_Base_t tmp = { 0, 0, 0 };
+    (void)n;
+
+    a = p[ 0 ]; /*start*/
+    b = p[ 1 ]; /*end*/
+    diff = b - a;
+    diff = qFP16_Mul( qFP16.one_half, qFISFP16_SatMul( diff, diff ) );
+    ta = a + qFISFP16_Sqrt( qFISFP16_SatMul( qFP16.one - x, diff ) );
+    tmp.value = ta;
+    ma = qFISFP16_SMF( &tmp, p, n );
+    tb = b + qFISFP16_Sqrt( qFISFP16_SatMul( x, diff ) );
+    tmp.value = tb;
+    mb = qFISFP16_SMF( &tmp, p, n );
+
+    return ( qFP16_Abs( x - ma ) < qFP16_Abs( x - mb ) ) ? ta : tb;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_PiMF( const qFISFP16_IO_Base_t * const in,
+                              const qFP16_t *p,
+                              const size_t n )
+{
+    return qFP16_Abs( qFP16_Mul( qFISFP16_SMF( in , p, n ),
+                                 qFISFP16_ZMF( in , &p[ 2 ], n ) ) );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_SingletonMF( const qFISFP16_IO_Base_t * const in,
+                                     const qFP16_t *p,
+                                     const size_t n )
+{
+    qFP16_t x = in[ 0 ].value;
+    (void)n;
+
+    return ( x == p[ 0 ] ) ? qFP16.one : 0;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_ConcaveMF( const qFISFP16_IO_Base_t * const in,
+                                   const qFP16_t *p,
+                                   const size_t n )
+{
+    qFP16_t x = in[ 0 ].value;
+    qFP16_t i, e, y;
+    (void)n;
+
+    i = p[ 0 ];
+    e = p[ 1 ];
+    if ( ( i <= e ) && ( x < e ) ) {
+        y = qFISFP16_SatDiv( e - i, ( 2*e ) - i - x );
+    }
+    else if ( ( i > e ) && ( x > e ) ) {
+        y = qFISFP16_SatDiv( i - e, -( 2*e ) + i + x );
+    }
+    else {
+        y = qFP16.one;
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_TConcaveMF( const qFISFP16_IO_Base_t * const in,
+                                    const qFP16_t *p,
+                                    const size_t n )
+{
+    qFP16_t i, e;
+
+    i = p[ 0 ];
+    e = p[ 1 ];
+
+    return qFISFP16_SatDiv( i - e, qFISFP16_ConcaveMF( in, p, n ) ) + ( 2*e ) - i;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_SpikeMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n )
+{
+    qFP16_t x = in[ 0 ].value;
+    qFP16_t w, c, tmp;
+    (void)n;
+
+    w = p[ 0 ];
+    c = p[ 1 ];
+    tmp = qFP16_Abs( qFISFP16_SatDiv( qFISFP16_SatMul( qFISFP16_Ten, x - c ), w ) );
+
+    return qFP16_Exp( -tmp );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_TLinSMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n )
+{
+    qFP16_t x = in[ 0 ].value;
+    qFP16_t a, b;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+
+    return qFP16_Mul( b - a, x ) + a;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_TLinZMF( const qFISFP16_IO_Base_t * const in,
+                                 const qFP16_t *p,
+                                 const size_t n )
+{
+    qFP16_t x = in[ 0 ].value;
+    qFP16_t a, b;
+    (void)n;
+
+    a = p[ 0 ];
+    b = p[ 1 ];
+
+    return a - qFP16_Mul( a - b, x );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_RectangleMF( const qFISFP16_IO_Base_t * const in,
+                                     const qFP16_t *p,
+                                     const size_t n )
+{
+    qFP16_t x = in[ 0 ].value;
+    qFP16_t s, e;
+    (void)n;
+
+    s = p[ 0 ];
+    e = p[ 1 ];
+
+    return ( ( x >= s ) && ( x <= e ) ) ? qFP16.one : 0;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_CosineMF( const qFISFP16_IO_Base_t * const in,
+                                  const qFP16_t *p,
+                                  const size_t n )
+{
+    qFP16_t x = in[ 0 ].value;
+    qFP16_t c, w, y;
+    (void)n;
+
+    c = p[ 0 ];
+    w = p[ 1 ];
+    if ( ( x < ( c - ( w/2 ) ) ) || ( x > ( c + ( w/2 ) ) ) ) {
+        y = 0;
+    }
+    else {
+        y = qFP16_Div( qFP16_Mul( qFP16.f_2pi, x - c ), w );
+        y = qFP16_Mul( qFP16.one_half, qFP16.one + qFP16_Cos( y ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_ConstantMF( const qFISFP16_IO_Base_t * const in,
+                                    const qFP16_t *p,
+                                    const size_t n )
+{
+    (void)in;
+    (void)n;
+    return p[ 0 ];
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_LinearMF( const qFISFP16_IO_Base_t * const in,
+                                  const qFP16_t *p,
+                                  const size_t n )
+{
+    qFP16_t px = 0;
+    size_t i;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        px = qFP16_Add( px, qFISFP16_SatMul( in[ i ].value, p[ i ] ) );
+    }
+
+    return qFP16_Add( px, p[ i ] );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_Min( const qFP16_t a,
+                             const qFP16_t b )
+{
+    return qFISFP16_Bound( ( a < b ) ? a : b, 0, qFP16.one );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_Max( const qFP16_t a,
+                             const qFP16_t b )
+{
+    return qFISFP16_Bound( ( a > b ) ? a : b, 0, qFP16.one );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_Prod( const qFP16_t a,
+                              const qFP16_t b )
+{
+    return qFISFP16_Bound( qFP16_Mul( a, b ), 0, qFP16.one );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_ProbOR( const qFP16_t a,
+                                const qFP16_t b )
+{
+    return qFISFP16_Bound( a + b - qFP16_Mul( a, b ), 0, qFP16.one );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_Sum( const qFP16_t a,
+                             const qFP16_t b )
+{
+    return qFISFP16_Bound( a + b, 0, qFP16.one );
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_Bound( qFP16_t y,
+                               const qFP16_t yMin,
+                               const qFP16_t yMax )
+{
+    if ( y < yMin ) {
+        y = yMin;
+    }
+    else if ( y > yMax ) {
+        y = yMax;
+    }
+    else {
+        /*nothing to do*/
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_SatMul( const qFP16_t a,
+                                const qFP16_t b )
+{
+    qFP16_t y = qFP16_Mul( a, b );
+    /*resolve the overflow regardless of the qFP16 settings*/
+    if ( qFP16.overflow == y ) {
+        y = ( ( a >= 0 ) == ( b >= 0 ) ) ? qFP16.max : -qFP16.max;
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_SatDiv( const qFP16_t a,
+                                const qFP16_t b )
+{
+    qFP16_t y;
+
+    if ( 0 == b ) {
+        y = ( a >= 0 ) ? qFP16.max : -qFP16.max;
+    }
+    else {
+        y = qFP16_Div( a, b );
+        /*resolve the overflow regardless of the qFP16 settings*/
+        if ( qFP16.overflow == y ) {
+            y = ( ( a >= 0 ) == ( b >= 0 ) ) ? qFP16.max : -qFP16.max;
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_Ramp( const qFP16_t num,
+                              const qFP16_t den )
+{
+    qFP16_t y;
+    /*num/den bounded to [0,1] without the risk of overflow*/
+    if ( num >= den ) {
+        y = qFP16.one;
+    }
+    else if ( num <= 0 ) {
+        y = 0;
+    }
+    else {
+        y = qFP16_Div( num, den );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_Logistic( const qFP16_t z )
+{
+    qFP16_t e, y;
+    /*1/( 1 + exp( -z ) ) evaluated with a non-positive exponential argument
+    so that the intermediate values never overflow*/
+    if ( z >= 0 ) {
+        e = qFP16_Exp( -z );
+        y = qFP16_Div( qFP16.one, qFP16.one + e );
+    }
+    else {
+        e = qFP16_Exp( z );
+        y = qFP16_Div( e, qFP16.one + e );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qFISFP16_Sqrt( const qFP16_t x )
+{
+    return ( x > 0 ) ? qFP16_Sqrt( x ) : 0;
+}
+/*============================================================================*/
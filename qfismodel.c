@@ -0,0 +1,936 @@
+/*!
+ * @file qfismodel.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ **/
+
+#include "qfismodel.h"
+#include <string.h>
+
+/*! @cond  */
+#if ( FIS_RULE_ITEM_SIZE == 1 )
+    #define QFIS_MODEL_RULE_MAX     ( INT8_MAX )
+#else
+    #define QFIS_MODEL_RULE_MAX     ( INT16_MAX )
+#endif
+
+#define QFIS_MODEL_ALIGN( x )       ( ( (x) + 3U ) & ~( (size_t)3U ) )
+
+typedef struct
+{
+    size_t io;
+    size_t mf;
+    size_t params;
+    size_t weights;
+    size_t rules;
+    size_t end;
+} qFIS_ModelLayout_t;
+
+typedef enum
+{
+    QFIS_IMPORT_NONE = 0,
+    QFIS_IMPORT_SYSTEM,
+    QFIS_IMPORT_INPUT,
+    QFIS_IMPORT_OUTPUT,
+    QFIS_IMPORT_RULES
+} qFIS_ImportSection_t;
+
+typedef struct
+{
+    qFIS_ModelHeader_t h;       /*counts obtained from the counting pass*/
+    qFIS_ModelLayout_t l;
+    uint8_t *base;              /*NULL on the counting pass*/
+    size_t nInputs;             /*declared on the [System] section*/
+    size_t nOutputs;
+    size_t nRules;
+    size_t nIO;                 /*running counters*/
+    size_t nMF;
+    size_t nMFInputs;
+    size_t nParams;
+    size_t nWeights;
+    size_t nItems;
+    size_t ioMFs;               /*membership functions of the current I/O*/
+    size_t ioNumMFs;            /*declared membership functions of the current I/O*/
+    size_t io;                  /*index of the current I/O*/
+    qFIS_ImportSection_t section;
+    int weighted;
+} qFIS_Import_t;
+
+typedef struct
+{
+    const char *name;
+    uint8_t value;
+} qFIS_ImportName_t;
+/*! @endcond  */
+
+static size_t qFIS_ModelGetLayout( const qFIS_ModelHeader_t * const h,
+                                   qFIS_ModelLayout_t * const l );
+static size_t qFIS_ModelParamCount( const qFIS_ModelHeader_t * const h,
+                                    const uint8_t shape );
+static int qFIS_ModelCheckMFs( const qFIS_ModelHeader_t * const h,
+                               const qFIS_ModelMF_t * const mf );
+static int qFIS_ModelCheckRules( const qFIS_ModelHeader_t * const h,
+                                 const qFIS_Rules_t * const r );
+static const char* qFIS_ImportSkipSpaces( const char *s );
+static const char* qFIS_ImportKey( const char *s,
+                                   const char *key );
+static const char* qFIS_ImportName( const char *s,
+                                    const qFIS_ImportName_t * const names,
+                                    const size_t n,
+                                    uint8_t * const value );
+static const char* qFIS_ImportUnsigned( const char *s,
+                                        size_t * const value );
+static int qFIS_ImportSystem( qFIS_Import_t * const s,
+                              const char *line );
+static int qFIS_ImportSection( qFIS_Import_t * const s,
+                               const char *line );
+static int qFIS_ImportIO( qFIS_Import_t * const s,
+                          const char *line );
+static int qFIS_ImportMF( qFIS_Import_t * const s,
+                          const char *line );
+static int qFIS_ImportRule( qFIS_Import_t * const s,
+                            const char *line );
+static int qFIS_ImportPutRuleItem( qFIS_Import_t * const s,
+                                   const long item );
+static int qFIS_ImportMFBase( const qFIS_Import_t * const s,
+                              const size_t io,
+                              const int output,
+                              size_t * const base,
+                              size_t * const count );
+static int qFIS_ImportParse( qFIS_Import_t * const s,
+                             const char *text );
+
+/*============================================================================*/
+static size_t qFIS_ModelGetLayout( const qFIS_ModelHeader_t * const h,
+                                   qFIS_ModelLayout_t * const l )
+{
+    l->io = sizeof(qFIS_ModelHeader_t);
+    l->mf = l->io + ( ( (size_t)h->nInputs + (size_t)h->nOutputs )*sizeof(qFIS_ModelIO_t) );
+    l->params = l->mf + ( ( (size_t)h->nMFInputs + (size_t)h->nMFOutputs )*sizeof(qFIS_ModelMF_t) );
+    l->weights = l->params + ( (size_t)h->nParams*sizeof(float) );
+    l->rules = l->weights + ( ( 0U != h->hasWeights ) ? ( (size_t)h->nRules*sizeof(float) ) : 0U );
+    l->end = QFIS_MODEL_ALIGN( l->rules + ( (size_t)h->nRuleItems*sizeof(qFIS_Rules_t) ) );
+
+    return l->end;
+}
+/*============================================================================*/
+static size_t qFIS_ModelParamCount( const qFIS_ModelHeader_t * const h,
+                                    const uint8_t shape )
+{
+    static const uint8_t nParams[ _NUM_MFS ] = { 0U,
+    /*trimf, trapmf, gbellmf, gaussmf, gauss2mf, sigmf, dsigmf, psigmf*/
+    3U, 4U, 3U, 2U, 4U, 2U, 4U, 4U,
+    /*pimf, smf, zmf, singletonmf, concavemf, spikemf, linsmf, linzmf*/
+    4U, 2U, 2U, 1U, 2U, 2U, 2U, 2U,
+    /*rectmf, cosmf, constantmf, linearmf*/
+    2U, 2U, 1U, 0U,
+    /*tlinsmf, tlinzmf, tconcavemf, tsigmf, tsmf, tzmf*/
+    2U, 2U, 2U, 2U, 2U, 2U
+    };
+    size_t n;
+
+    if ( (uint8_t)linearmf == shape ) {
+        n = (size_t)h->nInputs + 1U;
+    }
+    else {
+        n = (size_t)nParams[ shape ];
+    }
+
+    return n;
+}
+/*============================================================================*/
+static int qFIS_ModelCheckMFs( const qFIS_ModelHeader_t * const h,
+                               const qFIS_ModelMF_t * const mf )
+{
+    int retVal = 1;
+    const size_t nMF = (size_t)h->nMFInputs + (size_t)h->nMFOutputs;
+    size_t i;
+
+    for ( i = 0U ; i < nMF ; ++i ) {
+        const size_t nIO = ( i < (size_t)h->nMFInputs ) ? (size_t)h->nInputs
+                                                         : (size_t)h->nOutputs;
+        if ( ( (size_t)mf[ i ].io >= nIO ) ||
+             ( (uint8_t)custommf == mf[ i ].shape ) ||
+             ( mf[ i ].shape >= (uint8_t)_NUM_MFS ) ) {
+            retVal = 0;
+            break;
+        }
+        /*cstat -CERT-INT30-C_a*/
+        if ( ( (size_t)mf[ i ].offset + qFIS_ModelParamCount( h, mf[ i ].shape ) ) > (size_t)h->nParams ) {
+            retVal = 0;
+            break;
+        }
+        /*cstat +CERT-INT30-C_a*/
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static int qFIS_ModelCheckRules( const qFIS_ModelHeader_t * const h,
+                                 const qFIS_Rules_t * const r )
+{
+    enum { ANT_IO = 0, ANT_MF, ANT_CONN, CON_IO, CON_MF, CON_NEXT, DONE };
+    int retVal = 0;
+    int state = ANT_IO;
+    size_t i, nRules = 0U;
+
+    if ( ( h->nRuleItems >= 2U ) && ( QFIS_RULES_BEGIN == r[ 0 ] ) ) {
+        for ( i = 1U ; ( i < (size_t)h->nRuleItems ) && ( DONE != state ) ; ++i ) {
+            const long t = (long)r[ i ];
+            const size_t m = ( t < 0 ) ? (size_t)( -t ) : (size_t)t;
+
+            if ( ( CON_NEXT == state ) && ( t >= 0 ) ) {
+                state = ANT_IO; /*a new rule starts*/
+            }
+            switch ( state ) {
+                case ANT_IO:
+                    state = ( ( t >= 0 ) && ( (size_t)t < (size_t)h->nInputs ) ) ? ANT_MF : -1;
+                    break;
+                case ANT_MF:
+                    state = ( ( 0 != t ) && ( m <= (size_t)h->nMFInputs ) ) ? ANT_CONN : -1;
+                    break;
+                case ANT_CONN:
+                    if ( ( _QFIS_AND == t ) || ( _QFIS_OR == t ) ) {
+                        state = ANT_IO;
+                    }
+                    else {
+                        state = ( _QFIS_THEN == t ) ? CON_IO : -1;
+                    }
+                    break;
+                case CON_IO:
+                    state = ( ( t >= 0 ) && ( (size_t)t < (size_t)h->nOutputs ) ) ? CON_MF : -1;
+                    break;
+                case CON_MF:
+                    if ( ( 0 != t ) && ( m <= (size_t)h->nMFOutputs ) ) {
+                        ++nRules;
+                        state = CON_NEXT;
+                    }
+                    else {
+                        state = -1;
+                    }
+                    break;
+                case CON_NEXT:
+                    if ( _QFIS_AND == t ) {
+                        --nRules; /*same rule, another consequent*/
+                        state = CON_IO;
+                    }
+                    else {
+                        state = ( _QFIS_RULES_END == t ) ? DONE : -1;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            if ( state < 0 ) {
+                break;
+            }
+        }
+        if ( ( DONE == state ) && ( i == (size_t)h->nRuleItems ) &&
+             ( nRules == (size_t)h->nRules ) ) {
+            retVal = 1;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+const qFIS_ModelHeader_t* qFIS_GetModelHeader( const void * const model,
+                                               const size_t size )
+{
+    const qFIS_ModelHeader_t *retVal = NULL;
+
+    /*cppcheck-suppress misra-c2012-11.6 */
+    if ( ( NULL != model ) && ( 0U == ( (uintptr_t)model & 3U ) ) &&
+         ( size >= sizeof(qFIS_ModelHeader_t) ) ) {
+        /*cppcheck-suppress misra-c2012-11.5 */
+        const qFIS_ModelHeader_t *h = (const qFIS_ModelHeader_t*)model;
+        const uint8_t *base = (const uint8_t*)model;
+        qFIS_ModelLayout_t l;
+
+        if ( ( QFIS_MODEL_MAGIC == h->magic ) &&
+             ( QFIS_MODEL_VERSION == h->version ) &&
+             ( sizeof(qFIS_Rules_t) == (size_t)h->ruleItemSize ) &&
+             ( h->type <= (uint8_t)Tsukamoto ) &&
+             ( h->deFuzz < (uint8_t)_NUM_DFUZZ ) &&
+             ( h->hasWeights <= 1U ) &&
+             ( h->nInputs > 0U ) && ( h->nOutputs > 0U ) &&
+             ( h->nMFInputs > 0U ) && ( h->nMFOutputs > 0U ) &&
+             ( h->nRules > 0U ) && ( h->nPoints >= 20U ) &&
+             ( qFIS_ModelGetLayout( h, &l ) == (size_t)h->size ) &&
+             ( (size_t)h->size <= size ) ) {
+            /*cppcheck-suppress misra-c2012-11.3 */
+            const qFIS_ModelMF_t *mf = (const qFIS_ModelMF_t*)&base[ l.mf ];
+            /*cppcheck-suppress misra-c2012-11.3 */
+            const qFIS_Rules_t *r = (const qFIS_Rules_t*)&base[ l.rules ];
+
+            if ( ( 1 == qFIS_ModelCheckMFs( h, mf ) ) &&
+                 ( 1 == qFIS_ModelCheckRules( h, r ) ) ) {
+                retVal = h;
+            }
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_LoadModel( qFIS_t * const f,
+                    const void * const model,
+                    const size_t size,
+                    qFIS_Input_t * const inputs,
+                    const size_t ni,
+                    qFIS_Output_t * const outputs,
+                    const size_t no,
+                    qFIS_MF_t * const mf_inputs,
+                    const size_t nmi,
+                    qFIS_MF_t * const mf_outputs,
+                    const size_t nmo,
+                    float *wi,
+                    const size_t nw )
+{
+    int retVal = 0;
+    const qFIS_ModelHeader_t * const h = qFIS_GetModelHeader( model, size );
+
+    if ( ( NULL != f ) && ( NULL != h ) && ( NULL != inputs ) &&
+         ( NULL != outputs ) && ( NULL != mf_inputs ) &&
+         ( NULL != mf_outputs ) && ( NULL != wi ) &&
+         ( ( ni/sizeof(qFIS_Input_t) ) >= (size_t)h->nInputs ) &&
+         ( ( no/sizeof(qFIS_Output_t) ) >= (size_t)h->nOutputs ) &&
+         ( ( nmi/sizeof(qFIS_MF_t) ) >= (size_t)h->nMFInputs ) &&
+         ( ( nmo/sizeof(qFIS_MF_t) ) >= (size_t)h->nMFOutputs ) &&
+         ( nw >= (size_t)h->nRules ) ) {
+        const uint8_t *base = (const uint8_t*)model;
+        qFIS_ModelLayout_t l;
+        const qFIS_ModelIO_t *io;
+        const qFIS_ModelMF_t *mf;
+        const float *params;
+        size_t i;
+
+        (void)qFIS_ModelGetLayout( h, &l );
+        /*cppcheck-suppress misra-c2012-11.3 */
+        io = (const qFIS_ModelIO_t*)&base[ l.io ];
+        /*cppcheck-suppress misra-c2012-11.3 */
+        mf = (const qFIS_ModelMF_t*)&base[ l.mf ];
+        /*cppcheck-suppress misra-c2012-11.3 */
+        params = (const float*)&base[ l.params ];
+
+        for ( i = 0U ; i < (size_t)h->nInputs ; ++i ) {
+            (void)qFIS_InputSetup( inputs, (qFIS_Tag_t)i, io[ i ].min, io[ i ].max );
+        }
+        io = &io[ h->nInputs ];
+        for ( i = 0U ; i < (size_t)h->nOutputs ; ++i ) {
+            (void)qFIS_OutputSetup( outputs, (qFIS_Tag_t)i, io[ i ].min, io[ i ].max );
+        }
+        for ( i = 0U ; i < (size_t)h->nMFInputs ; ++i ) {
+            (void)qFIS_SetMF( mf_inputs, (qFIS_Tag_t)mf[ i ].io, (qFIS_Tag_t)i,
+                              (qFIS_MF_Name_t)mf[ i ].shape, NULL,
+                              &params[ mf[ i ].offset ], mf[ i ].h );
+        }
+        mf = &mf[ h->nMFInputs ];
+        for ( i = 0U ; i < (size_t)h->nMFOutputs ; ++i ) {
+            (void)qFIS_SetMF( mf_outputs, (qFIS_Tag_t)mf[ i ].io, (qFIS_Tag_t)i,
+                              (qFIS_MF_Name_t)mf[ i ].shape, NULL,
+                              &params[ mf[ i ].offset ], mf[ i ].h );
+        }
+        retVal = qFIS_Setup( f, (qFIS_Type_t)h->type,
+                             inputs, (size_t)h->nInputs*sizeof(qFIS_Input_t),
+                             outputs, (size_t)h->nOutputs*sizeof(qFIS_Output_t),
+                             mf_inputs, (size_t)h->nMFInputs*sizeof(qFIS_MF_t),
+                             mf_outputs, (size_t)h->nMFOutputs*sizeof(qFIS_MF_t),
+                             /*cppcheck-suppress misra-c2012-11.3 */
+                             (const qFIS_Rules_t*)&base[ l.rules ],
+                             wi, (size_t)h->nRules );
+        if ( 1 == retVal ) {
+            retVal = 0;
+            retVal += qFIS_SetParameter( f, qFIS_EvalPoints, (qFIS_ParamValue_t)h->nPoints );
+            retVal += qFIS_SetParameter( f, qFIS_AND, (qFIS_ParamValue_t)h->andOp );
+            retVal += qFIS_SetParameter( f, qFIS_OR, (qFIS_ParamValue_t)h->orOp );
+            retVal += qFIS_SetParameter( f, qFIS_Implication, (qFIS_ParamValue_t)h->implication );
+            retVal += qFIS_SetParameter( f, qFIS_Aggregation, (qFIS_ParamValue_t)h->aggregation );
+            retVal += qFIS_SetDeFuzzMethod( f, (qFIS_DeFuzz_Method_t)h->deFuzz );
+            if ( 0U != h->hasWeights ) {
+                /*weights are only read by the engine*/
+                /*cppcheck-suppress [ misra-c2012-11.3, misra-c2012-11.8 ] */
+                retVal += qFIS_SetRuleWeights( f, (float*)&base[ l.weights ] );
+            }
+            else {
+                ++retVal;
+            }
+            /*cppcheck-suppress misra-c2012-10.6 */
+            retVal = ( 7 == retVal ) ? 1 : 0;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static const char* qFIS_ImportSkipSpaces( const char *s )
+{
+    while ( ( ' ' == *s ) || ( '\t' == *s ) || ( '\r' == *s ) ) {
+        ++s;
+    }
+
+    return s;
+}
+/*============================================================================*/
+static const char* qFIS_ImportKey( const char *s,
+                                   const char *key )
+{
+    const char *retVal = NULL;
+    const size_t n = strlen( key );
+
+    if ( 0 == strncmp( s, key, n ) ) {
+        s = qFIS_ImportSkipSpaces( &s[ n ] );
+        if ( '=' == *s ) {
+            retVal = qFIS_ImportSkipSpaces( &s[ 1 ] );
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static const char* qFIS_ImportName( const char *s,
+                                    const qFIS_ImportName_t * const names,
+                                    const size_t n,
+                                    uint8_t * const value )
+{
+    const char *retVal = NULL;
+    size_t i;
+
+    if ( '\'' == *s ) {
+        ++s;
+        for ( i = 0U ; i < n ; ++i ) {
+            const size_t len = strlen( names[ i ].name );
+
+            if ( ( 0 == strncmp( s, names[ i ].name, len ) ) && ( '\'' == s[ len ] ) ) {
+                *value = names[ i ].value;
+                retVal = &s[ len + 1U ];
+                break;
+            }
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static const char* qFIS_ImportUnsigned( const char *s,
+                                        size_t * const value )
+{
+    const char *retVal = NULL;
+    char *end = NULL;
+    const long x = strtol( s, &end, 10 );
+
+    if ( ( end != s ) && ( x >= 0 ) ) {
+        *value = (size_t)x;
+        retVal = end;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static int qFIS_ImportSystem( qFIS_Import_t * const s,
+                              const char *line )
+{
+    static const qFIS_ImportName_t types[] = {
+        { "mamdani", (uint8_t)Mamdani },
+        { "sugeno", (uint8_t)Sugeno }
+    };
+    static const qFIS_ImportName_t andOps[] = {
+        { "min", (uint8_t)qFIS_MIN },
+        { "prod", (uint8_t)qFIS_PROD }
+    };
+    static const qFIS_ImportName_t orOps[] = {
+        { "max", (uint8_t)qFIS_MAX },
+        { "probor", (uint8_t)qFIS_PROBOR }
+    };
+    static const qFIS_ImportName_t aggOps[] = {
+        { "max", (uint8_t)qFIS_MAX },
+        { "probor", (uint8_t)qFIS_PROBOR },
+        { "sum", (uint8_t)qFIS_SUM }
+    };
+    static const qFIS_ImportName_t methods[] = {
+        { "centroid", (uint8_t)centroid },
+        { "bisector", (uint8_t)bisector },
+        { "mom", (uint8_t)mom },
+        { "lom", (uint8_t)lom },
+        { "som", (uint8_t)som },
+        { "wtaver", (uint8_t)wtaver },
+        { "wtsum", (uint8_t)wtsum }
+    };
+    int retVal = 1;
+    const char *v;
+
+    if ( NULL != ( v = qFIS_ImportKey( line, "Type" ) ) ) {
+        v = qFIS_ImportName( v, types, sizeof(types)/sizeof(types[ 0 ]), &s->h.type );
+        s->h.deFuzz = ( (uint8_t)Mamdani == s->h.type ) ? (uint8_t)centroid
+                                                         : (uint8_t)wtaver;
+    }
+    else if ( NULL != ( v = qFIS_ImportKey( line, "NumInputs" ) ) ) {
+        v = qFIS_ImportUnsigned( v, &s->nInputs );
+        s->h.nInputs = (uint16_t)s->nInputs; /*required by linearmf*/
+    }
+    else if ( NULL != ( v = qFIS_ImportKey( line, "NumOutputs" ) ) ) {
+        v = qFIS_ImportUnsigned( v, &s->nOutputs );
+    }
+    else if ( NULL != ( v = qFIS_ImportKey( line, "NumRules" ) ) ) {
+        v = qFIS_ImportUnsigned( v, &s->nRules );
+    }
+    else if ( NULL != ( v = qFIS_ImportKey( line, "AndMethod" ) ) ) {
+        v = qFIS_ImportName( v, andOps, sizeof(andOps)/sizeof(andOps[ 0 ]), &s->h.andOp );
+    }
+    else if ( NULL != ( v = qFIS_ImportKey( line, "OrMethod" ) ) ) {
+        v = qFIS_ImportName( v, orOps, sizeof(orOps)/sizeof(orOps[ 0 ]), &s->h.orOp );
+    }
+    else if ( NULL != ( v = qFIS_ImportKey( line, "ImpMethod" ) ) ) {
+        v = qFIS_ImportName( v, andOps, sizeof(andOps)/sizeof(andOps[ 0 ]), &s->h.implication );
+    }
+    else if ( NULL != ( v = qFIS_ImportKey( line, "AggMethod" ) ) ) {
+        v = qFIS_ImportName( v, aggOps, sizeof(aggOps)/sizeof(aggOps[ 0 ]), &s->h.aggregation );
+    }
+    else if ( NULL != ( v = qFIS_ImportKey( line, "DefuzzMethod" ) ) ) {
+        v = qFIS_ImportName( v, methods, sizeof(methods)/sizeof(methods[ 0 ]), &s->h.deFuzz );
+    }
+    else {
+        v = line; /*other keys like Name or Version are ignored*/
+    }
+    if ( NULL == v ) {
+        retVal = 0;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static int qFIS_ImportSection( qFIS_Import_t * const s,
+                               const char *line )
+{
+    int retVal = 0;
+    const char *v = NULL;
+    size_t n = 0U;
+
+    /*the previous I/O should declare all its membership functions*/
+    if ( ( ( QFIS_IMPORT_INPUT != s->section ) && ( QFIS_IMPORT_OUTPUT != s->section ) ) ||
+         ( s->ioMFs == s->ioNumMFs ) ) {
+        if ( 0 == strncmp( line, "[System]", 8U ) ) {
+            s->section = QFIS_IMPORT_SYSTEM;
+            retVal = 1;
+        }
+        else if ( 0 == strncmp( line, "[Input", 6U ) ) {
+            v = qFIS_ImportUnsigned( &line[ 6 ], &n );
+            /*inputs should be listed in order and before the outputs*/
+            if ( ( NULL != v ) && ( ']' == *v ) && ( n == ( s->io + 1U ) ) &&
+                 ( n <= s->nInputs ) && ( QFIS_IMPORT_OUTPUT != s->section ) &&
+                 ( QFIS_IMPORT_RULES != s->section ) ) {
+                s->section = QFIS_IMPORT_INPUT;
+                retVal = 1;
+            }
+        }
+        else if ( 0 == strncmp( line, "[Output", 7U ) ) {
+            v = qFIS_ImportUnsigned( &line[ 7 ], &n );
+            if ( QFIS_IMPORT_INPUT == s->section ) {
+                s->nMFInputs = s->nMF;
+                s->io = 0U;
+            }
+            if ( ( NULL != v ) && ( ']' == *v ) && ( n == ( s->io + 1U ) ) &&
+                 ( n <= s->nOutputs ) && ( s->nIO == ( s->nInputs + s->io ) ) ) {
+                s->section = QFIS_IMPORT_OUTPUT;
+                retVal = 1;
+            }
+        }
+        else if ( 0 == strncmp( line, "[Rules]", 7U ) ) {
+            if ( ( QFIS_IMPORT_OUTPUT == s->section ) &&
+                 ( s->nIO == ( s->nInputs + s->nOutputs ) ) ) {
+                s->section = QFIS_IMPORT_RULES;
+                retVal = qFIS_ImportPutRuleItem( s, QFIS_RULES_BEGIN );
+            }
+        }
+        else {
+            /*nothing to do*/
+        }
+        if ( ( 1 == retVal ) && ( n > 0U ) ) {
+            s->io = n;
+            s->ioMFs = 0U;
+            s->ioNumMFs = 0U;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static int qFIS_ImportIO( qFIS_Import_t * const s,
+                          const char *line )
+{
+    int retVal = 1;
+    const char *v;
+
+    if ( NULL != ( v = qFIS_ImportKey( line, "Range" ) ) ) {
+        char *end = NULL;
+        float min, max;
+
+        retVal = 0;
+        if ( '[' == *v ) {
+            min = (float)strtod( &v[ 1 ], &end );
+            max = (float)strtod( end, &end );
+            end = (char*)qFIS_ImportSkipSpaces( end );
+            if ( ( ']' == *end ) && ( min < max ) ) {
+                const size_t k = ( ( QFIS_IMPORT_OUTPUT == s->section ) ? s->nInputs : 0U ) + s->io - 1U;
+
+                if ( ( k == s->nIO ) && ( NULL != s->base ) ) {
+                    /*cppcheck-suppress misra-c2012-11.3 */
+                    qFIS_ModelIO_t *io = (qFIS_ModelIO_t*)&s->base[ s->l.io ];
+
+                    io[ k ].min = min;
+                    io[ k ].max = max;
+                }
+                retVal = ( k == s->nIO ) ? 1 : 0;
+                ++s->nIO;
+            }
+        }
+    }
+    else if ( NULL != ( v = qFIS_ImportKey( line, "NumMFs" ) ) ) {
+        v = qFIS_ImportUnsigned( v, &s->ioNumMFs );
+        retVal = ( ( NULL != v ) && ( s->ioNumMFs > 0U ) && ( 0U == s->ioMFs ) ) ? 1 : 0;
+    }
+    else if ( 0 == strncmp( line, "MF", 2U ) ) {
+        retVal = qFIS_ImportMF( s, &line[ 2 ] );
+    }
+    else {
+        /*nothing to do*/
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static int qFIS_ImportMF( qFIS_Import_t * const s,
+                          const char *line )
+{
+    static const qFIS_ImportName_t shapes[] = {
+        { "trimf", (uint8_t)trimf },
+        { "trapmf", (uint8_t)trapmf },
+        { "gbellmf", (uint8_t)gbellmf },
+        { "gaussmf", (uint8_t)gaussmf },
+        { "gauss2mf", (uint8_t)gauss2mf },
+        { "sigmf", (uint8_t)sigmf },
+        { "dsigmf", (uint8_t)dsigmf },
+        { "psigmf", (uint8_t)psigmf },
+        { "pimf", (uint8_t)pimf },
+        { "smf", (uint8_t)smf },
+        { "zmf", (uint8_t)zmf },
+        { "linsmf", (uint8_t)linsmf },
+        { "linzmf", (uint8_t)linzmf },
+        { "constant", (uint8_t)constantmf },
+        { "linear", (uint8_t)linearmf }
+    };
+    int retVal = 0;
+    size_t k = 0U;
+    uint8_t shape = 0U;
+    const char *v = qFIS_ImportUnsigned( line, &k );
+
+    /*MFk='name':'type',[p1 p2 ... pn]*/
+    if ( ( NULL != v ) && ( k == ( s->ioMFs + 1U ) ) && ( k <= s->ioNumMFs ) ) {
+        v = qFIS_ImportKey( v, "" );
+        v = ( ( NULL != v ) && ( '\'' == *v ) ) ? strchr( &v[ 1 ], '\'' ) : NULL;
+        if ( ( NULL != v ) && ( ':' == v[ 1 ] ) ) {
+            v = qFIS_ImportName( &v[ 2 ], shapes, sizeof(shapes)/sizeof(shapes[ 0 ]), &shape );
+        }
+        else {
+            v = NULL;
+        }
+        /*Sugeno output functions are only allowed on Sugeno outputs*/
+        if ( ( NULL != v ) && ( ',' == *v ) && ( '[' == v[ 1 ] ) &&
+             ( ( shape >= (uint8_t)constantmf ) == ( ( (uint8_t)Sugeno == s->h.type ) && ( QFIS_IMPORT_OUTPUT == s->section ) ) ) ) {
+            const size_t first = s->nParams;
+            char *end = (char*)&v[ 2 ];
+            float p;
+
+            for ( ;; ) {
+                const char *start = qFIS_ImportSkipSpaces( end );
+
+                if ( ']' == *start ) {
+                    break;
+                }
+                p = (float)strtod( start, &end );
+                if ( end == start ) {
+                    break;
+                }
+                if ( NULL != s->base ) {
+                    /*cppcheck-suppress misra-c2012-11.3 */
+                    float *params = (float*)&s->base[ s->l.params ];
+
+                    params[ s->nParams ] = p;
+                }
+                ++s->nParams;
+            }
+            if ( ( ']' == *qFIS_ImportSkipSpaces( end ) ) &&
+                 ( ( s->nParams - first ) == qFIS_ModelParamCount( &s->h, shape ) ) ) {
+                if ( NULL != s->base ) {
+                    /*cppcheck-suppress misra-c2012-11.3 */
+                    qFIS_ModelMF_t *mf = (qFIS_ModelMF_t*)&s->base[ s->l.mf ];
+
+                    mf[ s->nMF ].io = (uint16_t)( s->io - 1U );
+                    mf[ s->nMF ].shape = shape;
+                    mf[ s->nMF ].reserved = 0U;
+                    mf[ s->nMF ].offset = (uint32_t)first;
+                    mf[ s->nMF ].h = 1.0F;
+                }
+                ++s->nMF;
+                ++s->ioMFs;
+                retVal = 1;
+            }
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static int qFIS_ImportPutRuleItem( qFIS_Import_t * const s,
+                                   const long item )
+{
+    if ( NULL != s->base ) {
+        /*cppcheck-suppress misra-c2012-11.3 */
+        qFIS_Rules_t *r = (qFIS_Rules_t*)&s->base[ s->l.rules ];
+
+        r[ s->nItems ] = (qFIS_Rules_t)item;
+    }
+    ++s->nItems;
+
+    return 1;
+}
+/*============================================================================*/
+static int qFIS_ImportMFBase( const qFIS_Import_t * const s,
+                              const size_t io,
+                              const int output,
+                              size_t * const base,
+                              size_t * const count )
+{
+    int retVal = 0;
+    /*cppcheck-suppress misra-c2012-11.3 */
+    const qFIS_ModelMF_t *mf = (const qFIS_ModelMF_t*)&s->base[ s->l.mf ];
+    const size_t first = ( 0 != output ) ? (size_t)s->h.nMFInputs : 0U;
+    const size_t last = ( 0 != output ) ? s->nMF : (size_t)s->h.nMFInputs;
+    size_t i;
+
+    *count = 0U;
+    for ( i = first ; i < last ; ++i ) {
+        if ( (size_t)mf[ i ].io == io ) {
+            if ( 0U == *count ) {
+                *base = i - first;
+            }
+            ++( *count );
+        }
+    }
+    if ( *count > 0U ) {
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static int qFIS_ImportRule( qFIS_Import_t * const s,
+                            const char *line )
+{
+    int retVal = 1;
+    const size_t n = s->nInputs + s->nOutputs;
+    const char *v = line;
+    long conn = 0;
+    float w = 1.0F;
+    size_t i, pass;
+
+    /*two passes over the line : the first one obtains the connector and the
+    weight, the second one writes the rule items*/
+    for ( pass = 0U ; ( pass < 2U ) && ( 1 == retVal ) ; ++pass ) {
+        size_t nAnt = 0U, nCon = 0U;
+        char *end = NULL;
+
+        v = line;
+        for ( i = 0U ; ( i < n ) && ( 1 == retVal ) ; ++i ) {
+            const long x = strtol( v, &end, 10 );
+            const size_t m = ( x < 0 ) ? (size_t)( -x ) : (size_t)x;
+            const int output = ( i >= s->nInputs ) ? 1 : 0;
+            const size_t io = ( 0 != output ) ? ( i - s->nInputs ) : i;
+            size_t base = 0U, count = 0U;
+
+            if ( end == v ) {
+                retVal = 0;
+                break;
+            }
+            v = qFIS_ImportSkipSpaces( end );
+            if ( ',' == *v ) {
+                v = qFIS_ImportSkipSpaces( &v[ 1 ] );
+            }
+            if ( ( 0U == pass ) || ( 0 == x ) ) {
+                nAnt += ( ( 0 == output ) && ( 0 != x ) ) ? 1U : 0U;
+                nCon += ( ( 0 != output ) && ( 0 != x ) ) ? 1U : 0U;
+                continue;
+            }
+            if ( NULL != s->base ) {
+                if ( ( 0 == qFIS_ImportMFBase( s, io, output, &base, &count ) ) ||
+                     ( m > count ) ||
+                     ( ( base + m ) > (size_t)QFIS_MODEL_RULE_MAX ) ) {
+                    retVal = 0;
+                    break;
+                }
+            }
+            if ( 0 == output ) {
+                if ( nAnt > 0U ) {
+                    (void)qFIS_ImportPutRuleItem( s, conn );
+                }
+                ++nAnt;
+            }
+            else {
+                (void)qFIS_ImportPutRuleItem( s, ( nCon > 0U ) ? (long)_QFIS_AND
+                                                               : (long)_QFIS_THEN );
+                ++nCon;
+            }
+            (void)qFIS_ImportPutRuleItem( s, (long)io );
+            (void)qFIS_ImportPutRuleItem( s, ( x < 0 ) ? -(long)( base + m )
+                                                       : (long)( base + m ) );
+        }
+        if ( ( 0U == pass ) && ( 1 == retVal ) ) {
+            size_t c = 0U;
+            /*(w) : c*/
+            if ( ( '(' == *v ) && ( 0U != nAnt ) && ( 0U != nCon ) ) {
+                w = (float)strtod( &v[ 1 ], &end );
+                v = qFIS_ImportSkipSpaces( end );
+                v = ( ')' == *v ) ? qFIS_ImportSkipSpaces( &v[ 1 ] ) : NULL;
+                v = ( ( NULL != v ) && ( ':' == *v ) ) ? qFIS_ImportUnsigned( qFIS_ImportSkipSpaces( &v[ 1 ] ), &c )
+                                                      : NULL;
+            }
+            else {
+                v = NULL;
+            }
+            if ( ( NULL != v ) && ( ( 1U == c ) || ( 2U == c ) ) && ( w >= 0.0F ) && ( w <= 1.0F ) ) {
+                conn = ( 1U == c ) ? (long)_QFIS_AND : (long)_QFIS_OR;
+            }
+            else {
+                retVal = 0;
+            }
+        }
+    }
+    if ( 1 == retVal ) {
+        if ( NULL != s->base ) {
+            /*cppcheck-suppress misra-c2012-11.3 */
+            float *weights = (float*)&s->base[ s->l.weights ];
+
+            if ( 0U != s->h.hasWeights ) {
+                weights[ s->nWeights ] = w;
+            }
+        }
+        if ( w < 1.0F ) {
+            s->weighted = 1;
+        }
+        ++s->nWeights;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static int qFIS_ImportParse( qFIS_Import_t * const s,
+                             const char *text )
+{
+    int retVal = 1;
+    const char *line = text;
+
+    s->h.andOp = (uint8_t)qFIS_MIN;
+    s->h.orOp = (uint8_t)qFIS_MAX;
+    s->h.implication = (uint8_t)qFIS_MIN;
+    s->h.aggregation = (uint8_t)qFIS_MAX;
+    s->section = QFIS_IMPORT_NONE;
+
+    while ( ( 1 == retVal ) && ( '\0' != *line ) ) {
+        const char *next = strchr( line, '\n' );
+
+        line = qFIS_ImportSkipSpaces( line );
+        if ( ( '\n' == *line ) || ( '\0' == *line ) || ( '%' == *line ) ) {
+            /*empty line or comment*/
+        }
+        else if ( '[' == *line ) {
+            retVal = qFIS_ImportSection( s, line );
+        }
+        else {
+            switch ( s->section ) {
+                case QFIS_IMPORT_SYSTEM:
+                    retVal = qFIS_ImportSystem( s, line );
+                    break;
+                case QFIS_IMPORT_INPUT: case QFIS_IMPORT_OUTPUT:
+                    retVal = qFIS_ImportIO( s, line );
+                    break;
+                case QFIS_IMPORT_RULES:
+                    retVal = qFIS_ImportRule( s, line );
+                    break;
+                default:
+                    retVal = 0;
+                    break;
+            }
+        }
+        line = ( NULL != next ) ? &next[ 1 ] : "";
+    }
+    if ( ( 1 == retVal ) && ( QFIS_IMPORT_RULES == s->section ) &&
+         ( s->nWeights == s->nRules ) && ( s->nRules > 0U ) ) {
+        retVal = qFIS_ImportPutRuleItem( s, _QFIS_RULES_END );
+    }
+    else {
+        retVal = 0;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+size_t qFIS_ImportFIS( const char *text,
+                       void * const model,
+                       const size_t size )
+{
+    size_t retVal = 0U;
+    qFIS_Import_t s;
+
+    if ( NULL != text ) {
+        (void)memset( &s, 0, sizeof(qFIS_Import_t) );
+        /*counting pass*/
+        if ( 1 == qFIS_ImportParse( &s, text ) ) {
+            s.h.magic = QFIS_MODEL_MAGIC;
+            s.h.version = QFIS_MODEL_VERSION;
+            s.h.ruleItemSize = (uint8_t)sizeof(qFIS_Rules_t);
+            s.h.nInputs = (uint16_t)s.nInputs;
+            s.h.nOutputs = (uint16_t)s.nOutputs;
+            s.h.nMFInputs = (uint16_t)s.nMFInputs;
+            s.h.nMFOutputs = (uint16_t)( s.nMF - s.nMFInputs );
+            s.h.nRules = (uint16_t)s.nRules;
+            s.h.nPoints = 100U;
+            s.h.nParams = (uint32_t)s.nParams;
+            s.h.nRuleItems = (uint32_t)s.nItems;
+            s.h.hasWeights = ( 0 != s.weighted ) ? 1U : 0U;
+            s.h.reserved = 0U;
+            s.h.size = (uint32_t)qFIS_ModelGetLayout( &s.h, &s.l );
+            retVal = (size_t)s.h.size;
+        }
+        /*writing pass*/
+        if ( ( retVal > 0U ) && ( NULL != model ) ) {
+            qFIS_ModelHeader_t h = s.h;
+            qFIS_ModelLayout_t l = s.l;
+
+            /*cppcheck-suppress misra-c2012-11.6 */
+            if ( ( size >= retVal ) && ( 0U == ( (uintptr_t)model & 3U ) ) ) {
+                (void)memset( &s, 0, sizeof(qFIS_Import_t) );
+                s.h = h;
+                s.l = l;
+                /*cppcheck-suppress misra-c2012-11.5 */
+                s.base = (uint8_t*)model;
+                (void)memset( model, 0, retVal );
+                if ( 1 == qFIS_ImportParse( &s, text ) ) {
+                    /*cppcheck-suppress misra-c2012-11.5 */
+                    *( (qFIS_ModelHeader_t*)model ) = h;
+                    if ( NULL == qFIS_GetModelHeader( model, retVal ) ) {
+                        retVal = 0U;
+                    }
+                }
+                else {
+                    retVal = 0U;
+                }
+            }
+            else {
+                retVal = 0U;
+            }
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
@@ -0,0 +1,851 @@
+/*!
+ * @file qfistrain.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ **/
+
+#include "qfistrain.h"
+#include "qffmath.h"
+#include <stdbool.h>
+
+static int qFIS_TrainCount( const qFIS_t * const f,
+                            size_t * const nc,
+                            size_t * const np );
+static size_t qFIS_TrainParamCount( const qFIS_Trainer_t * const t,
+                                    const qFIS_MF_t * const m,
+                                    const bool output );
+static size_t qFIS_TrainOffset( const qFIS_Trainer_t * const t,
+                                const size_t k,
+                                const bool output );
+static float qFIS_TrainInput( const qFIS_Trainer_t * const t,
+                              const float *x,
+                              const size_t i );
+static size_t qFIS_TrainIndex( qFIS_Rules_t mf );
+static float qFIS_TrainOperator( const qFIS_Trainer_t * const t,
+                                 const qFIS_Rules_t connector,
+                                 const float a,
+                                 const float b,
+                                 float * const da,
+                                 float * const db );
+static size_t qFIS_TrainTerms( const qFIS_Trainer_t * const t,
+                               const size_t i );
+static float qFIS_TrainTerm( const qFIS_Trainer_t * const t,
+                             const size_t j );
+static float qFIS_TrainFold( const qFIS_Trainer_t * const t,
+                             const size_t i,
+                             const size_t k );
+static bool qFIS_TrainNextPair( const qFIS_Trainer_t * const t,
+                                size_t * const c );
+static float qFIS_TrainConsequent( const qFIS_Trainer_t * const t,
+                                   const size_t k,
+                                   const float *x );
+static void qFIS_TrainRegressor( const qFIS_Trainer_t * const t,
+                                 const size_t k,
+                                 const float *x,
+                                 const float scale,
+                                 float * const v );
+static void qFIS_TrainForward( qFIS_Trainer_t * const t,
+                               const float *x );
+static void qFIS_TrainTermGradient( qFIS_Trainer_t * const t,
+                                    const size_t j,
+                                    float dv,
+                                    const float *x );
+static void qFIS_TrainPremise( qFIS_Trainer_t * const t,
+                               const size_t i,
+                               const size_t nTerms,
+                               float dw,
+                               const float *x );
+
+/*============================================================================*/
+static int qFIS_TrainCount( const qFIS_t * const f,
+                            size_t * const nc,
+                            size_t * const np )
+{
+    int retVal = 0;
+    qFIS_DeFuzz_Method_t dm = centroid;
+    qFIS_ParamValue_t andOp = qFIS_MAX;
+
+    if ( ( NULL != f ) && ( Sugeno == f->type ) &&
+         ( 1 == qFIS_GetDeFuzzMethod( f, &dm ) ) && ( dm >= wtaver ) &&
+         ( 1 == qFIS_GetParameter( f, qFIS_AND, &andOp ) ) && ( andOp <= qFIS_PROD ) ) {
+        qFIS_MF_Name_t s = custommf;
+        size_t i;
+
+        retVal = 1;
+        *nc = 0U;
+        *np = 0U;
+        for ( i = 0U ; i < f->nMFOutputs ; ++i ) {
+            (void)qFIS_GetMFName( &f->outMF[ i ], &s );
+            if ( constantmf == s ) {
+                *nc += 1U;
+            }
+            else if ( linearmf == s ) {
+                *nc += f->nInputs + 1U;
+            }
+            else {
+                retVal = 0; /*only constant and linear consequents*/
+            }
+        }
+        for ( i = 0U ; i < f->nMFInputs ; ++i ) {
+            (void)qFIS_GetMFName( &f->inMF[ i ], &s );
+            if ( gaussmf == s ) {
+                *np += 2U;
+            }
+            else if ( gbellmf == s ) {
+                *np += 3U;
+            }
+            else {
+                /*not trained*/
+            }
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+size_t qFIS_TrainWorkSize( const qFIS_t * const f )
+{
+    size_t n = 0U;
+    size_t nc = 0U, np = 0U;
+
+    if ( 1 == qFIS_TrainCount( f, &nc, &np ) ) {
+        /*A | b | g | phi | mu | w | y | s | e*/
+        n = ( nc*nc ) + ( 3U*nc ) + np + f->nMFInputs + f->nRules + ( 3U*f->nOutputs );
+    }
+
+    return n;
+}
+/*============================================================================*/
+int qFIS_TrainSetup( qFIS_Trainer_t * const t,
+                     qFIS_t * const f,
+                     float *work,
+                     const size_t n )
+{
+    int retVal = 0;
+    size_t nc = 0U, np = 0U;
+
+    /*the FIS should be trainable and the workspace large enough for it*/
+    if ( ( NULL != t ) && ( NULL != f ) && ( NULL != work ) &&
+         ( 1 == qFIS_TrainCount( f, &nc, &np ) ) &&
+         ( n >= qFIS_TrainWorkSize( f ) ) ) {
+        qFIS_DeFuzz_Method_t dm = wtaver;
+        qFIS_MF_Name_t s = custommf;
+        size_t i;
+
+        t->nc = nc;
+        t->np = np;
+        (void)qFIS_GetDeFuzzMethod( f, &dm );
+        (void)qFIS_GetParameter( f, qFIS_AND, &t->andOp );
+        if ( 0 == qFIS_GetParameter( f, qFIS_OR, &t->orOp ) ) {
+            t->orOp = qFIS_MAX;
+        }
+        t->wtaver = ( wtaver == dm ) ? 1U : 0U;
+        t->gaussShape = NULL;
+        t->gbellShape = NULL;
+        t->linearShape = NULL;
+        for ( i = 0U ; i < f->nMFInputs ; ++i ) {
+            (void)qFIS_GetMFName( &f->inMF[ i ], &s );
+            if ( gaussmf == s ) {
+                t->gaussShape = f->inMF[ i ].shape;
+            }
+            else if ( gbellmf == s ) {
+                t->gbellShape = f->inMF[ i ].shape;
+            }
+            else {
+                /*not trained*/
+            }
+        }
+        for ( i = 0U ; i < f->nMFOutputs ; ++i ) {
+            (void)qFIS_GetMFName( &f->outMF[ i ], &s );
+            if ( linearmf == s ) {
+                t->linearShape = f->outMF[ i ].shape;
+            }
+        }
+        t->f = f;
+        t->A = work;
+        t->b = &t->A[ t->nc*t->nc ];
+        t->g = &t->b[ t->nc ];
+        t->phi = &t->g[ t->nc + t->np ];
+        t->mu = &t->phi[ t->nc ];
+        t->w = &t->mu[ f->nMFInputs ];
+        t->y = &t->w[ f->nRules ];
+        t->s = &t->y[ f->nOutputs ];
+        t->e = &t->s[ f->nOutputs ];
+        retVal = qFIS_TrainReset( t );
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_TrainReset( qFIS_Trainer_t * const t )
+{
+    int retVal = 0;
+
+    if ( ( NULL != t ) && ( NULL != t->f ) ) {
+        size_t i;
+        /*A, b and g are contiguous*/
+        const size_t n = ( t->nc*t->nc ) + ( 2U*t->nc ) + t->np;
+
+        for ( i = 0U ; i < n ; ++i ) {
+            t->A[ i ] = 0.0F;
+        }
+        t->sse = 0.0F;
+        t->nGrad = 0U;
+        t->nLSE = 0U;
+        t->nErr = 0U;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static size_t qFIS_TrainParamCount( const qFIS_Trainer_t * const t,
+                                    const qFIS_MF_t * const m,
+                                    const bool output )
+{
+    size_t n = 0U;
+
+    if ( output ) {
+        /*cppcheck-suppress misra-c2012-12.1 */
+        n = ( t->linearShape == m->shape ) ? ( t->f->nInputs + 1U ) : 1U;
+    }
+    else if ( t->gaussShape == m->shape ) {
+        n = 2U;
+    }
+    else if ( t->gbellShape == m->shape ) {
+        n = 3U;
+    }
+    else {
+        /*not trained*/
+    }
+
+    return n;
+}
+/*============================================================================*/
+static size_t qFIS_TrainOffset( const qFIS_Trainer_t * const t,
+                                const size_t k,
+                                const bool output )
+{
+    const qFIS_MF_t *m = ( output ) ? t->f->outMF : t->f->inMF;
+    size_t i, offset = ( output ) ? 0U : t->nc;
+
+    for ( i = 0U ; i < k ; ++i ) {
+        offset += qFIS_TrainParamCount( t, &m[ i ], output );
+    }
+
+    return offset;
+}
+/*============================================================================*/
+static float qFIS_TrainInput( const qFIS_Trainer_t * const t,
+                              const float *x,
+                              const size_t i )
+{
+    const qFIS_IO_Base_t *in = &t->f->input[ i ].b;
+    float v = x[ i ];
+
+    /*same truncation applied by qFIS_Fuzzify()*/
+    (void)qFFMath_InRangeCoerce( &v, in->min, in->max );
+
+    return v;
+}
+/*============================================================================*/
+static size_t qFIS_TrainIndex( qFIS_Rules_t mf )
+{
+    if ( mf < 0 ) {
+        mf = -mf; /*IS_NOT statement*/
+    }
+    /*cstat -CERT-INT32-C_a*/
+    return (size_t)mf - 1U;
+    /*cstat +CERT-INT32-C_a*/
+}
+/*============================================================================*/
+static float qFIS_TrainOperator( const qFIS_Trainer_t * const t,
+                                 const qFIS_Rules_t connector,
+                                 const float a,
+                                 const float b,
+                                 float * const da,
+                                 float * const db )
+{
+    const qFIS_ParamValue_t op = ( _QFIS_AND == connector ) ? t->andOp : t->orOp;
+    bool first = false;
+    float y;
+
+    switch ( op ) {
+        case qFIS_MIN:
+            first = ( a < b );
+            break;
+        case qFIS_MAX:
+            first = ( a > b );
+            break;
+        default:
+            break;
+    }
+    switch ( op ) {
+        case qFIS_MIN: case qFIS_MAX:
+            /*only the selected operand propagates the gradient*/
+            /*cppcheck-suppress misra-c2012-12.1 */
+            *da = ( first ) ? 1.0F : 0.0F;
+            *db = 1.0F - *da;
+            /*cppcheck-suppress misra-c2012-12.1 */
+            y = ( first ) ? a : b;
+            break;
+        case qFIS_PROD:
+            *da = b;
+            *db = a;
+            y = a*b;
+            break;
+        default: /*qFIS_PROBOR*/
+            *da = 1.0F - b;
+            *db = 1.0F - a;
+            y = a + b - ( a*b );
+            break;
+    }
+
+    return y;
+}
+/*============================================================================*/
+static size_t qFIS_TrainTerms( const qFIS_Trainer_t * const t,
+                               const size_t i )
+{
+    size_t k = 0U;
+
+    /*each premise is stored as [ input, mf, connector ]*/
+    while ( _QFIS_THEN != t->f->rules[ i + ( 3U*k ) + 2U ] ) {
+        ++k;
+    }
+
+    return k + 1U;
+}
+/*============================================================================*/
+static float qFIS_TrainTerm( const qFIS_Trainer_t * const t,
+                             const size_t j )
+{
+    const qFIS_Rules_t mf = t->f->rules[ j + 1U ];
+    const float v = t->mu[ qFIS_TrainIndex( mf ) ];
+
+    /*cppcheck-suppress misra-c2012-12.1 */
+    return ( mf < 0 ) ? ( 1.0F - v ) : v;
+}
+/*============================================================================*/
+static float qFIS_TrainFold( const qFIS_Trainer_t * const t,
+                             const size_t i,
+                             const size_t k )
+{
+    float s = qFIS_TrainTerm( t, i );
+    float da, db;
+    size_t j;
+
+    for ( j = 1U ; j < k ; ++j ) {
+        const size_t p = i + ( 3U*j );
+
+        s = qFIS_TrainOperator( t, t->f->rules[ p - 1U ], s, qFIS_TrainTerm( t, p ), &da, &db );
+    }
+
+    return s;
+}
+/*============================================================================*/
+static bool qFIS_TrainNextPair( const qFIS_Trainer_t * const t,
+                                size_t * const c )
+{
+    bool more = false;
+
+    /*consequents are stored as [ output, mf ] pairs joined by AND*/
+    if ( ( t->f->nOutputs > 1U ) && ( _QFIS_AND == t->f->rules[ *c + 2U ] ) ) {
+        *c += 3U;
+        more = true;
+    }
+
+    return more;
+}
+/*============================================================================*/
+static float qFIS_TrainConsequent( const qFIS_Trainer_t * const t,
+                                   const size_t k,
+                                   const float *x )
+{
+    const qFIS_MF_t *m = &t->f->outMF[ k ];
+    float z;
+
+    if ( t->linearShape == m->shape ) {
+        size_t i;
+
+        z = 0.0F;
+        for ( i = 0U ; i < t->f->nInputs ; ++i ) {
+            z += m->points[ i ]*qFIS_TrainInput( t, x, i );
+        }
+        z += m->points[ t->f->nInputs ];
+    }
+    else {
+        z = m->points[ 0 ];
+    }
+
+    return z;
+}
+/*============================================================================*/
+static void qFIS_TrainRegressor( const qFIS_Trainer_t * const t,
+                                 const size_t k,
+                                 const float *x,
+                                 const float scale,
+                                 float * const v )
+{
+    const size_t offset = qFIS_TrainOffset( t, k, true );
+
+    if ( t->linearShape == t->f->outMF[ k ].shape ) {
+        size_t i;
+
+        for ( i = 0U ; i < t->f->nInputs ; ++i ) {
+            v[ offset + i ] += scale*qFIS_TrainInput( t, x, i );
+        }
+        v[ offset + t->f->nInputs ] += scale;
+    }
+    else {
+        v[ offset ] += scale;
+    }
+}
+/*============================================================================*/
+static void qFIS_TrainForward( qFIS_Trainer_t * const t,
+                               const float *x )
+{
+    const qFIS_t *f = t->f;
+    size_t i, r;
+
+    for ( i = 0U ; i < f->nMFInputs ; ++i ) {
+        const qFIS_MF_t *m = &f->inMF[ i ];
+        qFIS_IO_Base_t in = f->input[ m->index ].b;
+
+        in.value = qFIS_TrainInput( t, x, m->index );
+        t->mu[ i ] = m->h*m->shape( &in, m->points, 1U );
+        (void)qFFMath_InRangeCoerce( &t->mu[ i ], 0.0F, 1.0F );
+    }
+    for ( i = 0U ; i < f->nOutputs ; ++i ) {
+        t->y[ i ] = 0.0F;
+        t->s[ i ] = 0.0F;
+    }
+    i = 1U; /*skip QFIS_RULES_BEGIN*/
+    for ( r = 0U ; r < f->nRules ; ++r ) {
+        const size_t nTerms = qFIS_TrainTerms( t, i );
+        size_t c = i + ( 3U*nTerms );
+        float w = qFIS_TrainFold( t, i, nTerms );
+
+        if ( NULL != f->ruleWeight ) {
+            float rw = f->ruleWeight[ r ];
+
+            (void)qFFMath_InRangeCoerce( &rw, 0.0F, 1.0F );
+            w *= rw;
+        }
+        t->w[ r ] = w;
+        do {
+            const size_t o = (size_t)f->rules[ c ];
+            const size_t k = qFIS_TrainIndex( f->rules[ c + 1U ] );
+
+            if ( w > 0.0F ) {
+                t->y[ o ] += w*qFIS_TrainConsequent( t, k, x );
+                t->s[ o ] += w;
+            }
+        } while ( qFIS_TrainNextPair( t, &c ) );
+        i = c + 2U;
+    }
+    for ( i = 0U ; i < f->nOutputs ; ++i ) {
+        if ( ( 0U != t->wtaver ) && ( t->s[ i ] > 0.0F ) ) {
+            t->y[ i ] /= t->s[ i ];
+        }
+    }
+}
+/*============================================================================*/
+int qFIS_TrainAccumulateLSE( qFIS_Trainer_t * const t,
+                             const float *x,
+                             const float *y,
+                             const size_t n )
+{
+    int retVal = 0;
+
+    if ( ( NULL != t ) && ( NULL != t->f ) && ( NULL != x ) && ( NULL != y ) ) {
+        const qFIS_t *f = t->f;
+        size_t j;
+
+        for ( j = 0U ; j < n ; ++j ) {
+            const float *xj = &x[ j*f->nInputs ];
+            size_t o;
+
+            qFIS_TrainForward( t, xj );
+            for ( o = 0U ; o < f->nOutputs ; ++o ) {
+                size_t i, k, r;
+
+                if ( ( 0U != t->wtaver ) && ( t->s[ o ] <= 0.0F ) ) {
+                    continue; /*no rule fired for this output*/
+                }
+                /*the output is linear in the consequent parameters*/
+                for ( i = 0U ; i < t->nc ; ++i ) {
+                    t->phi[ i ] = 0.0F;
+                }
+                i = 1U;
+                for ( r = 0U ; r < f->nRules ; ++r ) {
+                    size_t c = i + ( 3U*qFIS_TrainTerms( t, i ) );
+
+                    do {
+                        k = qFIS_TrainIndex( f->rules[ c + 1U ] );
+                        if ( ( o == (size_t)f->rules[ c ] ) && ( t->w[ r ] > 0.0F ) ) {
+                            /*cppcheck-suppress misra-c2012-12.1 */
+                            const float wn = ( 0U != t->wtaver ) ? ( t->w[ r ]/t->s[ o ] ) : t->w[ r ];
+
+                            qFIS_TrainRegressor( t, k, xj, wn, t->phi );
+                        }
+                    } while ( qFIS_TrainNextPair( t, &c ) );
+                    i = c + 2U;
+                }
+                /*only the lower triangle of A is used*/
+                for ( i = 0U ; i < t->nc ; ++i ) {
+                    const float pi = t->phi[ i ];
+
+                    if ( 0.0F != pi ) {
+                        float *Ai = &t->A[ i*t->nc ];
+
+                        for ( k = 0U ; k <= i ; ++k ) {
+                            Ai[ k ] += pi*t->phi[ k ];
+                        }
+                        t->b[ i ] += pi*y[ ( j*f->nOutputs ) + o ];
+                    }
+                }
+            }
+        }
+        t->nLSE += n;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static void qFIS_TrainTermGradient( qFIS_Trainer_t * const t,
+                                    const size_t j,
+                                    float dv,
+                                    const float *x )
+{
+    const size_t k = qFIS_TrainIndex( t->f->rules[ j + 1U ] );
+    const qFIS_MF_t *m = &t->f->inMF[ k ];
+    size_t offset;
+    const float *p;
+    float d, u, mu;
+
+    if ( t->f->rules[ j + 1U ] < 0 ) {
+        dv = -dv; /*IS_NOT premise : 1 - mu*/
+    }
+    p = m->points;
+    dv *= m->h;
+    d = qFIS_TrainInput( t, x, m->index );
+    if ( ( 0.0F != dv ) && ( t->gaussShape == m->shape ) ) {
+        /*mu = exp( -u^2/2 ), u = ( x - c )/s*/
+        offset = qFIS_TrainOffset( t, k, false );
+        u = ( d - p[ 1 ] )/p[ 0 ];
+        mu = QLIB_EXP( -0.5F*u*u );
+        dv *= mu*u/p[ 0 ];
+        t->g[ offset ] += dv*u;
+        t->g[ offset + 1U ] += dv;
+    }
+    else if ( ( 0.0F != dv ) && ( t->gbellShape == m->shape ) ) {
+        /*mu = 1/( 1 + |u|^(2b) ), u = ( x - c )/a*/
+        offset = qFIS_TrainOffset( t, k, false );
+        d -= p[ 2 ];
+        u = QLIB_ABS( d/p[ 0 ] );
+        mu = 1.0F/( 1.0F + QLIB_POW( u, 2.0F*p[ 1 ] ) );
+        dv *= 2.0F*mu*( 1.0F - mu );
+        t->g[ offset ] += dv*p[ 1 ]/p[ 0 ];
+        if ( u > 0.0F ) {
+            t->g[ offset + 1U ] -= dv*QLIB_LOG( u );
+            t->g[ offset + 2U ] += dv*p[ 1 ]/d;
+        }
+    }
+    else {
+        /*not trained*/
+    }
+}
+/*============================================================================*/
+static void qFIS_TrainPremise( qFIS_Trainer_t * const t,
+                               const size_t i,
+                               const size_t nTerms,
+                               float dw,
+                               const float *x )
+{
+    size_t k = nTerms;
+
+    /*reverse pass over the left-fold of the premises*/
+    while ( k > 1U ) {
+        float da, db;
+        size_t j;
+
+        --k;
+        j = i + ( 3U*k );
+        (void)qFIS_TrainOperator( t, t->f->rules[ j - 1U ], qFIS_TrainFold( t, i, k ),
+                                  qFIS_TrainTerm( t, j ), &da, &db );
+        qFIS_TrainTermGradient( t, j, dw*db, x );
+        dw *= da;
+    }
+    qFIS_TrainTermGradient( t, i, dw, x );
+}
+/*============================================================================*/
+int qFIS_TrainAccumulateGradient( qFIS_Trainer_t * const t,
+                                  const float *x,
+                                  const float *y,
+                                  const size_t n )
+{
+    int retVal = 0;
+
+    if ( ( NULL != t ) && ( NULL != t->f ) && ( NULL != x ) && ( NULL != y ) ) {
+        const qFIS_t *f = t->f;
+        size_t j;
+
+        for ( j = 0U ; j < n ; ++j ) {
+            const float *xj = &x[ j*f->nInputs ];
+            size_t i, o, r;
+
+            qFIS_TrainForward( t, xj );
+            for ( o = 0U ; o < f->nOutputs ; ++o ) {
+                t->e[ o ] = 0.0F;
+                if ( ( 0U == t->wtaver ) || ( t->s[ o ] > 0.0F ) ) {
+                    t->e[ o ] = t->y[ o ] - y[ ( j*f->nOutputs ) + o ];
+                    t->sse += t->e[ o ]*t->e[ o ];
+                    ++t->nErr;
+                }
+            }
+            i = 1U;
+            for ( r = 0U ; r < f->nRules ; ++r ) {
+                const size_t nTerms = qFIS_TrainTerms( t, i );
+                size_t c = i + ( 3U*nTerms );
+                float dw = 0.0F;
+
+                do {
+                    const size_t k = qFIS_TrainIndex( f->rules[ c + 1U ] );
+                    const size_t q = (size_t)f->rules[ c ];
+                    const float e = t->e[ q ];
+
+                    if ( 0.0F != e ) {
+                        const float z = qFIS_TrainConsequent( t, k, xj );
+
+                        if ( 0U != t->wtaver ) {
+                            /*dy/dw = ( z - y )/sum(w), dy/dz = w/sum(w)*/
+                            dw += e*( z - t->y[ q ] )/t->s[ q ];
+                            qFIS_TrainRegressor( t, k, xj, e*t->w[ r ]/t->s[ q ], t->g );
+                        }
+                        else {
+                            dw += e*z;
+                            qFIS_TrainRegressor( t, k, xj, e*t->w[ r ], t->g );
+                        }
+                    }
+                } while ( qFIS_TrainNextPair( t, &c ) );
+                if ( 0.0F != dw ) {
+                    if ( NULL != f->ruleWeight ) {
+                        float rw = f->ruleWeight[ r ];
+
+                        (void)qFFMath_InRangeCoerce( &rw, 0.0F, 1.0F );
+                        dw *= rw;
+                    }
+                    qFIS_TrainPremise( t, i, nTerms, dw, xj );
+                }
+                i = c + 2U;
+            }
+        }
+        t->nGrad += n;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_TrainMerge( qFIS_Trainer_t * const t,
+                     const qFIS_Trainer_t * const src )
+{
+    int retVal = 0;
+
+    if ( ( NULL != t ) && ( NULL != src ) && ( NULL != t->f ) &&
+         ( t->f == src->f ) && ( t != src ) ) {
+        size_t i;
+        const size_t n = ( t->nc*t->nc ) + ( 2U*t->nc ) + t->np;
+
+        for ( i = 0U ; i < n ; ++i ) {
+            t->A[ i ] += src->A[ i ];
+        }
+        t->sse += src->sse;
+        t->nGrad += src->nGrad;
+        t->nLSE += src->nLSE;
+        t->nErr += src->nErr;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_TrainSolveLSE( qFIS_Trainer_t * const t,
+                        const float lambda )
+{
+    int retVal = 0;
+
+    if ( ( NULL != t ) && ( NULL != t->f ) && ( t->nLSE > 0U ) && ( lambda >= 0.0F ) ) {
+        const size_t nc = t->nc;
+        float *A = t->A;
+        float *b = t->b;
+        size_t i, j, k, m, pos = 0U;
+
+        /*ridge around the current parameters : ( A + lambda*I )x = b + lambda*x0*/
+        for ( m = 0U ; m < t->f->nMFOutputs ; ++m ) {
+            const qFIS_MF_t *mf = &t->f->outMF[ m ];
+            const size_t cnt = qFIS_TrainParamCount( t, mf, true );
+
+            for ( j = 0U ; j < cnt ; ++j ) {
+                A[ ( pos*nc ) + pos ] += lambda;
+                b[ pos ] += lambda*mf->points[ j ];
+                ++pos;
+            }
+        }
+        retVal = 1;
+        /*in-place Cholesky factorization of the lower triangle*/
+        for ( j = 0U ; ( j < nc ) && ( 1 == retVal ) ; ++j ) {
+            float d = A[ ( j*nc ) + j ];
+
+            for ( k = 0U ; k < j ; ++k ) {
+                d -= A[ ( j*nc ) + k ]*A[ ( j*nc ) + k ];
+            }
+            if ( d > 0.0F ) {
+                d = QLIB_SQRT( d );
+                A[ ( j*nc ) + j ] = d;
+                for ( i = j + 1U ; i < nc ; ++i ) {
+                    float v = A[ ( i*nc ) + j ];
+
+                    for ( k = 0U ; k < j ; ++k ) {
+                        v -= A[ ( i*nc ) + k ]*A[ ( j*nc ) + k ];
+                    }
+                    A[ ( i*nc ) + j ] = v/d;
+                }
+            }
+            else {
+                retVal = 0; /*singular, a positive lambda is required*/
+            }
+        }
+        if ( 1 == retVal ) {
+            for ( i = 0U ; i < nc ; ++i ) { /*L*z = b*/
+                for ( k = 0U ; k < i ; ++k ) {
+                    b[ i ] -= A[ ( i*nc ) + k ]*b[ k ];
+                }
+                b[ i ] /= A[ ( i*nc ) + i ];
+            }
+            for ( i = nc ; i > 0U ; --i ) { /*L'*x = z*/
+                for ( k = i ; k < nc ; ++k ) {
+                    b[ i - 1U ] -= A[ ( k*nc ) + ( i - 1U ) ]*b[ k ];
+                }
+                b[ i - 1U ] /= A[ ( ( i - 1U )*nc ) + ( i - 1U ) ];
+            }
+            pos = 0U;
+            for ( m = 0U ; m < t->f->nMFOutputs ; ++m ) {
+                const qFIS_MF_t *mf = &t->f->outMF[ m ];
+                const size_t cnt = qFIS_TrainParamCount( t, mf, true );
+                /*cppcheck-suppress misra-c2012-11.8 */
+                float *p = (float*)mf->points;
+
+                for ( j = 0U ; j < cnt ; ++j ) {
+                    p[ j ] = b[ pos ];
+                    ++pos;
+                }
+            }
+            (void)qFIS_Refresh( t->f );
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qFIS_TrainStep( qFIS_Trainer_t * const t,
+                    const float etaPremise,
+                    const float etaConsequent )
+{
+    int retVal = 0;
+
+    if ( ( NULL != t ) && ( NULL != t->f ) && ( t->nGrad > 0U ) ) {
+        /*cstat -CERT-FLP36-C*/
+        const float k = 1.0F/(float)t->nGrad;
+        /*cstat +CERT-FLP36-C*/
+        const float *g = t->g;
+        size_t i, j;
+
+        for ( i = 0U ; i < t->f->nMFOutputs ; ++i ) {
+            const qFIS_MF_t *m = &t->f->outMF[ i ];
+            const size_t cnt = qFIS_TrainParamCount( t, m, true );
+            /*cppcheck-suppress misra-c2012-11.8 */
+            float *p = (float*)m->points;
+
+            for ( j = 0U ; j < cnt ; ++j ) {
+                p[ j ] -= etaConsequent*k*g[ j ];
+            }
+            g += cnt;
+        }
+        for ( i = 0U ; i < t->f->nMFInputs ; ++i ) {
+            const qFIS_MF_t *m = &t->f->inMF[ i ];
+            const size_t cnt = qFIS_TrainParamCount( t, m, false );
+            /*cppcheck-suppress misra-c2012-11.8 */
+            float *p = (float*)m->points;
+            /*the widths ( and the gbellmf slope ) should not cross zero*/
+            const size_t nw = ( t->gbellShape == m->shape ) ? 2U : 1U;
+
+            for ( j = 0U ; j < cnt ; ++j ) {
+                const float v = p[ j ] - ( etaPremise*k*g[ j ] );
+
+                if ( ( j < nw ) && ( ( v*p[ j ] ) <= 0.0F ) ) {
+                    p[ j ] *= 0.5F;
+                }
+                else {
+                    p[ j ] = v;
+                }
+            }
+            g += cnt;
+        }
+        retVal = qFIS_Refresh( t->f );
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+const float* qFIS_TrainGetGradient( const qFIS_Trainer_t * const t,
+                                    size_t * const n )
+{
+    const float *g = NULL;
+
+    if ( ( NULL != t ) && ( NULL != t->f ) ) {
+        if ( NULL != n ) {
+            *n = t->nc + t->np;
+        }
+        g = t->g;
+    }
+
+    return g;
+}
+/*============================================================================*/
+float qFIS_TrainGetError( const qFIS_Trainer_t * const t )
+{
+    float e = -1.0F;
+
+    if ( ( NULL != t ) && ( t->nErr > 0U ) ) {
+        /*cstat -CERT-FLP36-C*/
+        e = QLIB_SQRT( t->sse/(float)t->nErr );
+        /*cstat +CERT-FLP36-C*/
+    }
+
+    return e;
+}
+/*============================================================================*/
+float qFIS_TrainEpoch( qFIS_Trainer_t * const t,
+                       const float *x,
+                       const float *y,
+                       const size_t n,
+                       const float eta,
+                       const float lambda )
+{
+    float e = -1.0F;
+
+    if ( ( 1 == qFIS_TrainReset( t ) ) &&
+         ( 1 == qFIS_TrainAccumulateLSE( t, x, y, n ) ) &&
+         ( 1 == qFIS_TrainSolveLSE( t, lambda ) ) &&
+         ( 1 == qFIS_TrainReset( t ) ) &&
+         ( 1 == qFIS_TrainAccumulateGradient( t, x, y, n ) ) ) {
+        e = qFIS_TrainGetError( t );
+        (void)qFIS_TrainStep( t, eta, 0.0F );
+    }
+
+    return e;
+}
+/*============================================================================*/
@@ -67,20 +67,95 @@ const struct _qFP16_const_s qFP16 = { //skipcq: CXX-E2000
     /*f_360*/           23592960,
 };
 
-static qFP16_Settings_t fp_default = { -2147483647, 2147483647, 1U, 0U }; //skipcq: CXX-W2009
-static qFP16_Settings_t *fp = &fp_default; //skipcq: CXX-W2009
+#if ( ( QFP16_CORDIC_ITERATIONS < 1 ) || ( QFP16_CORDIC_ITERATIONS > 28 ) )
+    #error "QFP16_CORDIC_ITERATIONS should be in the range [ 1, 28 ]"
+#endif
+
+/*CORDIC tables, all of them in Q2.29*/
+static const int32_t cordic_atan[ 28 ] = { /* atan( 2^-i ) */
+    421657428, 248918915, 131521918, 66762579, 33510843, 16771758, 8387925,
+    4194219, 2097141, 1048575, 524288, 262144, 131072, 65536, 32768, 16384,
+    8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8, 4
+};
+static const int32_t cordic_k[ 28 ] = { /* inverse gain of n circular steps */
+    379625062, 339546978, 329408954, 326865218, 326228674, 326069499,
+    326029703, 326019753, 326017266, 326016644, 326016489, 326016450,
+    326016440, 326016438, 326016437, 326016437, 326016437, 326016437,
+    326016437, 326016437, 326016437, 326016437, 326016437, 326016437,
+    326016437, 326016437, 326016437, 326016437
+};
+static const int32_t cordic_kh[ 28 ] = { /* inverse gain of n hyperbolic steps */
+    619925131, 640255922, 645317313, 647847969, 648164533, 648243669,
+    648263453, 648268399, 648269635, 648269944, 648270021, 648270041,
+    648270050, 648270052, 648270052, 648270052, 648270052, 648270052,
+    648270052, 648270052, 648270052, 648270052, 648270052, 648270052,
+    648270052, 648270052, 648270052, 648270052
+};
+static const int32_t cordic_pi = 1686629713;    /* [ pi ] */
+static const int32_t cordic_pi_2 = 843314857;   /* [ pi/2 ] */
+static const int32_t cordic_1_4 = 134217728;    /* [ 1/4 ] */
+/*argument reduction of the rotation mode*/
+static const int64_t cordic_2pi_45 = 221069929750889;   /* [ 2*pi ] in Q19.45 */
+static const int64_t cordic_pi_45 = 110534964875445;    /* [ pi ] in Q19.45 */
+static const int64_t cordic_1_2pi_32 = 683565276;       /* [ 1/(2*pi) ] in Q32 */
+
+/*digit pairs "00" to "99" used for the bulk text conversion*/
+static const char fp_digits[ 201 ] =
+    "000102030405060708091011121314151617181920212223242526272829"
+    "303132333435363738394041424344454647484950515253545556575859"
+    "606162636465666768697071727374757677787980818283848586878889"
+    "90919293949596979899";
+static const uint32_t fp_pow5[ 7 ] = { 1U, 5U, 25U, 125U, 625U, 3125U, 15625U };
+
+static const qFP16_Settings_t fp_default = { -2147483647, 2147483647, 1U, 0U };
+static const qFP16_Settings_t *fp = &fp_default; //skipcq: CXX-W2009
 
 /*! @endcond  */
 
-static qFP16_t qFP16_rs( const qFP16_t x );
-static qFP16_t qFP16_log2i( qFP16_t x );
+static qFP16_t qFP16_rs( const qFP16_Settings_t * const ctx,
+                         const qFP16_t x );
+static qFP16_t qFP16_log2i( const qFP16_Settings_t * const ctx,
+                            qFP16_t x );
 static char *qFP16_itoa( char *buf,
                          uint32_t scale,
                          uint32_t value,
                          uint8_t skip );
-static qFP16_t qFP16_Saturate( const qFP16_t nsInput,
-                               const qFP16_t x,
-                               const qFP16_t y );
+static inline qFP16_t qFP16_add( const qFP16_t X,
+                                 const qFP16_t Y );
+static inline qFP16_t qFP16_sub( const qFP16_t X,
+                                 const qFP16_t Y );
+static inline qFP16_t qFP16_mul( const qFP16_t x,
+                                 const qFP16_t y,
+                                 const uint8_t rounding );
+static inline qFP16_t qFP16_add_ctx( const qFP16_Settings_t * const ctx,
+                                     const qFP16_t X,
+                                     const qFP16_t Y );
+static inline qFP16_t qFP16_mul_ctx( const qFP16_Settings_t * const ctx,
+                                     const qFP16_t x,
+                                     const qFP16_t y );
+static qFP16_t qFP16_div( const qFP16_t x,
+                          const qFP16_t y,
+                          const uint8_t rounding,
+                          const qFP16_t min );
+static inline qFP16_t qFP16_Saturate( const qFP16_t nsInput,
+                                      const qFP16_t x,
+                                      const qFP16_t y,
+                                      const qFP16_t min,
+                                      const qFP16_t max );
+static int32_t qFP16_CordicGain( const int32_t x,
+                                 const int32_t k );
+static qFP16_t qFP16_CordicOut( const int32_t x );
+static uint8_t qFP16_Msb( uint32_t x );
+static char *qFP16_PutDigits( char *buf,
+                              uint32_t value,
+                              const uint32_t width );
+static size_t qFP16_FmtValue( char *buf,
+                              const qFP16_t num,
+                              const uint32_t decimals,
+                              const uint8_t rounding );
+static const char *qFP16_SkipSpaces( const char *s,
+                                     const char delim );
+static bool qFP16_IsOverflowText( const char *s );
 
 /*cstat -MISRAC2012-Rule-10.8 -CERT-FLP34-C -MISRAC2012-Rule-1.3_n -MISRAC2012-Rule-10.1_R6 -ATH-shift-neg -CERT-INT34-C_c*/
 
@@ -118,10 +193,16 @@ void qFP16_SettingsSelect( qFP16_Settings_t * const instance )
 }
 /*============================================================================*/
 int qFP16_FPToInt( const qFP16_t x )
+{
+    return qFP16_FPToInt_Ctx( fp, x );
+}
+/*============================================================================*/
+int qFP16_FPToInt_Ctx( const qFP16_Settings_t * const ctx,
+                       const qFP16_t x )
 {
     int retValue;
 
-    if ( 1U == fp->rounding ) {
+    if ( 1U == ctx->rounding ) {
         if ( x >= 0 ) {
             /*cppcheck-suppress misra-c2012-10.1 */
             retValue = ( x + ( qFP16.one >> 1 ) ) / qFP16.one;
@@ -144,12 +225,18 @@ qFP16_t qFP16_IntToFP( const int x )
 }
 /*============================================================================*/
 qFP16_t qFP16_FloatToFP( const float x )
+{
+    return qFP16_FloatToFP_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_FloatToFP_Ctx( const qFP16_Settings_t * const ctx,
+                             const float x )
 {
     float retValue;
     /*cstat -CERT-FLP36-C*/
     retValue = x * (float)qFP16.one;
     /*cstat +CERT-FLP36-C*/
-    if ( 1U == fp->rounding ) {
+    if ( 1U == ctx->rounding ) {
         retValue += ( retValue >= 0.0F ) ? 0.5F : -0.5F;
     }
 
@@ -164,12 +251,18 @@ float qFP16_FPToFloat( const qFP16_t x )
 }
 /*============================================================================*/
 qFP16_t qFP16_DoubleToFP( const double x )
+{
+    return qFP16_DoubleToFP_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_DoubleToFP_Ctx( const qFP16_Settings_t * const ctx,
+                              const double x )
 {
     double retValue;
     /*cstat -CERT-FLP36-C*/
     retValue = x * (double)qFP16.one;
     /*cstat +CERT-FLP36-C*/
-    if ( 1U == fp->rounding ) {
+    if ( 1U == ctx->rounding ) {
         retValue += ( retValue >= 0.0 ) ? 0.5 : -0.5;
     }
 
@@ -184,10 +277,16 @@ double qFP16_FPToDouble( const qFP16_t x )
 }
 /*============================================================================*/
 qFP16_t qFP16_Abs( const qFP16_t x )
+{
+    return qFP16_Abs_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Abs_Ctx( const qFP16_Settings_t * const ctx,
+                       const qFP16_t x )
 {
     qFP16_t retValue;
 
-    if ( x == fp->min ) {
+    if ( x == ctx->min ) {
         retValue = qFP16.overflow;
     }
     else {
@@ -219,140 +318,138 @@ qFP16_t qFP16_Round( const qFP16_t x )
 qFP16_t qFP16_Add( const qFP16_t X,
                    const qFP16_t Y )
 {
-    uint32_t x = (uint32_t)X, y = (uint32_t)Y;
-    uint32_t retValue;
-
-    retValue =  x + y;
-    if ( ( 0U == ( ( x ^ y ) & intern.overflow_mask ) ) && ( 0U != ( ( x ^ retValue ) & intern.overflow_mask ) ) ) {
-        retValue = (uint32_t)qFP16.overflow;
-    }
-
-    return qFP16_Saturate( (qFP16_t)retValue, X, X );
+    return qFP16_Add_Ctx( fp, X, Y );
+}
+/*============================================================================*/
+qFP16_t qFP16_Add_Ctx( const qFP16_Settings_t * const ctx,
+                       const qFP16_t X,
+                       const qFP16_t Y )
+{
+    return qFP16_add_ctx( ctx, X, Y );
+}
+/*============================================================================*/
+qFP16_t qFP16_Add_Sat( const qFP16_t X,
+                       const qFP16_t Y )
+{
+    return qFP16_Saturate( qFP16_add( X, Y ), X, qFP16.one, -qFP16.max, qFP16.max );
+}
+/*============================================================================*/
+qFP16_t qFP16_Add_NoSat( const qFP16_t X,
+                         const qFP16_t Y )
+{
+    return qFP16_add( X, Y );
 }
 /*============================================================================*/
 qFP16_t qFP16_Sub( const qFP16_t X,
                    const qFP16_t Y )
 {
-    uint32_t x = (uint32_t)X, y = (uint32_t)Y;
-    uint32_t retValue;
+    return qFP16_Sub_Ctx( fp, X, Y );
+}
+/*============================================================================*/
+qFP16_t qFP16_Sub_Ctx( const qFP16_Settings_t * const ctx,
+                       const qFP16_t X,
+                       const qFP16_t Y )
+{
+    qFP16_t retValue = qFP16_sub( X, Y );
 
-    retValue =  x - y;
-    if ( ( 0U != ( ( x ^ y ) & intern.overflow_mask ) ) && ( 0U != ( ( x ^ retValue ) & intern.overflow_mask ) ) ) {
-        retValue = (uint32_t)qFP16.overflow;
+    if ( 1U == ctx->saturate ) {
+        /*an overflowed result always takes the sign of X*/
+        retValue = qFP16_Saturate( retValue, X, qFP16.one, ctx->min, ctx->max );
     }
 
-    return qFP16_Saturate( (qFP16_t)retValue, X, X );
+    return retValue;
+}
+/*============================================================================*/
+qFP16_t qFP16_Sub_Sat( const qFP16_t X,
+                       const qFP16_t Y )
+{
+    return qFP16_Saturate( qFP16_sub( X, Y ), X, qFP16.one, -qFP16.max, qFP16.max );
+}
+/*============================================================================*/
+qFP16_t qFP16_Sub_NoSat( const qFP16_t X,
+                         const qFP16_t Y )
+{
+    return qFP16_sub( X, Y );
 }
 /*============================================================================*/
 qFP16_t qFP16_Mul( const qFP16_t x,
                    const qFP16_t y )
 {
-    qFP16_t retValue = qFP16.overflow;
-    int32_t a, c, ac, adcb, mulH;
-    uint32_t b, d, bd, tmp, mulL;
-    /*cstat -MISRAC2012-Rule-10.3*/
-    /*cppcheck-suppress misra-c2012-10.1 */
-    a = ( x >> 16 );
-    /*cppcheck-suppress misra-c2012-10.1 */
-    c = ( y >> 16 );
-    b = ( x & 0xFFFF );
-    d = ( y & 0xFFFF );
-    /*cstat +MISRAC2012-Rule-10.3*/
-    ac = a*c;
-    /*cppcheck-suppress misra-c2012-10.8 */
-    adcb = (int32_t)( ( (uint32_t)a*d ) + ( (uint32_t)c*b ) );
-    bd = b*d;
-    /*cppcheck-suppress misra-c2012-10.1 */
-    mulH = ac + ( adcb >> 16 );
-    tmp = (uint32_t)adcb << 16;
-    mulL = bd + tmp;
-    if ( mulL < bd ) {
-        ++mulH;
-    }
-    /*cppcheck-suppress misra-c2012-10.6 */
-    a = ( mulH < 0 ) ? -1 : 0;
-    /*cppcheck-suppress misra-c2012-10.1 */
-    if ( a == ( mulH >> 15 ) ) {
-        if ( 1U == fp->rounding ) {
-            uint32_t tmp2;
-
-            tmp2 = mulL;
-            mulL -= (uint32_t)qFP16.one_half;
-            mulL -= (uint32_t)mulH >> 31;
-            if ( mulL > tmp2 ) {
-                --mulH;
-            }
-            /*cppcheck-suppress misra-c2012-10.1 */
-            retValue = (qFP16_t)( mulH << 16 ) | (qFP16_t)( mulL >> 16 );
-            retValue += 1;
-        }
-        else {
-            /*cppcheck-suppress misra-c2012-10.1 */
-            retValue = (qFP16_t)( mulH << 16 ) | (qFP16_t)( mulL >> 16 );
-        }
-    }
-
-    return qFP16_Saturate( retValue, x, y );
+    return qFP16_Mul_Ctx( fp, x, y );
+}
+/*============================================================================*/
+qFP16_t qFP16_Mul_Ctx( const qFP16_Settings_t * const ctx,
+                       const qFP16_t x,
+                       const qFP16_t y )
+{
+    return qFP16_mul_ctx( ctx, x, y );
+}
+/*============================================================================*/
+qFP16_t qFP16_Mul_RoundSat( const qFP16_t x,
+                            const qFP16_t y )
+{
+    return qFP16_Saturate( qFP16_mul( x, y, 1U ), x, y, -qFP16.max, qFP16.max );
+}
+/*============================================================================*/
+qFP16_t qFP16_Mul_Round( const qFP16_t x,
+                         const qFP16_t y )
+{
+    return qFP16_mul( x, y, 1U );
+}
+/*============================================================================*/
+qFP16_t qFP16_Mul_TruncSat( const qFP16_t x,
+                            const qFP16_t y )
+{
+    return qFP16_Saturate( qFP16_mul( x, y, 0U ), x, y, -qFP16.max, qFP16.max );
+}
+/*============================================================================*/
+qFP16_t qFP16_Mul_Trunc( const qFP16_t x,
+                         const qFP16_t y )
+{
+    return qFP16_mul( x, y, 0U );
 }
 /*============================================================================*/
 qFP16_t qFP16_Div( const qFP16_t x,
                    const qFP16_t y )
 {
-    qFP16_t retValue = fp->min;
-
-    if ( 0 != y ) {
-        uint32_t xRem, xDiv, bit = 0x10000U;
-
-        xRem = (uint32_t)( ( x >= 0 ) ? x : -x );
-        xDiv = (uint32_t)( ( y >= 0 ) ? y : -y );
-
-        while ( xDiv < xRem ) {
-            xDiv <<= 1;
-            bit <<= 1;
-        }
-        retValue = qFP16.overflow;
-        /*cstat -MISRAC2012-Rule-14.3_a*/
-        if ( 0U != bit ) { /*MISRAC2012-Rule-14.3_a false positive*/
-        /*cstat +MISRAC2012-Rule-14.3_a*/
-            uint32_t quotient = 0U;
-
-            if ( 0U != ( xDiv & 0x80000000U ) ) {
-                if ( xRem >= xDiv ) {
-                    quotient |= bit;
-                    xRem -= xDiv;
-                }
-                xDiv >>= 1;
-                bit >>= 1;
-            }
-
-            while ( ( 0U != bit ) && ( 0U != xRem ) ) {
-                if ( xRem >= xDiv ) {
-                    quotient |= bit;
-                    xRem -= xDiv;
-                }
-                xRem <<= 1;
-                bit >>= 1;
-            }
-            if ( 1U == fp->rounding ) {
-                if ( xRem >= xDiv ) {
-                    ++quotient;
-                }
-            }
+    return qFP16_Div_Ctx( fp, x, y );
+}
+/*============================================================================*/
+qFP16_t qFP16_Div_Ctx( const qFP16_Settings_t * const ctx,
+                       const qFP16_t x,
+                       const qFP16_t y )
+{
+    qFP16_t retValue = qFP16_div( x, y, ctx->rounding, ctx->min );
 
-            retValue = (qFP16_t)quotient;
-            /*cppcheck-suppress misra-c2012-10.8 */
-            if ( 0U != ( (uint32_t)( x ^ y ) & intern.overflow_mask ) ) {
-                if ( quotient == (uint32_t)fp->min ) {
-                    retValue = qFP16.overflow;
-                }
-                else {
-                    retValue = -retValue;
-                }
-            }
-        }
+    if ( 1U == ctx->saturate ) {
+        retValue = qFP16_Saturate( retValue, x, y, ctx->min, ctx->max );
     }
 
-    return qFP16_Saturate( retValue, x, y );
+    return retValue;
+}
+/*============================================================================*/
+qFP16_t qFP16_Div_RoundSat( const qFP16_t x,
+                            const qFP16_t y )
+{
+    return qFP16_Saturate( qFP16_div( x, y, 1U, -qFP16.max ), x, y, -qFP16.max, qFP16.max );
+}
+/*============================================================================*/
+qFP16_t qFP16_Div_Round( const qFP16_t x,
+                         const qFP16_t y )
+{
+    return qFP16_div( x, y, 1U, -qFP16.max );
+}
+/*============================================================================*/
+qFP16_t qFP16_Div_TruncSat( const qFP16_t x,
+                            const qFP16_t y )
+{
+    return qFP16_Saturate( qFP16_div( x, y, 0U, -qFP16.max ), x, y, -qFP16.max, qFP16.max );
+}
+/*============================================================================*/
+qFP16_t qFP16_Div_Trunc( const qFP16_t x,
+                         const qFP16_t y )
+{
+    return qFP16_div( x, y, 0U, -qFP16.max );
 }
 /*============================================================================*/
 qFP16_t qFP16_Mod( const qFP16_t x,
@@ -368,61 +465,75 @@ qFP16_t qFP16_Mod( const qFP16_t x,
 }
 /*============================================================================*/
 qFP16_t qFP16_Sqrt( qFP16_t x )
+{
+    return qFP16_Sqrt_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Sqrt_Ctx( const qFP16_Settings_t * const ctx,
+                        qFP16_t x )
 {
     qFP16_t retValue = qFP16.overflow;
 
-    if ( x > 0 ) {
-        uint32_t bit;
-        uint8_t n;
+    if ( 0 == x ) {
         retValue = 0;
+    }
+    else if ( x > 0 ) {
+        /*the remainder takes up to 32 bits, so work with unsigned values*/
+        uint32_t num = (uint32_t)x, result = 0U, bit;
+        uint8_t n;
         /*cstat -ATH-shift-bounds -MISRAC2012-Rule-12.2 -CERT-INT34-C_b*/
         /*cppcheck-suppress [ cert-INT31-c, misra-c2012-12.2, misra-c2012-12.1  ]*/
-        bit = ( 0 != ( x & (qFP16_t)4293918720 ) ) ? ( 1U << 30U ) : ( 1U << 18U );
-        while ( bit > (uint32_t)x ) {
+        bit = ( 0U != ( num & 0xFFF00000U ) ) ? ( 1U << 30U ) : ( 1U << 18U );
+        while ( bit > num ) {
             bit >>= 2U;
         }
 
         for ( n = 0U ; n < 2U ; ++n ) {
             while ( 0U != bit ) {
-                /*cppcheck-suppress misra-c2012-10.8 */
-                if ( x >= (qFP16_t)( (uint32_t)retValue + bit ) ) {
-                    /*cppcheck-suppress misra-c2012-10.8 */
-                    x -= (qFP16_t)( (uint32_t)retValue + bit );
-                    /*cppcheck-suppress misra-c2012-10.8 */
-                    retValue = (qFP16_t)( ( (uint32_t)retValue >> 1U ) + bit );
+                if ( num >= ( result + bit ) ) {
+                    num -= result + bit;
+                    result = ( result >> 1U ) + bit;
                 }
                 else {
-                    /*cppcheck-suppress misra-c2012-10.1 */
-                    retValue = ( retValue >> 1 );
+                    result >>= 1U;
                 }
                 bit >>= 2U;
             }
 
             if ( 0U == n ) {
-                if ( x > 65535 ) {
-                    x -= retValue;
-                    /*cppcheck-suppress misra-c2012-10.1 */
-                    x = ( x << 16 ) - qFP16.one_half;
-                    /*cppcheck-suppress misra-c2012-10.1 */
-                    retValue = ( retValue << 16 ) + qFP16.one_half;
+                if ( num > 65535U ) {
+                    num -= result;
+                    num = ( num << 16U ) - (uint32_t)qFP16.one_half;
+                    result = ( result << 16U ) + (uint32_t)qFP16.one_half;
                 }
                 else {
-                    x <<= 16;
-                    retValue <<= 16;
+                    num <<= 16U;
+                    result <<= 16U;
                 }
                 /*cppcheck-suppress [ misra-c2012-10.6, misra-c2012-12.2 ] */
                 bit = 1U << 14U;
             }
         }
+        if ( ( 1U == ctx->rounding ) && ( num > result ) ) {
+            ++result;
+        }
+        /*cstat +ATH-shift-bounds +MISRAC2012-Rule-12.2 +CERT-INT34-C_b*/
+        retValue = (qFP16_t)result;
     }
-    if ( ( 1U == fp->rounding ) && ( x > retValue ) ) {
-        ++retValue;
+    else {
+        /*nothing to do*/
     }
-    /*cstat +ATH-shift-bounds +MISRAC2012-Rule-12.2 +CERT-INT34-C_b*/
-    return (qFP16_t)retValue;
+
+    return retValue;
 }
 /*============================================================================*/
 qFP16_t qFP16_Exp( qFP16_t x )
+{
+    return qFP16_Exp_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Exp_Ctx( const qFP16_Settings_t * const ctx,
+                       qFP16_t x )
 {
     qFP16_t retValue, term;
     bool isNegative;
@@ -435,7 +546,7 @@ qFP16_t qFP16_Exp( qFP16_t x )
         retValue = qFP16.f_e;
     }
     else if ( x >= intern.exp_max ) {
-        retValue = fp->max;
+        retValue = ctx->max;
     }
     else if ( x <= -intern.exp_max ) {
         retValue = 0;
@@ -450,7 +561,7 @@ qFP16_t qFP16_Exp( qFP16_t x )
         term = x;
 
         for ( i = 2 ; i < 30 ; ++i ) {
-            term = qFP16_Mul( term, qFP16_Div( x, qFP16_IntToFP( i ) ) );
+            term = qFP16_Mul_Ctx( ctx, term, qFP16_Div_Ctx( ctx, x, qFP16_IntToFP( i ) ) );
             retValue += term;
 
             if ( ( term < 500 ) && ( ( i > 15 ) || ( term < 20 ) ) ) {
@@ -459,7 +570,7 @@ qFP16_t qFP16_Exp( qFP16_t x )
         }
 
         if ( isNegative ) {
-            retValue = qFP16_Div( qFP16.one, retValue );
+            retValue = qFP16_Div_Ctx( ctx, qFP16.one, retValue );
         }
     }
 
@@ -467,6 +578,12 @@ qFP16_t qFP16_Exp( qFP16_t x )
 }
 /*============================================================================*/
 qFP16_t qFP16_Log( qFP16_t x )
+{
+    return qFP16_Log_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Log_Ctx( const qFP16_Settings_t * const ctx,
+                       qFP16_t x )
 {
     qFP16_t retValue = qFP16.overflow;
     static const qFP16_t e4 = 3578144; /*e^4*/
@@ -476,19 +593,19 @@ qFP16_t qFP16_Log( qFP16_t x )
         int scaling = 0, count = 0;
 
         while ( x > intern.f_100 ) {
-            x = qFP16_Div( x, e4 );
+            x = qFP16_Div_Ctx( ctx, x, e4 );
             scaling += 4;
         }
 
         while ( x < qFP16.one ) {
-            x = qFP16_Mul( x, e4 );
+            x = qFP16_Mul_Ctx( ctx, x, e4 );
             scaling -= 4;
         }
 
         do {
-            qFP16_t e = qFP16_Exp( guess );
+            qFP16_t e = qFP16_Exp_Ctx( ctx, guess );
 
-            delta = qFP16_Div( x - e , e );
+            delta = qFP16_Div_Ctx( ctx, x - e , e );
 
             if ( delta > intern.f_3 ) {
                 delta = intern.f_3;
@@ -503,6 +620,12 @@ qFP16_t qFP16_Log( qFP16_t x )
 }
 /*============================================================================*/
 qFP16_t qFP16_Log2( const qFP16_t x )
+{
+    return qFP16_Log2_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Log2_Ctx( const qFP16_Settings_t * const ctx,
+                        const qFP16_t x )
 {
     qFP16_t retValue = qFP16.overflow;
 
@@ -513,17 +636,17 @@ qFP16_t qFP16_Log2( const qFP16_t x )
             }
             else {
                 qFP16_t inv;
-                inv = qFP16_Div( qFP16.one, x );
-                retValue = -qFP16_log2i( inv );
+                inv = qFP16_Div_Ctx( ctx, qFP16.one, x );
+                retValue = -qFP16_log2i( ctx, inv );
             }
         }
         else {
-            retValue = qFP16_log2i( x );
+            retValue = qFP16_log2i( ctx, x );
         }
     }
-    if ( 1U == fp->saturate ) {
+    if ( 1U == ctx->saturate ) {
         if ( qFP16.overflow == retValue ) {
-            retValue = fp->min;
+            retValue = ctx->min;
         }
     }
 
@@ -532,12 +655,24 @@ qFP16_t qFP16_Log2( const qFP16_t x )
 /*============================================================================*/
 qFP16_t qFP16_RadToDeg( const qFP16_t x )
 {
-    return qFP16_Mul( qFP16_WrapToPi( x ), qFP16.f_180_pi );
+    return qFP16_RadToDeg_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_RadToDeg_Ctx( const qFP16_Settings_t * const ctx,
+                            const qFP16_t x )
+{
+    return qFP16_Mul_Ctx( ctx, qFP16_WrapToPi( x ), qFP16.f_180_pi );
 }
 /*============================================================================*/
 qFP16_t qFP16_DegToRad( qFP16_t x )
 {
-    return qFP16_Mul( qFP16_WrapTo180( x ), qFP16.f_pi_180 );
+    return qFP16_DegToRad_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_DegToRad_Ctx( const qFP16_Settings_t * const ctx,
+                            qFP16_t x )
+{
+    return qFP16_Mul_Ctx( ctx, qFP16_WrapTo180( x ), qFP16.f_pi_180 );
 }
 /*============================================================================*/
 qFP16_t qFP16_WrapToPi( qFP16_t x )
@@ -570,43 +705,91 @@ qFP16_t qFP16_WrapTo180( qFP16_t x )
 /*============================================================================*/
 qFP16_t qFP16_Sin( qFP16_t x )
 {
-    qFP16_t retValue, x2;
+    return qFP16_Sin_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Sin_Ctx( const qFP16_Settings_t * const ctx,
+                       qFP16_t x )
+{
+    qFP16_t retValue;
+#ifdef QFP16_USE_CORDIC
+    (void)ctx;
+    (void)qFP16_CordicSinCos( x, &retValue, NULL );
+#else
+    qFP16_t x2;
 
     x = qFP16_WrapToPi( x );
-    x2 = qFP16_Mul( x ,x );
+    x2 = qFP16_Mul_Ctx( ctx, x ,x );
     retValue = x;
-    x = qFP16_Mul( x, x2 );
+    x = qFP16_Mul_Ctx( ctx, x, x2 );
     retValue -= ( x / 6 ); /*x^3/3!*/
-    x = qFP16_Mul( x, x2 );
+    x = qFP16_Mul_Ctx( ctx, x, x2 );
     retValue += ( x / 120 ); /*x^5/5!*/
-    x = qFP16_Mul( x, x2 );
+    x = qFP16_Mul_Ctx( ctx, x, x2 );
     retValue -= ( x / 5040 ); /*x^7/7!*/
-    x = qFP16_Mul( x, x2 );
+    x = qFP16_Mul_Ctx( ctx, x, x2 );
     retValue += ( x / 362880 ); /*x^9/9!*/
-    x = qFP16_Mul( x, x2);
+    x = qFP16_Mul_Ctx( ctx, x, x2);
     retValue -= ( x / 39916800 ); /*x^11/11!*/
+#endif
 
     return retValue;
 }
 /*============================================================================*/
 qFP16_t qFP16_Cos( qFP16_t x )
 {
-    return qFP16_Sin( x + qFP16.f_pi_2 );
+    return qFP16_Cos_Ctx( fp, x );
 }
 /*============================================================================*/
-qFP16_t qFP16_Tan( qFP16_t x )
+qFP16_t qFP16_Cos_Ctx( const qFP16_Settings_t * const ctx,
+                       qFP16_t x )
 {
-    qFP16_t a ,b;
+#ifdef QFP16_USE_CORDIC
+    qFP16_t retValue;
 
-    a = qFP16_Sin( x );
-    b = qFP16_Cos( x );
+    (void)ctx;
+    (void)qFP16_CordicSinCos( x, NULL, &retValue );
 
-    return qFP16_Div( a, b );
+    return retValue;
+#else
+    return qFP16_Sin_Ctx( ctx, x + qFP16.f_pi_2 );
+#endif
+}
+/*============================================================================*/
+qFP16_t qFP16_Tan( qFP16_t x )
+{
+    return qFP16_Tan_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Tan_Ctx( const qFP16_Settings_t * const ctx,
+                       qFP16_t x )
+{
+    qFP16_t a ,b;
+#ifdef QFP16_USE_CORDIC
+    (void)qFP16_CordicSinCos( x, &a, &b );
+#else
+    a = qFP16_Sin_Ctx( ctx, x );
+    b = qFP16_Cos_Ctx( ctx, x );
+#endif
+
+    return qFP16_Div_Ctx( ctx, a, b );
 }
 /*============================================================================*/
 qFP16_t qFP16_Atan2( const qFP16_t y,
                      const qFP16_t x )
 {
+    return qFP16_Atan2_Ctx( fp, y, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Atan2_Ctx( const qFP16_Settings_t * const ctx,
+                         const qFP16_t y,
+                         const qFP16_t x )
+{
+#ifdef QFP16_USE_CORDIC
+    (void)ctx;
+
+    return qFP16_CordicAtan2( y, x, NULL );
+#else
     qFP16_t absY, mask, angle, r, r_3;
     const qFP16_t QFP16_0_981689 = 0x0000FB50;
     const qFP16_t QFP16_0_196289 = 0x00003240;
@@ -615,37 +798,50 @@ qFP16_t qFP16_Atan2( const qFP16_t y,
     mask = ( y >> ( sizeof(qFP16_t)*7U ) );
     absY = ( y + mask ) ^ mask;
     if ( x >= 0 ) {
-        r = qFP16_Div( ( x - absY ), ( x + absY ) );
+        r = qFP16_Div_Ctx( ctx, ( x - absY ), ( x + absY ) );
         angle = qFP16.f_pi_4;
     }
     else {
-        r = qFP16_Div( ( x + absY ), ( absY - x ) );
+        r = qFP16_Div_Ctx( ctx, ( x + absY ), ( absY - x ) );
         angle = f_3pi_div_4;
     }
-    r_3 = qFP16_Mul( qFP16_Mul( r, r ), r );
+    r_3 = qFP16_Mul_Ctx( ctx, qFP16_Mul_Ctx( ctx, r, r ), r );
     /* 3rd order polynomial approximation*/
-    angle += qFP16_Mul( QFP16_0_196289, r_3 ) - qFP16_Mul( QFP16_0_981689, r );
+    angle += qFP16_Mul_Ctx( ctx, QFP16_0_196289, r_3 ) - qFP16_Mul_Ctx( ctx, QFP16_0_981689, r );
     /*cstat -ATH-neg-check-nonneg*/
     if ( y < 0 ) { /*ATH-neg-check-nonneg false positive*/
         angle = -angle;
     }
     /*cstat +ATH-neg-check-nonneg*/
     return angle;
+#endif
 }
 /*============================================================================*/
 qFP16_t qFP16_Atan( qFP16_t x )
 {
-    return qFP16_Atan2( x, qFP16.one );
+    return qFP16_Atan_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Atan_Ctx( const qFP16_Settings_t * const ctx,
+                        qFP16_t x )
+{
+    return qFP16_Atan2_Ctx( ctx, x, qFP16.one );
 }
 /*============================================================================*/
 qFP16_t qFP16_Asin( qFP16_t x )
+{
+    return qFP16_Asin_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Asin_Ctx( const qFP16_Settings_t * const ctx,
+                        qFP16_t x )
 {
     qFP16_t retValue = 0;
 
     if ( ( x <= qFP16.one ) && ( x >= -qFP16.one ) ) {
-        retValue = qFP16.one - qFP16_Mul( x, x );
-        retValue = qFP16_Div( x, qFP16_Sqrt( retValue ) );
-        retValue = qFP16_Atan( retValue );
+        retValue = qFP16.one - qFP16_Mul_Ctx( ctx, x, x );
+        retValue = qFP16_Div_Ctx( ctx, x, qFP16_Sqrt_Ctx( ctx, retValue ) );
+        retValue = qFP16_Atan_Ctx( ctx, retValue );
     }
 
     return retValue;
@@ -653,10 +849,22 @@ qFP16_t qFP16_Asin( qFP16_t x )
 /*============================================================================*/
 qFP16_t qFP16_Acos( qFP16_t x )
 {
-    return ( qFP16.f_pi_2 - qFP16_Asin( x ) );
+    return qFP16_Acos_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Acos_Ctx( const qFP16_Settings_t * const ctx,
+                        qFP16_t x )
+{
+    return ( qFP16.f_pi_2 - qFP16_Asin_Ctx( ctx, x ) );
 }
 /*============================================================================*/
 qFP16_t qFP16_Cosh( qFP16_t x )
+{
+    return qFP16_Cosh_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Cosh_Ctx( const qFP16_Settings_t * const ctx,
+                        qFP16_t x )
 {
     qFP16_t retValue = qFP16.overflow;
     qFP16_t epx, enx;
@@ -665,11 +873,11 @@ qFP16_t qFP16_Cosh( qFP16_t x )
         retValue = qFP16.one;
     }
     else if ( ( x >= intern.exp_max ) || ( x <= -intern.exp_max ) ) {
-        retValue = fp->max;
+        retValue = ctx->max;
     }
     else {
-        epx = qFP16_Exp( x );
-        enx = qFP16_Exp( -x );
+        epx = qFP16_Exp_Ctx( ctx, x );
+        enx = qFP16_Exp_Ctx( ctx, -x );
         if ( ( qFP16.overflow != epx ) && ( qFP16.overflow != enx ) ) {
             retValue = epx + enx;
             /*cppcheck-suppress misra-c2012-10.1 */
@@ -681,6 +889,12 @@ qFP16_t qFP16_Cosh( qFP16_t x )
 }
 /*============================================================================*/
 qFP16_t qFP16_Sinh( qFP16_t x )
+{
+    return qFP16_Sinh_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Sinh_Ctx( const qFP16_Settings_t * const ctx,
+                        qFP16_t x )
 {
     qFP16_t retValue = qFP16.overflow;
     qFP16_t epx, enx;
@@ -689,14 +903,14 @@ qFP16_t qFP16_Sinh( qFP16_t x )
         retValue = qFP16.one;
     }
     else if ( x >= intern.exp_max ) {
-        retValue = fp->max;
+        retValue = ctx->max;
     }
     else if ( x <= -intern.exp_max ) {
-        retValue = -fp->max;
+        retValue = -ctx->max;
     }
     else {
-        epx = qFP16_Exp( x );
-        enx = qFP16_Exp( -x );
+        epx = qFP16_Exp_Ctx( ctx, x );
+        enx = qFP16_Exp_Ctx( ctx, -x );
         if ( ( qFP16.overflow != epx ) && ( qFP16.overflow != enx ) ) {
             retValue = epx - enx;
             /*cppcheck-suppress misra-c2012-10.1 */
@@ -708,6 +922,12 @@ qFP16_t qFP16_Sinh( qFP16_t x )
 }
 /*============================================================================*/
 qFP16_t qFP16_Tanh( qFP16_t x )
+{
+    return qFP16_Tanh_Ctx( fp, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Tanh_Ctx( const qFP16_Settings_t * const ctx,
+                        qFP16_t x )
 {
     qFP16_t retValue, epx, enx;
 
@@ -721,10 +941,10 @@ qFP16_t qFP16_Tanh( qFP16_t x )
         retValue = -qFP16.one;
     }
     else {
-        retValue = qFP16_Abs( x );
-        epx = qFP16_Exp( retValue );
-        enx = qFP16_Exp( -retValue );
-        retValue = qFP16_Div( epx - enx, epx + enx );
+        retValue = qFP16_Abs_Ctx( ctx, x );
+        epx = qFP16_Exp_Ctx( ctx, retValue );
+        enx = qFP16_Exp_Ctx( ctx, -retValue );
+        retValue = qFP16_Div_Ctx( ctx, epx - enx, epx + enx );
         retValue = ( x > 0 ) ? retValue : -retValue;
     }
 
@@ -734,19 +954,27 @@ qFP16_t qFP16_Tanh( qFP16_t x )
 qFP16_t qFP16_Polyval( const qFP16_t * const p,
                        const size_t n,
                        const qFP16_t x )
+{
+    return qFP16_Polyval_Ctx( fp, p, n, x );
+}
+/*============================================================================*/
+qFP16_t qFP16_Polyval_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t * const p,
+                           const size_t n,
+                           const qFP16_t x )
 {
     qFP16_t fx;
     size_t i;
     /*polynomial evaluation using Horner's method*/
     fx = p[ 0 ];
     for ( i = 1U ; i < n ; ++i ) {
-        qFP16_t tmp = qFP16_Mul( fx, x );
+        qFP16_t tmp = qFP16_Mul_Ctx( ctx, fx, x );
 
         if ( qFP16.overflow == tmp ) {
             fx = qFP16.overflow;
             break;
         }
-        fx =  qFP16_Add( tmp , p[ i ] );
+        fx =  qFP16_Add_Ctx( ctx, tmp , p[ i ] );
     }
 
     return fx;
@@ -754,6 +982,13 @@ qFP16_t qFP16_Polyval( const qFP16_t * const p,
 /*============================================================================*/
 qFP16_t qFP16_IPow( const qFP16_t x,
                     const qFP16_t y )
+{
+    return qFP16_IPow_Ctx( fp, x, y );
+}
+/*============================================================================*/
+qFP16_t qFP16_IPow_Ctx( const qFP16_Settings_t * const ctx,
+                        const qFP16_t x,
+                        const qFP16_t y )
 {
     qFP16_t retValue;
     qFP16_t n;
@@ -770,7 +1005,7 @@ qFP16_t qFP16_IPow( const qFP16_t x,
     }
     else {
         for ( i = 0 ; i < n ; ++i ) {
-            retValue = qFP16_Mul( x, retValue );
+            retValue = qFP16_Mul_Ctx( ctx, x, retValue );
             if ( qFP16.overflow == retValue ) {
                 break;
             }
@@ -782,18 +1017,25 @@ qFP16_t qFP16_IPow( const qFP16_t x,
 /*============================================================================*/
 qFP16_t qFP16_Pow( const qFP16_t x,
                    const qFP16_t y )
+{
+    return qFP16_Pow_Ctx( fp, x, y );
+}
+/*============================================================================*/
+qFP16_t qFP16_Pow_Ctx( const qFP16_Settings_t * const ctx,
+                       const qFP16_t x,
+                       const qFP16_t y )
 {
     qFP16_t retValue = qFP16.overflow;
 
     if ( ( 0U == ( (uint32_t)y & intern.fraction_mask ) ) && ( y > 0 ) ) {
         /*handle integer exponent explicitly*/
-        retValue = qFP16_IPow( x, y );
+        retValue = qFP16_IPow_Ctx( ctx, x, y );
     }
     else {
         qFP16_t tmp;
-        tmp = qFP16_Mul( y, qFP16_Log( qFP16_Abs( x ) ) );
+        tmp = qFP16_Mul_Ctx( ctx, y, qFP16_Log_Ctx( ctx, qFP16_Abs_Ctx( ctx, x ) ) );
         if ( qFP16.overflow != tmp ) {
-            retValue = qFP16_Exp( tmp );
+            retValue = qFP16_Exp_Ctx( ctx, tmp );
             if ( x < 0 ) {
                 retValue = -retValue;
             }
@@ -803,25 +1045,407 @@ qFP16_t qFP16_Pow( const qFP16_t x,
     return retValue;
 }
 /*============================================================================*/
-char* qFP16_FPToA( const qFP16_t num,
-                   char *str,
-                   int decimals )
+qFP16_t* qFP16_ArrayAdd( qFP16_t * const dst,
+                         const qFP16_t * const x,
+                         const qFP16_t * const y,
+                         const size_t n )
 {
-    char *retValue = str;
+    return qFP16_ArrayAdd_Ctx( fp, dst, x, y, n );
+}
+/*============================================================================*/
+qFP16_t* qFP16_ArrayAdd_Ctx( const qFP16_Settings_t * const ctx,
+                             qFP16_t * const dst,
+                             const qFP16_t * const x,
+                             const qFP16_t * const y,
+                             const size_t n )
+{
+    qFP16_t *retValue = NULL;
 
-    if ( qFP16.overflow == num ) {
-        str[ 0 ] = 'o';
-        str[ 1 ] = 'v';
-        str[ 2 ] = 'e';
-        str[ 3 ] = 'r';
-        str[ 4 ] = 'f';
-        str[ 5 ] = 'l';
-        str[ 6 ] = 'o';
-        str[ 7 ] = 'w';
-        str[ 8 ] = '\0';
+    if ( ( NULL != ctx ) && ( NULL != dst ) && ( NULL != x ) && ( NULL != y ) ) {
+        const qFP16_Settings_t s = *ctx; /*dst can not alias the local copy*/
+        size_t i;
+
+        for ( i = 0U ; i < n ; ++i ) {
+            dst[ i ] = qFP16_add_ctx( &s, x[ i ], y[ i ] );
+        }
+        retValue = dst;
     }
-    else {
-        const uint32_t iScales[ 6 ] = { 1U, 10U, 100U, 1000U, 10000U, 100000U };
+
+    return retValue;
+}
+/*============================================================================*/
+qFP16_t* qFP16_ArraySub( qFP16_t * const dst,
+                         const qFP16_t * const x,
+                         const qFP16_t * const y,
+                         const size_t n )
+{
+    return qFP16_ArraySub_Ctx( fp, dst, x, y, n );
+}
+/*============================================================================*/
+qFP16_t* qFP16_ArraySub_Ctx( const qFP16_Settings_t * const ctx,
+                             qFP16_t * const dst,
+                             const qFP16_t * const x,
+                             const qFP16_t * const y,
+                             const size_t n )
+{
+    qFP16_t *retValue = NULL;
+
+    if ( ( NULL != ctx ) && ( NULL != dst ) && ( NULL != x ) && ( NULL != y ) ) {
+        const qFP16_Settings_t s = *ctx; /*dst can not alias the local copy*/
+        size_t i;
+
+        for ( i = 0U ; i < n ; ++i ) {
+            dst[ i ] = qFP16_Sub_Ctx( &s, x[ i ], y[ i ] );
+        }
+        retValue = dst;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+qFP16_t* qFP16_ArrayMul( qFP16_t * const dst,
+                         const qFP16_t * const x,
+                         const qFP16_t * const y,
+                         const size_t n )
+{
+    return qFP16_ArrayMul_Ctx( fp, dst, x, y, n );
+}
+/*============================================================================*/
+qFP16_t* qFP16_ArrayMul_Ctx( const qFP16_Settings_t * const ctx,
+                             qFP16_t * const dst,
+                             const qFP16_t * const x,
+                             const qFP16_t * const y,
+                             const size_t n )
+{
+    qFP16_t *retValue = NULL;
+
+    if ( ( NULL != ctx ) && ( NULL != dst ) && ( NULL != x ) && ( NULL != y ) ) {
+        const qFP16_Settings_t s = *ctx; /*dst can not alias the local copy*/
+        size_t i;
+
+        for ( i = 0U ; i < n ; ++i ) {
+            dst[ i ] = qFP16_mul_ctx( &s, x[ i ], y[ i ] );
+        }
+        retValue = dst;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+qFP16_t* qFP16_ArrayMAC( qFP16_t * const dst,
+                         const qFP16_t * const x,
+                         const qFP16_t * const y,
+                         const size_t n )
+{
+    return qFP16_ArrayMAC_Ctx( fp, dst, x, y, n );
+}
+/*============================================================================*/
+qFP16_t* qFP16_ArrayMAC_Ctx( const qFP16_Settings_t * const ctx,
+                             qFP16_t * const dst,
+                             const qFP16_t * const x,
+                             const qFP16_t * const y,
+                             const size_t n )
+{
+    qFP16_t *retValue = NULL;
+
+    if ( ( NULL != ctx ) && ( NULL != dst ) && ( NULL != x ) && ( NULL != y ) ) {
+        const qFP16_Settings_t s = *ctx; /*dst can not alias the local copy*/
+        size_t i;
+
+        for ( i = 0U ; i < n ; ++i ) {
+            dst[ i ] = qFP16_add_ctx( &s, dst[ i ], qFP16_mul_ctx( &s, x[ i ], y[ i ] ) );
+        }
+        retValue = dst;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+qFP16_t* qFP16_ArrayScale( qFP16_t * const dst,
+                           const qFP16_t * const x,
+                           const qFP16_t k,
+                           const size_t n )
+{
+    return qFP16_ArrayScale_Ctx( fp, dst, x, k, n );
+}
+/*============================================================================*/
+qFP16_t* qFP16_ArrayScale_Ctx( const qFP16_Settings_t * const ctx,
+                               qFP16_t * const dst,
+                               const qFP16_t * const x,
+                               const qFP16_t k,
+                               const size_t n )
+{
+    qFP16_t *retValue = NULL;
+
+    if ( ( NULL != ctx ) && ( NULL != dst ) && ( NULL != x ) ) {
+        const qFP16_Settings_t s = *ctx; /*dst can not alias the local copy*/
+        size_t i;
+
+        for ( i = 0U ; i < n ; ++i ) {
+            dst[ i ] = qFP16_mul_ctx( &s, x[ i ], k );
+        }
+        retValue = dst;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+qFP16_t qFP16_ArrayDot( const qFP16_t * const x,
+                        const qFP16_t * const y,
+                        const size_t n )
+{
+    return qFP16_ArrayDot_Ctx( fp, x, y, n );
+}
+/*============================================================================*/
+qFP16_t qFP16_ArrayDot_Ctx( const qFP16_Settings_t * const ctx,
+                            const qFP16_t * const x,
+                            const qFP16_t * const y,
+                            const size_t n )
+{
+    qFP16_t retValue = 0;
+
+    if ( ( NULL != ctx ) && ( NULL != x ) && ( NULL != y ) ) {
+        const qFP16_Settings_t s = *ctx;
+        qFP16_t p[ 16 ];
+        size_t i, j, m;
+
+        /*the products of each block are computed in a vectorizable loop, the
+        saturated accumulation has to keep the order*/
+        for ( i = 0U ; i < n ; i += m ) {
+            m = ( ( n - i ) < 16U ) ? ( n - i ) : 16U;
+            for ( j = 0U ; j < m ; ++j ) {
+                p[ j ] = qFP16_mul_ctx( &s, x[ i + j ], y[ i + j ] );
+            }
+            for ( j = 0U ; j < m ; ++j ) {
+                retValue = qFP16_add_ctx( &s, retValue, p[ j ] );
+            }
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qFP16_CordicSinCos( const qFP16_t x,
+                        qFP16_t * const s,
+                        qFP16_t * const c )
+{
+    int retValue = 0;
+
+    if ( ( NULL != s ) || ( NULL != c ) ) {
+        int32_t z, cx = cordic_k[ QFP16_CORDIC_ITERATIONS - 1 ], cy = 0;
+        int64_t r;
+        bool negate = false;
+        int i;
+        /*reduce to [ -pi, pi ] with a 2*pi of 45 fractional bits, the Q16.16
+        one would leave an error of up to 0.5*k units after k turns*/
+        /*cppcheck-suppress misra-c2012-10.1 */
+        i = (int)( ( ( (int64_t)x*cordic_1_2pi_32 ) + ( (int64_t)1 << 47 ) ) >> 48 );
+        r = ( (int64_t)x*( (int64_t)1 << 29 ) ) - ( (int64_t)i*cordic_2pi_45 );
+        if ( r > cordic_pi_45 ) {
+            r -= cordic_2pi_45;
+        }
+        else if ( r < -cordic_pi_45 ) {
+            r += cordic_2pi_45;
+        }
+        else {
+            /*nothing to do*/
+        }
+        /*cppcheck-suppress misra-c2012-10.1 */
+        z = (int32_t)( ( r + ( (int64_t)1 << 15 ) ) >> 16 ); /*to Q2.29*/
+        if ( z > cordic_pi_2 ) {
+            z -= cordic_pi;
+            negate = true;
+        }
+        else if ( z < -cordic_pi_2 ) {
+            z += cordic_pi;
+            negate = true;
+        }
+        else {
+            /*nothing to do*/
+        }
+        /*rotation mode : drive the residual angle z to zero*/
+        for ( i = 0 ; i < QFP16_CORDIC_ITERATIONS ; ++i ) {
+            const int32_t tx = cx;
+
+            /*cppcheck-suppress misra-c2012-10.1 */
+            if ( z >= 0 ) {
+                cx -= cy >> i;
+                cy += tx >> i;
+                z -= cordic_atan[ i ];
+            }
+            else {
+                cx += cy >> i;
+                cy -= tx >> i;
+                z += cordic_atan[ i ];
+            }
+        }
+        if ( negate ) {
+            cx = -cx;
+            cy = -cy;
+        }
+        if ( NULL != s ) {
+            *s = qFP16_CordicOut( cy );
+        }
+        if ( NULL != c ) {
+            *c = qFP16_CordicOut( cx );
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+qFP16_t qFP16_CordicAtan2( const qFP16_t y,
+                           const qFP16_t x,
+                           qFP16_t * const mag )
+{
+    qFP16_t retValue = 0;
+    uint32_t ax, ay, m;
+    int64_t vx, vy;
+    int32_t z = 0;
+    int sh, i;
+
+    /*unsigned negation, also valid for qFP16.overflow*/
+    ax = ( x >= 0 ) ? (uint32_t)x : ( 0U - (uint32_t)x );
+    ay = ( y >= 0 ) ? (uint32_t)y : ( 0U - (uint32_t)y );
+    m = ( ax > ay ) ? ax : ay;
+    if ( 0U == m ) {
+        if ( NULL != mag ) {
+            *mag = 0;
+        }
+    }
+    else {
+        /*normalize the vector with its msb at bit 32, no bit is discarded and
+        the growth of the vector and the gain product still fit in 64 bits*/
+        sh = 32 - (int)qFP16_Msb( m );
+        vx = (int64_t)ax << sh;
+        vy = (int64_t)ay << sh;
+        if ( y < 0 ) {
+            vy = -vy;
+        }
+        /*vectoring mode : drive the y coordinate to zero*/
+        for ( i = 0 ; i < QFP16_CORDIC_ITERATIONS ; ++i ) {
+            const int64_t tx = vx;
+
+            /*cppcheck-suppress misra-c2012-10.1 */
+            if ( vy >= 0 ) {
+                vx += vy >> i;
+                vy -= tx >> i;
+                z += cordic_atan[ i ];
+            }
+            else {
+                vx -= vy >> i;
+                vy += tx >> i;
+                z -= cordic_atan[ i ];
+            }
+        }
+        if ( x < 0 ) {
+            z = ( ( y >= 0 ) ? cordic_pi : -cordic_pi ) - z;
+        }
+        retValue = qFP16_CordicOut( z );
+        if ( NULL != mag ) {
+            /*the exact squared magnitude fixes the last units left by the
+            precision of the gain, so the result is correctly rounded*/
+            const uint64_t s2 = ( (uint64_t)ax*ax ) + ( (uint64_t)ay*ay );
+            const int n = 29 + sh;
+            uint64_t r = (uint64_t)( ( ( vx*cordic_k[ QFP16_CORDIC_ITERATIONS - 1 ] ) + ( (int64_t)1 << ( n - 1 ) ) ) >> n );
+            uint64_t r2 = r*r;
+
+            /*r is at most a few units away, so the square is updated with
+            ( r +/- 1 )^2 = r^2 +/- 2r + 1 instead of being recomputed*/
+            for ( i = 0 ; ( i < 8 ) && ( ( r2 + r ) < s2 ) ; ++i ) {
+                r2 += ( 2U*r ) + 1U;
+                ++r;
+            }
+            for ( i = 0 ; ( i < 8 ) && ( r > 0U ) && ( ( r2 - r ) >= s2 ) ; ++i ) {
+                r2 -= ( 2U*r ) - 1U;
+                --r;
+            }
+            *mag = ( r > (uint64_t)qFP16.max ) ? qFP16.overflow : (qFP16_t)r;
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+qFP16_t qFP16_CordicSqrt( const qFP16_t x )
+{
+    qFP16_t retValue = qFP16.overflow;
+
+    if ( 0 == x ) {
+        retValue = 0;
+    }
+    else if ( x > 0 ) {
+        const int p = (int)qFP16_Msb( (uint32_t)x );
+        int32_t a, b, v;
+        int k2, i, n;
+        /*x = v*4^k with v in [ 0.5, 2 ), so sqrt(x) = sqrt(v)*2^k*/
+        k2 = ( 0 == ( ( p - 15 ) & 1 ) ) ? ( p - 15 ) : ( p - 16 );
+        if ( ( 13 - k2 ) >= 0 ) {
+            v = (int32_t)( (uint32_t)x << ( 13 - k2 ) );
+        }
+        else {
+            /*cppcheck-suppress misra-c2012-10.1 */
+            v = x >> ( k2 - 13 );
+        }
+        /*hyperbolic vectoring : sqrt(v) = sqrt( (v + 1/4)^2 - (v - 1/4)^2 )*/
+        a = v + cordic_1_4;
+        b = v - cordic_1_4;
+        for ( i = 1 ; i <= QFP16_CORDIC_ITERATIONS ; ++i ) {
+            /*steps 4 and 13 are repeated to guarantee the convergence*/
+            for ( n = ( ( 4 == i ) || ( 13 == i ) ) ? 2 : 1 ; n > 0 ; --n ) {
+                const int32_t ta = a;
+
+                /*cppcheck-suppress misra-c2012-10.1 */
+                if ( b < 0 ) {
+                    a += b >> i;
+                    b += ta >> i;
+                }
+                else {
+                    a -= b >> i;
+                    b -= ta >> i;
+                }
+            }
+        }
+        a = qFP16_CordicGain( a, cordic_kh[ QFP16_CORDIC_ITERATIONS - 1 ] );
+        n = 13 - ( k2/2 );
+        /*cppcheck-suppress misra-c2012-10.1 */
+        retValue = ( a + ( 1 << ( n - 1 ) ) ) >> n;
+    }
+    else {
+        /*nothing to do*/
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+char* qFP16_FPToA( const qFP16_t num,
+                   char *str,
+                   int decimals )
+{
+    return qFP16_FPToA_Ctx( fp, num, str, decimals );
+}
+/*============================================================================*/
+char* qFP16_FPToA_Ctx( const qFP16_Settings_t * const ctx,
+                       const qFP16_t num,
+                       char *str,
+                       int decimals )
+{
+    char *retValue = str;
+
+    if ( qFP16.overflow == num ) {
+        str[ 0 ] = 'o';
+        str[ 1 ] = 'v';
+        str[ 2 ] = 'e';
+        str[ 3 ] = 'r';
+        str[ 4 ] = 'f';
+        str[ 5 ] = 'l';
+        str[ 6 ] = 'o';
+        str[ 7 ] = 'w';
+        str[ 8 ] = '\0';
+    }
+    else {
+        const uint32_t iScales[ 6 ] = { 1U, 10U, 100U, 1000U, 10000U, 100000U };
         uint32_t uValue, fPart, scale;
         int32_t iPart;
 
@@ -839,7 +1463,7 @@ char* qFP16_FPToA( const qFP16_t num,
             decimals = 0;
         }
         scale = iScales[ decimals ];
-        fPart = (uint32_t)qFP16_Mul( (qFP16_t)fPart, (qFP16_t)scale );
+        fPart = (uint32_t)qFP16_Mul_Ctx( ctx, (qFP16_t)fPart, (qFP16_t)scale );
 
         if ( fPart >= scale ) {
             iPart++;
@@ -858,6 +1482,12 @@ char* qFP16_FPToA( const qFP16_t num,
 }
 /*============================================================================*/
 qFP16_t qFP16_AToFP( const char *s )
+{
+    return qFP16_AToFP_Ctx( fp, s );
+}
+/*============================================================================*/
+qFP16_t qFP16_AToFP_Ctx( const qFP16_Settings_t * const ctx,
+                         const char *s )
 {
     uint8_t neg;
     uint32_t iPart = 0U, fPart = 0U, scale = 1U, digit;
@@ -907,18 +1537,187 @@ qFP16_t qFP16_AToFP( const char *s )
     if ( false == overflow ) {
         /*cppcheck-suppress misra-c2012-10.1 */
         retValue = (qFP16_t)iPart << 16;
-        retValue += qFP16_Div( (qFP16_t)fPart, (qFP16_t)scale );
+        retValue += qFP16_Div_Ctx( ctx, (qFP16_t)fPart, (qFP16_t)scale );
         retValue = ( 1U == neg ) ? -retValue : retValue;
     }
     /*cstat +MISRAC2012-Dir-4.11_h*/
     return retValue;
 }
 /*============================================================================*/
-static qFP16_t qFP16_rs( const qFP16_t x )
+size_t qFP16_ArrayToA( const qFP16_t * const x,
+                       const size_t n,
+                       char * const str,
+                       const size_t size,
+                       int decimals,
+                       const char delim )
+{
+    return qFP16_ArrayToA_Ctx( fp, x, n, str, size, decimals, delim );
+}
+/*============================================================================*/
+size_t qFP16_ArrayToA_Ctx( const qFP16_Settings_t * const ctx,
+                           const qFP16_t * const x,
+                           const size_t n,
+                           char * const str,
+                           const size_t size,
+                           int decimals,
+                           const char delim )
+{
+    size_t retValue = 0U;
+
+    if ( ( NULL != ctx ) && ( NULL != x ) && ( NULL != str ) && ( size > 0U ) ) {
+        const uint8_t rounding = ctx->rounding;
+        size_t i, len;
+
+        if ( decimals > 5 ) {
+            decimals = 5;
+        }
+        if ( decimals < 0 ) {
+            decimals = 0;
+        }
+        for ( i = 0U ; i < n ; ++i ) {
+            const size_t room = size - retValue; /*including the null char*/
+            char *dst = &str[ retValue ];
+
+            if ( room > 13U ) { /*the worst case fits, write in place*/
+                len = 0U;
+                if ( i > 0U ) {
+                    dst[ len++ ] = delim;
+                }
+                len += qFP16_FmtValue( &dst[ len ], x[ i ], (uint32_t)decimals, rounding );
+            }
+            else {
+                char tmp[ 14 ];
+                size_t j;
+
+                len = 0U;
+                if ( i > 0U ) {
+                    tmp[ len++ ] = delim;
+                }
+                len += qFP16_FmtValue( &tmp[ len ], x[ i ], (uint32_t)decimals, rounding );
+                if ( len >= room ) {
+                    break;
+                }
+                for ( j = 0U ; j < len ; ++j ) {
+                    dst[ j ] = tmp[ j ];
+                }
+            }
+            retValue += len;
+        }
+        str[ retValue ] = '\0';
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+size_t qFP16_AToArray( const char *s,
+                       qFP16_t * const x,
+                       const size_t n,
+                       const char delim,
+                       const char ** const end )
+{
+    return qFP16_AToArray_Ctx( fp, s, x, n, delim, end );
+}
+/*============================================================================*/
+size_t qFP16_AToArray_Ctx( const qFP16_Settings_t * const ctx,
+                           const char *s,
+                           qFP16_t * const x,
+                           const size_t n,
+                           const char delim,
+                           const char ** const end )
+{
+    size_t retValue = 0U;
+
+    if ( ( NULL != ctx ) && ( NULL != s ) && ( NULL != x ) ) {
+        const uint8_t rounding = ctx->rounding;
+        const qFP16_t min = ctx->min;
+        const char *p;
+
+        while ( retValue < n ) {
+            uint32_t iPart = 0U, fPart = 0U, scale = 1U, count = 0U, nf = 0U;
+            uint32_t uValue;
+            bool neg, overflow = false, digits = false;
+
+            p = qFP16_SkipSpaces( s, delim );
+            if ( qFP16_IsOverflowText( p ) ) {
+                /*the text written by qFP16_FPToA() for qFP16.overflow*/
+                x[ retValue ] = qFP16.overflow;
+                p = &p[ 8 ];
+            }
+            else {
+                neg = ( '-' == *p );
+                if ( ( '+' == *p ) || ( '-' == *p ) ) {
+                    ++p;
+                }
+                /*cstat -MISRAC2012-Rule-10.4_a*/
+                for ( ; ( *p >= '0' ) && ( *p <= '9' ) ; ++p ) {
+                    if ( false == overflow ) {
+                        iPart = ( 10U*iPart ) + ( (uint32_t)*p - (uint32_t)'0' );
+                        ++count;
+                        overflow = ( ( count > 5U ) || ( iPart > 32768U ) ||
+                                     ( ( false == neg ) && ( iPart > 32767U ) ) );
+                    }
+                    digits = true;
+                }
+                if ( '.' == *p ) {
+                    for ( ++p ; ( *p >= '0' ) && ( *p <= '9' ) ; ++p ) {
+                        if ( scale < 1000000000U ) {
+                            fPart = ( 10U*fPart ) + ( (uint32_t)*p - (uint32_t)'0' );
+                            scale *= 10U;
+                            ++nf;
+                        }
+                        digits = true;
+                    }
+                }
+                /*cstat +MISRAC2012-Rule-10.4_a*/
+                if ( false == digits ) {
+                    break; /*not a number, s stays at the start of the field*/
+                }
+                if ( overflow ) {
+                    x[ retValue ] = qFP16.overflow;
+                }
+                else {
+                    uValue = iPart << 16;
+                    if ( ( 0U != fPart ) && ( nf <= 6U ) ) {
+                        /*fPart*2^16/10^nf = fPart*2^(16-nf)/5^nf, a single
+                        32-bit division with the same rounding of qFP16_div()*/
+                        const uint32_t d = fp_pow5[ nf ];
+                        uint32_t num = fPart << ( 16U - nf );
+
+                        if ( 1U == rounding ) {
+                            num += d >> 1U;
+                        }
+                        uValue += num/d;
+                    }
+                    else if ( 0U != fPart ) {
+                        uValue += (uint32_t)qFP16_div( (qFP16_t)fPart, (qFP16_t)scale, rounding, min );
+                    }
+                    else {
+                        /*nothing to do*/
+                    }
+                    x[ retValue ] = ( neg ) ? (qFP16_t)( 0U - uValue ) : (qFP16_t)uValue;
+                }
+            }
+            ++retValue;
+            s = qFP16_SkipSpaces( p, delim );
+            if ( delim != *s ) {
+                break;
+            }
+            ++s;
+        }
+        if ( NULL != end ) {
+            *end = s;
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static qFP16_t qFP16_rs( const qFP16_Settings_t * const ctx,
+                         const qFP16_t x )
 {
     qFP16_t retValue;
 
-    if ( 1U == fp->rounding ) {
+    if ( 1U == ctx->rounding ) {
         /*cppcheck-suppress misra-c2012-10.1 */
         retValue = ( x >> 1U ) + ( x & 1 );
     }
@@ -930,13 +1729,14 @@ static qFP16_t qFP16_rs( const qFP16_t x )
     return retValue;
 }
 /*============================================================================*/
-static qFP16_t qFP16_log2i( qFP16_t x )
+static qFP16_t qFP16_log2i( const qFP16_Settings_t * const ctx,
+                            qFP16_t x )
 {
     qFP16_t retValue = 0;
 
     while ( x >= intern.f_2 ) {
         ++retValue;
-        x = qFP16_rs( x );
+        x = qFP16_rs( ctx, x );
     }
 
     if ( 0 == x ) {
@@ -946,15 +1746,15 @@ static qFP16_t qFP16_log2i( qFP16_t x )
     else {
         int i;
         for ( i = 16 ; i > 0 ; --i ) {
-            x = qFP16_Mul( x, x );
+            x = qFP16_Mul_Ctx( ctx, x, x );
             retValue <<= 1;
             if ( x >= intern.f_2 ) {
                 retValue |= 1;
-                x = qFP16_rs( x );
+                x = qFP16_rs( ctx, x );
             }
         }
-        if ( 1U == fp->rounding ) {
-            x = qFP16_Mul( x, x );
+        if ( 1U == ctx->rounding ) {
+            x = qFP16_Mul_Ctx( ctx, x, x );
             if ( x >= intern.f_2 ) {
                 ++retValue;
             }
@@ -984,19 +1784,290 @@ static char *qFP16_itoa( char *buf,
     return buf;
 }
 /*============================================================================*/
-static qFP16_t qFP16_Saturate( const qFP16_t nsInput,
-                               const qFP16_t x,
-                               const qFP16_t y )
+static inline qFP16_t qFP16_add( const qFP16_t X,
+                                 const qFP16_t Y )
+{
+    uint32_t x = (uint32_t)X, y = (uint32_t)Y;
+    uint32_t retValue;
+
+    retValue =  x + y;
+    if ( ( 0U == ( ( x ^ y ) & intern.overflow_mask ) ) && ( 0U != ( ( x ^ retValue ) & intern.overflow_mask ) ) ) {
+        retValue = (uint32_t)qFP16.overflow;
+    }
+
+    return (qFP16_t)retValue;
+}
+/*============================================================================*/
+static inline qFP16_t qFP16_sub( const qFP16_t X,
+                                 const qFP16_t Y )
+{
+    uint32_t x = (uint32_t)X, y = (uint32_t)Y;
+    uint32_t retValue;
+
+    retValue =  x - y;
+    if ( ( 0U != ( ( x ^ y ) & intern.overflow_mask ) ) && ( 0U != ( ( x ^ retValue ) & intern.overflow_mask ) ) ) {
+        retValue = (uint32_t)qFP16.overflow;
+    }
+
+    return (qFP16_t)retValue;
+}
+/*============================================================================*/
+static inline qFP16_t qFP16_mul( const qFP16_t x,
+                                 const qFP16_t y,
+                                 const uint8_t rounding )
+{
+    int32_t a, c, ac, adcb, mulH;
+    uint32_t b, d, bd, tmp, mulL;
+    /*branch-free, so the array operations can be vectorized*/
+    /*cstat -MISRAC2012-Rule-10.3*/
+    /*cppcheck-suppress misra-c2012-10.1 */
+    a = ( x >> 16 );
+    /*cppcheck-suppress misra-c2012-10.1 */
+    c = ( y >> 16 );
+    b = ( x & 0xFFFF );
+    d = ( y & 0xFFFF );
+    /*cstat +MISRAC2012-Rule-10.3*/
+    ac = a*c;
+    /*cppcheck-suppress misra-c2012-10.8 */
+    adcb = (int32_t)( ( (uint32_t)a*d ) + ( (uint32_t)c*b ) );
+    bd = b*d;
+    /*cppcheck-suppress misra-c2012-10.1 */
+    mulH = ac + ( adcb >> 16 );
+    tmp = (uint32_t)adcb << 16;
+    mulL = bd + tmp;
+    mulH += ( mulL < bd ) ? 1 : 0;
+    /*cppcheck-suppress misra-c2012-10.6 */
+    a = ( mulH < 0 ) ? -1 : 0;
+    /*cppcheck-suppress misra-c2012-10.1 */
+    c = ( a == ( mulH >> 15 ) ) ? 1 : 0;
+    /*rounding : subtract one half ( and one more if negative ) with borrow,
+    then add one*/
+    tmp = mulL;
+    mulL -= (uint32_t)rounding*( (uint32_t)qFP16.one_half + ( (uint32_t)mulH >> 31 ) );
+    mulH -= ( mulL > tmp ) ? 1 : 0;
+    /*cppcheck-suppress misra-c2012-10.1 */
+    ac = ( (qFP16_t)( (uint32_t)mulH << 16 ) | (qFP16_t)( mulL >> 16 ) ) + (qFP16_t)rounding;
+
+    /*selected with masks, a conditional here is threaded by the compiler
+    into the saturation and breaks the vectorization of the callers*/
+    /*cppcheck-suppress misra-c2012-10.1 */
+    return ( ac & -c ) | ( qFP16.overflow & ( c - 1 ) );
+}
+/*============================================================================*/
+static inline qFP16_t qFP16_add_ctx( const qFP16_Settings_t * const ctx,
+                                     const qFP16_t X,
+                                     const qFP16_t Y )
+{
+    const qFP16_t retValue = qFP16_add( X, Y );
+
+    /*an overflowed result always takes the sign of X. Selected without a
+    branch, so the array operations can be vectorized*/
+    return ( 1U == ctx->saturate ) ? qFP16_Saturate( retValue, X, qFP16.one, ctx->min, ctx->max )
+                                   : retValue;
+}
+/*============================================================================*/
+static inline qFP16_t qFP16_mul_ctx( const qFP16_Settings_t * const ctx,
+                                     const qFP16_t x,
+                                     const qFP16_t y )
 {
-    qFP16_t retValue = nsInput;
+    const qFP16_t retValue = qFP16_mul( x, y, ctx->rounding );
+
+    return ( 1U == ctx->saturate ) ? qFP16_Saturate( retValue, x, y, ctx->min, ctx->max )
+                                   : retValue;
+}
+/*============================================================================*/
+static qFP16_t qFP16_div( const qFP16_t x,
+                          const qFP16_t y,
+                          const uint8_t rounding,
+                          const qFP16_t min )
+{
+    qFP16_t retValue = min;
+
+    if ( 0 != y ) {
+        uint32_t xRem, xDiv, bit = 0x10000U;
+
+        xRem = (uint32_t)( ( x >= 0 ) ? x : -x );
+        xDiv = (uint32_t)( ( y >= 0 ) ? y : -y );
+
+        while ( xDiv < xRem ) {
+            xDiv <<= 1;
+            bit <<= 1;
+        }
+        retValue = qFP16.overflow;
+        /*cstat -MISRAC2012-Rule-14.3_a*/
+        if ( 0U != bit ) { /*MISRAC2012-Rule-14.3_a false positive*/
+        /*cstat +MISRAC2012-Rule-14.3_a*/
+            uint32_t quotient = 0U;
+
+            if ( 0U != ( xDiv & 0x80000000U ) ) {
+                if ( xRem >= xDiv ) {
+                    quotient |= bit;
+                    xRem -= xDiv;
+                }
+                xDiv >>= 1;
+                bit >>= 1;
+            }
+
+            while ( ( 0U != bit ) && ( 0U != xRem ) ) {
+                if ( xRem >= xDiv ) {
+                    quotient |= bit;
+                    xRem -= xDiv;
+                }
+                xRem <<= 1;
+                bit >>= 1;
+            }
+            if ( 1U == rounding ) {
+                if ( xRem >= xDiv ) {
+                    ++quotient;
+                }
+            }
 
-    if ( 1U == fp->saturate ) {
-        if ( qFP16.overflow == nsInput ) {
-            retValue = ( ( x >= 0 ) == ( y >= 0 ) ) ? fp->max : fp->min;
+            retValue = (qFP16_t)quotient;
+            /*cppcheck-suppress misra-c2012-10.8 */
+            if ( 0U != ( (uint32_t)( x ^ y ) & intern.overflow_mask ) ) {
+                if ( quotient == (uint32_t)min ) {
+                    retValue = qFP16.overflow;
+                }
+                else {
+                    retValue = -retValue;
+                }
+            }
         }
     }
 
     return retValue;
 }
 /*============================================================================*/
+static inline qFP16_t qFP16_Saturate( const qFP16_t nsInput,
+                                      const qFP16_t x,
+                                      const qFP16_t y,
+                                      const qFP16_t min,
+                                      const qFP16_t max )
+{
+    const qFP16_t sat = ( ( x ^ y ) >= 0 ) ? max : min;
+    /*cppcheck-suppress misra-c2012-10.5 */
+    const qFP16_t m = -(qFP16_t)( qFP16.overflow == nsInput );
+
+    /*cppcheck-suppress misra-c2012-10.1 */
+    return ( sat & m ) | ( nsInput & ~m );
+}
+/*============================================================================*/
+static int32_t qFP16_CordicGain( const int32_t x,
+                                 const int32_t k )
+{
+    /*cppcheck-suppress misra-c2012-10.1 */
+    return (int32_t)( ( ( (int64_t)x*k ) + ( (int64_t)1 << 28 ) ) >> 29 );
+}
+/*============================================================================*/
+static qFP16_t qFP16_CordicOut( const int32_t x )
+{
+    /*cppcheck-suppress misra-c2012-10.1 */
+    return ( x + 4096 ) >> 13;
+}
+/*============================================================================*/
+static uint8_t qFP16_Msb( uint32_t x )
+{
+    uint8_t retValue = 0U;
+
+    while ( x > 1U ) {
+        x >>= 1U;
+        ++retValue;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
 /*cstat +MISRAC2012-Rule-10.8 +CERT-FLP34-C +MISRAC2012-Rule-1.3_n +MISRAC2012-Rule-10.1_R6 +ATH-shift-neg +CERT-INT34-C_c*/
+/*============================================================================*/
+static char *qFP16_PutDigits( char *buf,
+                              uint32_t value,
+                              const uint32_t width )
+{
+    uint32_t i = width;
+
+    /*fill from the right, two digits at a time*/
+    while ( i >= 2U ) {
+        const uint32_t k = ( value % 100U ) << 1U;
+
+        value /= 100U;
+        i -= 2U;
+        buf[ i ] = fp_digits[ k ];
+        buf[ i + 1U ] = fp_digits[ k + 1U ];
+    }
+    if ( 0U != i ) {
+        buf[ 0 ] = fp_digits[ ( ( value % 10U ) << 1U ) + 1U ];
+    }
+
+    return &buf[ width ];
+}
+/*============================================================================*/
+static size_t qFP16_FmtValue( char *buf,
+                              const qFP16_t num,
+                              const uint32_t decimals,
+                              const uint8_t rounding )
+{
+    char *p = buf;
+
+    if ( qFP16.overflow == num ) {
+        static const char ovf[ 8 ] = { 'o', 'v', 'e', 'r', 'f', 'l', 'o', 'w' };
+        uint32_t i;
+
+        for ( i = 0U ; i < 8U ; ++i ) {
+            *p++ = ovf[ i ];
+        }
+    }
+    else {
+        const uint32_t scale = fp_pow5[ decimals ] << decimals;
+        const uint32_t shift = 16U - decimals;
+        uint32_t uValue, iPart, fPart, width;
+
+        uValue = (uint32_t)( ( num >= 0 ) ? num : -num );
+        if ( num < 0 ) {
+            *p++ = '-';
+        }
+        iPart = uValue >> 16;
+        /*fraction*10^d/2^16 = fraction*5^d/2^(16-d), which fits in 32 bits*/
+        fPart = ( uValue & intern.fraction_mask )*fp_pow5[ decimals ];
+        if ( 1U == rounding ) {
+            fPart += 1U << ( shift - 1U );
+        }
+        fPart >>= shift;
+        if ( fPart >= scale ) {
+            iPart++;
+            fPart -= scale;
+        }
+        width = ( iPart < 10U ) ? 1U : ( iPart < 100U ) ? 2U :
+                ( iPart < 1000U ) ? 3U : ( iPart < 10000U ) ? 4U : 5U;
+        p = qFP16_PutDigits( p, iPart, width );
+        if ( 0U != decimals ) {
+            *p++ = '.';
+            p = qFP16_PutDigits( p, fPart, decimals );
+        }
+    }
+
+    return (size_t)( p - buf );
+}
+/*============================================================================*/
+static const char *qFP16_SkipSpaces( const char *s,
+                                     const char delim )
+{
+    /*cstat -MISRAC2012-Dir-4.11_h*/
+    while ( ( delim != *s ) && ( 0 != isspace( (int)*s ) ) ) {
+        ++s;
+    }
+    /*cstat +MISRAC2012-Dir-4.11_h*/
+
+    return s;
+}
+/*============================================================================*/
+static bool qFP16_IsOverflowText( const char *s )
+{
+    static const char text[ 9 ] = "overflow";
+    size_t i = 0U;
+
+    while ( ( i < 8U ) && ( text[ i ] == s[ i ] ) ) {
+        ++i;
+    }
+
+    return ( 8U == i );
+}
@@ -0,0 +1,415 @@
+/*!
+ * @file qfpq.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ **/
+
+#include "qfpq.h"
+
+/*! @cond  */
+#define QFPQ_ONE        ( (int64_t)1073741824 )     /* [ 1 ] in Q2.30 */
+#define QFPQ_LN2        ( (int64_t)744261118 )      /* [ ln(2) ] in Q2.30 */
+#define QFPQ_PI         ( (int64_t)3373259426 )     /* [ pi ] in Q2.30 */
+#define QFPQ_PI_2       ( (int64_t)1686629713 )     /* [ pi/2 ] in Q2.30 */
+#define QFPQ_PI_4       ( (int64_t)843314857 )      /* [ pi/4 ] in Q2.30 */
+#define QFPQ_PI_2_Q50   ( (int64_t)1768559438007110 )/* [ pi/2 ] in Q.50 */
+#define QFPQ_LN2_Q50    ( (int64_t)780414346020670 ) /* [ ln(2) ] in Q.50 */
+#define QFPQ_TAN_PI_8   ( (int64_t)444760904 )      /* [ tan(pi/8) ] in Q2.30 */
+/*! @endcond  */
+
+static int64_t qFPQ_Sat( const int64_t v,
+                         const int64_t min,
+                         const int64_t max );
+static int64_t qFPQ_Shr( const int64_t v,
+                         const uint8_t s );
+static int64_t qFPQ_Scale( const int64_t v,
+                           const uint8_t from,
+                           const uint8_t to );
+static int64_t qFPQ_Mul30( const int64_t a,
+                           const int64_t b );
+static int64_t qFPQ_FromDouble( double v,
+                                const double scale,
+                                const int64_t min,
+                                const int64_t max );
+static int64_t qFPQ_Sqrt( const int64_t x,
+                          const uint8_t f );
+static int64_t qFPQ_Exp( const int64_t x,
+                         const uint8_t f );
+static int64_t qFPQ_Log( const int64_t x,
+                         const uint8_t f );
+static int64_t qFPQ_Sin30( const int64_t x,
+                           const uint8_t quadrant );
+static int64_t qFPQ_Atan2_30( const int64_t y,
+                              const int64_t x );
+
+/*cstat -MISRAC2012-Rule-10.8 -MISRAC2012-Rule-1.3_n -MISRAC2012-Rule-10.1_R6 -ATH-shift-neg -CERT-INT34-C_c -MISRAC2012-Rule-20.10 -MISRAC2012-Dir-4.9*/
+
+/*! @cond  */
+/*Generates the API of a format Q with F fractional bits, using W as the
+wide type of the multiply and divide kernels*/
+#define QFPQ_IMPLEMENT( Q, W, F, MIN, MAX )                                 \
+Q##_t Q##_FloatToQ( const float x )                                         \
+{                                                                           \
+    return Q##_DoubleToQ( (double)x );                                      \
+}                                                                           \
+float Q##_QToFloat( const Q##_t x )                                         \
+{                                                                           \
+    return (float)Q##_QToDouble( x );                                       \
+}                                                                           \
+Q##_t Q##_DoubleToQ( const double x )                                       \
+{                                                                           \
+    return (Q##_t)qFPQ_FromDouble( x, (double)( (int64_t)1 << (F) ),        \
+                                   (MIN), (MAX) );                          \
+}                                                                           \
+double Q##_QToDouble( const Q##_t x )                                       \
+{                                                                           \
+    return (double)x / (double)( (int64_t)1 << (F) );                       \
+}                                                                           \
+Q##_t Q##_FP16ToQ( const qFP16_t x )                                        \
+{                                                                           \
+    return (Q##_t)qFPQ_Sat( qFPQ_Scale( x, 16U, (F) ), (MIN), (MAX) );     \
+}                                                                           \
+qFP16_t Q##_QToFP16( const Q##_t x )                                        \
+{                                                                           \
+    return (qFP16_t)qFPQ_Sat( qFPQ_Scale( x, (F), 16U ),                    \
+                              -qFP16.max, qFP16.max );                      \
+}                                                                           \
+Q##_t Q##_Abs( const Q##_t x )                                              \
+{                                                                           \
+    return (Q##_t)qFPQ_Sat( ( x < 0 ) ? -(W)x : (W)x, (MIN), (MAX) );       \
+}                                                                           \
+Q##_t Q##_Add( const Q##_t x,                                               \
+               const Q##_t y )                                              \
+{                                                                           \
+    return (Q##_t)qFPQ_Sat( (W)x + (W)y, (MIN), (MAX) );                    \
+}                                                                           \
+Q##_t Q##_Sub( const Q##_t x,                                               \
+               const Q##_t y )                                              \
+{                                                                           \
+    return (Q##_t)qFPQ_Sat( (W)x - (W)y, (MIN), (MAX) );                    \
+}                                                                           \
+Q##_t Q##_Mul( const Q##_t x,                                               \
+               const Q##_t y )                                              \
+{                                                                           \
+    W p = (W)x*(W)y;                                                        \
+                                                                            \
+    p = ( p + ( (W)1 << ( (F) - 1 ) ) ) >> (F);                             \
+    return (Q##_t)qFPQ_Sat( p, (MIN), (MAX) );                              \
+}                                                                           \
+Q##_t Q##_Div( const Q##_t x,                                               \
+               const Q##_t y )                                              \
+{                                                                           \
+    Q##_t retValue;                                                         \
+                                                                            \
+    if ( 0 == y ) {                                                         \
+        retValue = ( x >= 0 ) ? (MAX) : (MIN);                              \
+    }                                                                       \
+    else {                                                                  \
+        const W n = (W)x*( (W)1 << (F) );                                   \
+        W q = n/(W)y, r = n%(W)y;                                           \
+                                                                            \
+        r = ( r < 0 ) ? -r : r;                                             \
+        if ( ( r + r ) >= ( ( y < 0 ) ? -(W)y : (W)y ) ) {                  \
+            q += ( ( n < 0 ) == ( y < 0 ) ) ? 1 : -1;                       \
+        }                                                                   \
+        retValue = (Q##_t)qFPQ_Sat( q, (MIN), (MAX) );                      \
+    }                                                                       \
+                                                                            \
+    return retValue;                                                        \
+}                                                                           \
+Q##_t Q##_Sqrt( const Q##_t x )                                             \
+{                                                                           \
+    return (Q##_t)qFPQ_Sat( qFPQ_Sqrt( x, (F) ), (MIN), (MAX) );            \
+}                                                                           \
+Q##_t Q##_Exp( const Q##_t x )                                              \
+{                                                                           \
+    return (Q##_t)qFPQ_Sat( qFPQ_Exp( x, (F) ), (MIN), (MAX) );             \
+}                                                                           \
+Q##_t Q##_Log( const Q##_t x )                                              \
+{                                                                           \
+    Q##_t retValue = (MIN);                                                 \
+                                                                            \
+    if ( x > 0 ) {                                                          \
+        retValue = (Q##_t)qFPQ_Sat( qFPQ_Log( x, (F) ), (MIN), (MAX) );     \
+    }                                                                       \
+                                                                            \
+    return retValue;                                                        \
+}                                                                           \
+Q##_t Q##_Sin( const Q##_t x )                                              \
+{                                                                           \
+    const int64_t s = qFPQ_Sin30( qFPQ_Scale( x, (F), 30U ), 0U );          \
+                                                                            \
+    return (Q##_t)qFPQ_Sat( qFPQ_Scale( s, 30U, (F) ), (MIN), (MAX) );      \
+}                                                                           \
+Q##_t Q##_Cos( const Q##_t x )                                              \
+{                                                                           \
+    const int64_t c = qFPQ_Sin30( qFPQ_Scale( x, (F), 30U ), 1U );          \
+                                                                            \
+    return (Q##_t)qFPQ_Sat( qFPQ_Scale( c, 30U, (F) ), (MIN), (MAX) );      \
+}                                                                           \
+Q##_t Q##_Atan2( const Q##_t y,                                             \
+                 const Q##_t x )                                            \
+{                                                                           \
+    const int64_t a = qFPQ_Atan2_30( y, x );                                \
+                                                                            \
+    return (Q##_t)qFPQ_Sat( qFPQ_Scale( a, 30U, (F) ), (MIN), (MAX) );      \
+}                                                                           \
+
+QFPQ_IMPLEMENT( qQ15, int32_t, 15, INT16_MIN, INT16_MAX )
+QFPQ_IMPLEMENT( qQ31, int64_t, 31, INT32_MIN, INT32_MAX )
+QFPQ_IMPLEMENT( qQ8_24, int64_t, 24, INT32_MIN, INT32_MAX )
+/*! @endcond  */
+
+/*============================================================================*/
+static int64_t qFPQ_Sat( const int64_t v,
+                         const int64_t min,
+                         const int64_t max )
+{
+    int64_t retValue = v;
+
+    if ( v > max ) {
+        retValue = max;
+    }
+    else if ( v < min ) {
+        retValue = min;
+    }
+    else {
+        /*nothing to do*/
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int64_t qFPQ_Shr( const int64_t v,
+                         const uint8_t s )
+{
+    int64_t retValue = v;
+
+    if ( s > 62U ) {
+        retValue = 0;
+    }
+    else if ( s > 0U ) {
+        /*cppcheck-suppress misra-c2012-10.1 */
+        retValue = ( v + ( (int64_t)1 << ( s - 1U ) ) ) >> s;
+    }
+    else {
+        /*nothing to do*/
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int64_t qFPQ_Scale( const int64_t v,
+                           const uint8_t from,
+                           const uint8_t to )
+{
+    int64_t retValue;
+
+    if ( to >= from ) {
+        retValue = v*( (int64_t)1 << ( to - from ) );
+    }
+    else {
+        retValue = qFPQ_Shr( v, from - to );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int64_t qFPQ_Mul30( const int64_t a,
+                           const int64_t b )
+{
+    return qFPQ_Shr( a*b, 30U );
+}
+/*============================================================================*/
+static int64_t qFPQ_FromDouble( double v,
+                                const double scale,
+                                const int64_t min,
+                                const int64_t max )
+{
+    int64_t retValue;
+
+    v *= scale;
+    v += ( v >= 0.0 ) ? 0.5 : -0.5;
+    if ( v >= (double)max ) {
+        retValue = max;
+    }
+    else if ( v <= (double)min ) {
+        retValue = min;
+    }
+    else {
+        retValue = (int64_t)v;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int64_t qFPQ_Sqrt( const int64_t x,
+                          const uint8_t f )
+{
+    uint64_t root = 0U;
+
+    if ( x > 0 ) {
+        uint64_t v = (uint64_t)x << f;
+        uint64_t rem = v, bit = (uint64_t)1U << 62U;
+
+        while ( bit > rem ) {
+            bit >>= 2U;
+        }
+        while ( 0U != bit ) {
+            if ( rem >= ( root + bit ) ) {
+                rem -= root + bit;
+                root = ( root >> 1U ) + bit;
+            }
+            else {
+                root >>= 1U;
+            }
+            bit >>= 2U;
+        }
+        if ( rem > root ) {
+            ++root;
+        }
+    }
+
+    return (int64_t)root;
+}
+/*============================================================================*/
+static int64_t qFPQ_Exp( const int64_t x,
+                         const uint8_t f )
+{
+    const int64_t x50 = qFPQ_Scale( x, f, 50U );
+    int64_t k, r, rl, t, p, retValue;
+    int n;
+    /*x = k*ln(2) + r, so exp(x) = 2^k*exp(r) with |r| <= ln(2)/2*/
+    if ( x50 >= 0 ) {
+        k = ( x50 + ( QFPQ_LN2_Q50/2 ) )/QFPQ_LN2_Q50;
+    }
+    else {
+        k = -( ( ( QFPQ_LN2_Q50/2 ) - x50 )/QFPQ_LN2_Q50 );
+    }
+    rl = x50 - ( k*QFPQ_LN2_Q50 );
+    r = qFPQ_Shr( rl, 20U );
+    rl -= r*( (int64_t)1 << 20 );
+    /*exp(r) = 1 + r*t, with t = ( exp(r) - 1 )/r evaluated in Q2.30 and the
+    last product kept in Q60, so the result is rounded only once*/
+    t = QFPQ_ONE;
+    for ( n = 10 ; n > 1 ; --n ) {
+        t = QFPQ_ONE + qFPQ_Shr( ( r*t )/n, 30U );
+    }
+    p = ( r*t ) + qFPQ_Shr( rl*t, 20U );
+    k += (int64_t)f;
+    if ( k > 60 ) {
+        retValue = INT64_MAX;
+    }
+    else if ( k < -2 ) {
+        retValue = 0;
+    }
+    else {
+        retValue = qFPQ_Shr( ( QFPQ_ONE*QFPQ_ONE ) + p, (uint8_t)( 60 - k ) );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int64_t qFPQ_Log( const int64_t x,
+                         const uint8_t f )
+{
+    int64_t m = x, d, s, sl, s2, t, k = -(int64_t)f;
+    int n;
+    /*x = m*2^k with m in [ 1, 2 ), so ln(x) = k*ln(2) + ln(m)*/
+    if ( m >= ( 2*QFPQ_ONE ) ) {
+        m = qFPQ_Shr( m, 1U );
+        ++k;
+    }
+    while ( m < QFPQ_ONE ) {
+        m *= 2;
+        --k;
+    }
+    k += 30;
+    /*ln(m) = 2*atanh( s ) = 2*s + 2*s^3*t, s = (m - 1)/(m + 1). The first
+    term is kept in Q50 together with k*ln(2), while the series, which only
+    adds a small correction, is evaluated with s in Q32*/
+    d = m + QFPQ_ONE;
+    s = ( ( m - QFPQ_ONE )*QFPQ_ONE )/d;
+    sl = ( ( ( ( m - QFPQ_ONE )*QFPQ_ONE ) % d )*( (int64_t)1 << 20 ) )/d;
+    sl += s*( (int64_t)1 << 20 );
+    s = qFPQ_Shr( sl, 18U );
+    s2 = qFPQ_Shr( s*s, 34U );
+    t = QFPQ_ONE/23;
+    for ( n = 9 ; n >= 0 ; --n ) {
+        t = ( QFPQ_ONE/( ( 2*n ) + 3 ) ) + qFPQ_Mul30( s2, t );
+    }
+    t = qFPQ_Shr( s*t, 30U );
+    t = qFPQ_Shr( s*t, 32U );
+    t = ( k*QFPQ_LN2_Q50 ) + ( 2*sl ) + ( 2*qFPQ_Shr( s*t, 14U ) );
+
+    return qFPQ_Shr( t, 50U - f );
+}
+/*============================================================================*/
+static int64_t qFPQ_Sin30( const int64_t x,
+                           const uint8_t quadrant )
+{
+    int64_t k, r, r2, t, retValue;
+    int n;
+    /*x = k*pi/2 + r with |r| <= pi/4*/
+    if ( x >= 0 ) {
+        k = ( x + ( QFPQ_PI_2/2 ) )/QFPQ_PI_2;
+    }
+    else {
+        k = -( ( ( QFPQ_PI_2/2 ) - x )/QFPQ_PI_2 );
+    }
+    r = x - qFPQ_Shr( k*QFPQ_PI_2_Q50, 20U );
+    r2 = qFPQ_Mul30( r, r );
+    k = ( ( k % 4 ) + 4 + (int64_t)quadrant ) % 4;
+    t = QFPQ_ONE;
+    if ( 0 == ( k & 1 ) ) {
+        for ( n = 6 ; n > 0 ; --n ) {
+            t = QFPQ_ONE - ( qFPQ_Mul30( r2, t )/( ( 2*n )*( ( 2*n ) + 1 ) ) );
+        }
+        retValue = qFPQ_Mul30( r, t );
+    }
+    else {
+        for ( n = 6 ; n > 0 ; --n ) {
+            t = QFPQ_ONE - ( qFPQ_Mul30( r2, t )/( ( ( 2*n ) - 1 )*( 2*n ) ) );
+        }
+        retValue = t;
+    }
+
+    return ( k >= 2 ) ? -retValue : retValue;
+}
+/*============================================================================*/
+static int64_t qFPQ_Atan2_30( const int64_t y,
+                              const int64_t x )
+{
+    const int64_t ax = ( x < 0 ) ? -x : x;
+    const int64_t ay = ( y < 0 ) ? -y : y;
+    int64_t a = 0, t, t2, u;
+    int n;
+
+    if ( ( 0 != ax ) || ( 0 != ay ) ) {
+        /*reduce to the first octant and then to |t| <= tan(pi/8)*/
+        t = ( ay > ax ) ? ( ( ax*QFPQ_ONE )/ay ) : ( ( ay*QFPQ_ONE )/ax );
+        if ( t > QFPQ_TAN_PI_8 ) {
+            t = ( ( t - QFPQ_ONE )*QFPQ_ONE )/( t + QFPQ_ONE );
+            a = QFPQ_PI_4;
+        }
+        t2 = qFPQ_Mul30( t, t );
+        u = QFPQ_ONE/25;
+        for ( n = 11 ; n >= 0 ; --n ) {
+            u = ( QFPQ_ONE/( ( 2*n ) + 1 ) ) - qFPQ_Mul30( t2, u );
+        }
+        a += qFPQ_Mul30( t, u );
+        if ( ay > ax ) {
+            a = QFPQ_PI_2 - a;
+        }
+        if ( x < 0 ) {
+            a = QFPQ_PI - a;
+        }
+        if ( y < 0 ) {
+            a = -a;
+        }
+    }
+
+    return a;
+}
+/*============================================================================*/
+/*cstat +MISRAC2012-Rule-10.8 +MISRAC2012-Rule-1.3_n +MISRAC2012-Rule-10.1_R6 +ATH-shift-neg +CERT-INT34-C_c +MISRAC2012-Rule-20.10 +MISRAC2012-Dir-4.9*/
@@ -10,45 +10,86 @@
 typedef float (*qInterp1Fcn_t)( const float x,
                                 const float * const tx,
                                 const float * const ty,
-                                const size_t tableSize );
+                                const size_t tableSize,
+                                qInterp1Segment_t * const hint );
 
 static float qInterp1_next( const float x,
                             const float * const tx,
                             const float * const ty,
-                            const size_t tableSize );
+                            const size_t tableSize,
+                            qInterp1Segment_t * const hint );
 static float qInterp1_previous( const float x,
                                 const float * const tx,
                                 const float * const ty,
-                                const size_t tableSize );
+                                const size_t tableSize,
+                                qInterp1Segment_t * const hint );
 static float qInterp1_nearest( const float x,
                                const float * const tx,
                                const float * const ty,
-                               const size_t tableSize );
+                               const size_t tableSize,
+                               qInterp1Segment_t * const hint );
 static float qInterp1_linear( const float x,
                               const float * const tx,
                               const float * const ty,
-                              const size_t tableSize );
+                              const size_t tableSize,
+                              qInterp1Segment_t * const hint );
 static float qInterp1_sine( const float x,
                             const float * const tx,
                             const float * const ty,
-                            const size_t tableSize );
+                            const size_t tableSize,
+                            qInterp1Segment_t * const hint );
 static float qInterp1_cubic( const float x,
                              const float * const tx,
                              const float * const ty,
-                             const size_t tableSize );
+                             const size_t tableSize,
+                             qInterp1Segment_t * const hint );
 static float qInterp1_hermite( const float x,
                                const float * const tx,
                                const float * const ty,
-                               const size_t tableSize );
+                               const size_t tableSize,
+                               qInterp1Segment_t * const hint );
 static float qInterp1_spline( const float x,
                               const float * const tx,
                               const float * const ty,
-                              const size_t tableSize );
+                              const size_t tableSize,
+                              qInterp1Segment_t * const hint );
 static float qInterp1_cSpline( const float x,
                                const float * const tx,
                                const float * const ty,
-                               const size_t tableSize );
+                               const size_t tableSize,
+                               qInterp1Segment_t * const hint );
 
+static size_t qInterp1_Search( const float x,
+                               const float * const tx,
+                               const size_t tableSize,
+                               qInterp1Segment_t * const hint );
+static int qInterp1_Coefficients( qInterp1_t * const i );
+static void qInterp1_Monotonic( qInterp1_t * const i );
+static size_t qInterp1_InverseSearch( qInterp1_t * const i,
+                                      const float y );
+static float qInterp1_InverseSolve( qInterp1_t * const i,
+                                    const float y,
+                                    float a,
+                                    float b );
+static float qInterp1_Poly( qInterp1_t * const i,
+                            const float x );
+static void qInterp1_HermiteCoeff( float * const c,
+                                   const float h,
+                                   const float y0,
+                                   const float y1,
+                                   const float t0,
+                                   const float t1 );
+static void qInterp1_splineSlopes( const float * const tx,
+                                   const float * const ty,
+                                   const size_t tableSize,
+                                   const size_t i,
+                                   float * const m0,
+                                   float * const m1 );
+static void qInterp1_cSplineCoeff( const float * const tx,
+                                   const float * const ty,
+                                   const size_t tableSize,
+                                   const size_t i,
+                                   float * const k );
 static float slope( const float * const tx,
                     const float * const ty,
                     const size_t i );
@@ -80,7 +121,13 @@ int qInterp1_Setup( qInterp1_t * const i,
         i->xData = xTable;
         i->yData = yTable;
         i->dataSize = sizeTable;
+        i->coeff = NULL;
+        i->coeffSize = 0U;
+        i->coeffReady = 0U;
+        i->mode = QINTERP1_LINEAR;
         i->method = &qInterp1_linear;
+        (void)qInterp1_SegmentSetup( &i->segment, xTable, sizeTable );
+        qInterp1_Monotonic( i );
         retVal = 1;
     }
 
@@ -92,7 +139,19 @@ int qInterp1_SetData( qInterp1_t * const i,
                       const float * const yTable,
                       const size_t sizeTable )
 {
-    return qInterp1_Setup( i, xTable, yTable, sizeTable );
+    int retVal = 0;
+
+    if ( ( NULL != i ) && ( sizeTable > 2U ) && ( NULL != xTable ) && ( NULL != yTable ) ) {
+        i->xData = xTable;
+        i->yData = yTable;
+        i->dataSize = sizeTable;
+        (void)qInterp1_SegmentSetup( &i->segment, xTable, sizeTable );
+        qInterp1_Monotonic( i );
+        (void)qInterp1_Coefficients( i );
+        retVal = 1;
+    }
+
+    return retVal;
 }
 /*============================================================================*/
 int qInterp1_SetMethod( qInterp1_t * const i,
@@ -113,40 +172,182 @@ int qInterp1_SetMethod( qInterp1_t * const i,
 
     if ( ( NULL != i ) && ( m < QINTERP1_MAX ) ) {
         i->method = im[ m ];
+        i->mode = m;
+        (void)qInterp1_Coefficients( i );
         retVal = 1;
     }
 
     return retVal;
 }
 /*============================================================================*/
+int qInterp1_SetCoeffBuffer( qInterp1_t * const i,
+                             float * const c,
+                             const size_t size )
+{
+    int retVal = 0;
+
+    if ( NULL != i ) {
+        i->coeff = c;
+        i->coeffSize = ( NULL != c ) ? size : 0U;
+        retVal = qInterp1_Coefficients( i );
+    }
+
+    return retVal;
+}
+/*============================================================================*/
 float qInterp1_Get( qInterp1_t * const i,
                     const float x )
 {
-    return i->method( x, i->xData, i->yData, i->dataSize );
+    float y;
+
+    if ( 0U != i->coeffReady ) {
+        y = qInterp1_Poly( i, x );
+    }
+    else {
+        y = i->method( x, i->xData, i->yData, i->dataSize, &i->segment );
+    }
+
+    return y;
+}
+/*============================================================================*/
+int qInterp1_GetArray( qInterp1_t * const i,
+                       const float * const xq,
+                       float * const yq,
+                       const size_t n )
+{
+    int retVal = 0;
+
+    if ( ( NULL != i ) && ( NULL != xq ) && ( NULL != yq ) ) {
+        const float * const tx = i->xData;
+        const float * const ty = i->yData;
+        const size_t last = i->dataSize - 1U;
+        size_t k;
+
+        /*the segment found for each point is the starting guess of the next
+        one, so a sorted array is resolved in a single pass over the table*/
+        for ( k = 0U ; k < n ; ++k ) {
+            const float x = xq[ k ];
+
+            if ( 0U != i->coeffReady ) {
+                yq[ k ] = qInterp1_Poly( i, x );
+            }
+            else if ( ( QINTERP1_LINEAR == i->mode ) && ( x >= tx[ 0 ] ) && ( x <= tx[ last ] ) ) {
+                const size_t s = qInterp1_Search( x, tx, i->dataSize, &i->segment );
+                const float x0 = tx[ s ];
+                const float y0 = ty[ s ];
+
+                yq[ k ] = y0 + ( ( ( ty[ s + 1U ] - y0 )/( tx[ s + 1U ] - x0 ) )*( x - x0 ) );
+            }
+            else {
+                yq[ k ] = i->method( x, tx, ty, i->dataSize, &i->segment );
+            }
+        }
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+float qInterp1_GetInverse( qInterp1_t * const i,
+                           const float y )
+{
+    float x = QFFM_NAN;
+
+    if ( ( NULL != i ) && ( 0 != i->monotonic ) ) {
+        const size_t k = qInterp1_InverseSearch( i, y );
+        const float x0 = i->xData[ k ];
+        const float x1 = i->xData[ k + 1U ];
+        const float y0 = i->yData[ k ];
+        const float y1 = i->yData[ k + 1U ];
+        const float w = ( y - y0 )/( y1 - y0 );
+
+        if ( ( w > 0.0F ) && ( w < 1.0F ) ) {
+            switch ( i->mode ) {
+                case QINTERP1_SINE:
+                case QINTERP1_CUBIC:
+                case QINTERP1_HERMITE:
+                case QINTERP1_SPLINE:
+                case QINTERP1_CONSTRAINED_SPLINE:
+                    x = qInterp1_InverseSolve( i, y, x0, x1 );
+                    break;
+                default:
+                    x = x0 + ( w*( x1 - x0 ) );
+                    break;
+            }
+        }
+        else {
+            x = x0 + ( w*( x1 - x0 ) );
+        }
+    }
+
+    return x;
+}
+/*============================================================================*/
+int qInterp1_SegmentSetup( qInterp1Segment_t * const s,
+                           const float * const tx,
+                           const size_t n )
+{
+    int retVal = 0;
+
+    if ( ( NULL != s ) && ( NULL != tx ) && ( n >= 2U ) ) {
+        /*the table is taken as uniform when every point lies within a small
+        fraction of the step from its place on the grid, the search remains
+        exact in any case, the tolerance only bounds the distance of the first
+        guess*/
+        const float step = ( tx[ n - 1U ] - tx[ 0 ] )/(float)( n - 1U );
+        const float tol = 1.0e-3F*step;
+        size_t k;
+
+        s->index = 0U;
+        s->invStep = 0.0F;
+        if ( step > 0.0F ) {
+            for ( k = 1U ; k < ( n - 1U ) ; ++k ) {
+                const float e = tx[ k ] - ( tx[ 0 ] + ( (float)k*step ) );
+
+                if ( !( qFFMath_Abs( e ) <= tol ) ) {
+                    break;
+                }
+            }
+            if ( k == ( n - 1U ) ) {
+                s->invStep = 1.0F/step;
+            }
+        }
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+size_t qInterp1_SegmentFind( qInterp1Segment_t * const s,
+                             const float * const tx,
+                             const size_t n,
+                             const float x )
+{
+    size_t k = 0U;
+
+    if ( ( NULL != s ) && ( NULL != tx ) && ( n >= 2U ) ) {
+        k = qInterp1_Search( x, tx, n, s );
+    }
+
+    return k;
 }
 /*============================================================================*/
 static float qInterp1_next( const float x,
                             const float * const tx,
                             const float * const ty,
-                            const size_t tableSize )
+                            const size_t tableSize,
+                            qInterp1Segment_t * const hint )
 {
     float y = QFFM_NAN;
 
     if ( ( tableSize >= 2U ) && ( NULL != tx ) && ( NULL != ty ) ) {
-        size_t nearestIndex = tableSize - 1U;
-
-        for ( size_t i = 0U ; i < ( tableSize - 1U ) ; ++i ) {
-            if ( x < tx[ i + 1U ] ) {
-                nearestIndex = i;
-                break;
-            }
-        }
+        const size_t i = qInterp1_Search( x, tx, tableSize, hint );
 
         if ( x >= tx[ tableSize - 1U ] ) {
             y = ty[ tableSize - 1U ];
         }
         else {
-            y = ty[ nearestIndex + 1U ];
+            y = ty[ i + 1U ];
         }
     }
 
@@ -156,7 +357,8 @@ static float qInterp1_next( const float x,
 static float qInterp1_previous( const float x,
                                 const float * const tx,
                                 const float * const ty,
-                                const size_t tableSize )
+                                const size_t tableSize,
+                                qInterp1Segment_t * const hint )
 {
     float y = QFFM_NAN;
 
@@ -164,16 +366,11 @@ static float qInterp1_previous( const float x,
         if ( x <= tx[ 0 ] ) {
             y = ty[ 0 ];
         }
+        else if ( x >= tx[ tableSize - 1U ] ) {
+            y = ty[ tableSize - 1U ];
+        }
         else {
-            size_t nearestIndex = 0U;
-
-            for ( size_t i = 1U ; i < tableSize; ++i ) {
-                if ( x < tx [ i ] ) {
-                    break;
-                }
-                nearestIndex = i;
-            }
-            y = ty[ nearestIndex ];
+            y = ty[ qInterp1_Search( x, tx, tableSize, hint ) ];
         }
     }
     return y;
@@ -182,23 +379,20 @@ static float qInterp1_previous( const float x,
 static float qInterp1_nearest( const float x,
                                const float * const tx,
                                const float * const ty,
-                               const size_t tableSize )
+                               const size_t tableSize,
+                               qInterp1Segment_t * const hint )
 {
     float y = QFFM_NAN;
 
     if ( ( tableSize >= 2U ) && ( NULL != tx ) && ( NULL != ty ) ) {
-        size_t nearestIndex = 0U;
-        float minDistance = qFFMath_Abs( x - tx[ 0 ] );
-
-        for ( size_t i = 1U ; i < tableSize; ++i ) {
-            const float distance = qFFMath_Abs( x - tx[ i ] );
-
-            if ( distance <= minDistance) {
-                minDistance = distance;
-                nearestIndex = i;
-            }
+        const size_t i = qInterp1_Search( x, tx, tableSize, hint );
+        /*on a tie, the upper neighbor is taken*/
+        if ( qFFMath_Abs( x - tx[ i + 1U ] ) <= qFFMath_Abs( x - tx[ i ] ) ) {
+            y = ty[ i + 1U ];
+        }
+        else {
+            y = ty[ i ];
         }
-        y = ty[ nearestIndex ];
     }
     return y;
 }
@@ -206,7 +400,8 @@ static float qInterp1_nearest( const float x,
 static float qInterp1_linear( const float x,
                               const float * const tx,
                               const float * const ty,
-                              const size_t tableSize )
+                              const size_t tableSize,
+                              qInterp1Segment_t * const hint )
 {
     float y = QFFM_NAN;
 
@@ -226,17 +421,12 @@ static float qInterp1_linear( const float x,
             y = y1 + ( ( ( y0 - y1 )/( x0 - x1 ) )*( x - x1 ) );
         }
         else {
-            const int maxIndex = (int)tableSize - 1;
-            for ( int i = 0; i < maxIndex; ++i ) {
-                if ( ( x >= tx[ i ] ) && ( x <= tx[ i + 1 ] ) ) {
-                    const float x0 = tx[ i ];
-                    const float x1 = tx[ i + 1 ];
-                    const float y0 = ty[ i ];
-                    const float y1 = ty[ i + 1 ];
-                    y = y0 + ( ( ( y1 - y0 )/( x1 - x0 ) )*( x - x0 ) );
-                    break;
-                }
-            }
+            const size_t i = qInterp1_Search( x, tx, tableSize, hint );
+            const float x0 = tx[ i ];
+            const float x1 = tx[ i + 1U ];
+            const float y0 = ty[ i ];
+            const float y1 = ty[ i + 1U ];
+            y = y0 + ( ( ( y1 - y0 )/( x1 - x0 ) )*( x - x0 ) );
         }
     }
     return y;
@@ -245,7 +435,8 @@ static float qInterp1_linear( const float x,
 static float qInterp1_sine( const float x,
                             const float * const tx,
                             const float * const ty,
-                            const size_t tableSize )
+                            const size_t tableSize,
+                            qInterp1Segment_t * const hint )
 {
     float y = QFFM_NAN;
 
@@ -267,16 +458,13 @@ static float qInterp1_sine( const float x,
             y = y1 + ( w*( y0 - y1 ) );
         }
         else {
-            for ( size_t i = 1; i < tableSize; ++i ) {
-                if ( x <= tx[ i ] ) {
-                    const float x0 = tx[ i - 1U ];
-                    const float x1 = tx[ i ];
-                    const float y0 = ty[ i - 1U ];
-                    const float y1 = ty[ i];
-                    const float w = 0.5F - ( 0.5F*qFFMath_Cos( QFFM_PI*( x - x0 )/( x1 - x0 ) ) );
-                    y = y0 + ( w*( y1 - y0 ) );
-                }
-            }
+            const size_t i = qInterp1_Search( x, tx, tableSize, hint );
+            const float x0 = tx[ i ];
+            const float x1 = tx[ i + 1U ];
+            const float y0 = ty[ i ];
+            const float y1 = ty[ i + 1U ];
+            const float w = 0.5F - ( 0.5F*qFFMath_Cos( QFFM_PI*( x - x0 )/( x1 - x0 ) ) );
+            y = y0 + ( w*( y1 - y0 ) );
         }
     }
     return y;
@@ -285,7 +473,8 @@ static float qInterp1_sine( const float x,
 static float qInterp1_cubic( const float x,
                              const float * const tx,
                              const float * const ty,
-                             const size_t tableSize )
+                             const size_t tableSize,
+                             qInterp1Segment_t * const hint )
 {
     float y = QFFM_NAN;
 
@@ -321,23 +510,21 @@ static float qInterp1_cubic( const float x,
                 ( ( t3 - t2 )*h*( y1 - y0 ) );
         }
         else {
-            for ( size_t i = 1U; i < tableSize; ++i ) {
-                if ( x <= tx[ i ] ) {
-                    const float x0 = tx[ i - 1U ];
-                    const float x1 = tx[ i ];
-                    const float y0 = ty[ i - 1U ];
-                    const float y1 = ty[ i ];
-                    const float h = x1 - x0;
-                    const float t = ( x - x0 )/h;
-                    const float t2 = t*t;
-                    const float t3 = t2*t;
-                    y = ( ( ( 2.0F*t3 ) - ( 3.0F*t2 ) + 1.0F )*y0 ) +
-                        ( ( t3 - ( 2.0F*t2 ) + t )*h*( y0 - ty[ i - 2U ] ) ) +
-                        ( ( -( 2.0F*t3 ) + ( 3.0F*t2 ) )*y1 ) +
-                        ( ( t3 - t2 )*h*( y1 - y0 ) );
-                    break;
-                }
-            }
+            const size_t i = qInterp1_Search( x, tx, tableSize, hint );
+            const float x0 = tx[ i ];
+            const float x1 = tx[ i + 1U ];
+            const float y0 = ty[ i ];
+            const float y1 = ty[ i + 1U ];
+            /*the first segment has no left neighbor, use its own difference*/
+            const float yl = ( i > 0U ) ? ty[ i - 1U ] : ( y0 - ( y1 - y0 ) );
+            const float h = x1 - x0;
+            const float t = ( x - x0 )/h;
+            const float t2 = t*t;
+            const float t3 = t2*t;
+            y = ( ( ( 2.0F*t3 ) - ( 3.0F*t2 ) + 1.0F )*y0 ) +
+                ( ( t3 - ( 2.0F*t2 ) + t )*h*( y0 - yl ) ) +
+                ( ( -( 2.0F*t3 ) + ( 3.0F*t2 ) )*y1 ) +
+                ( ( t3 - t2 )*h*( y1 - y0 ) );
         }
     }
     return y;
@@ -346,10 +533,12 @@ static float qInterp1_cubic( const float x,
 static float qInterp1_hermite( const float x,
                                const float * const tx,
                                const float * const ty,
-                               const size_t tableSize )
+                               const size_t tableSize,
+                               qInterp1Segment_t * const hint )
 {
     float y = QFFM_NAN;
 
+    (void)hint; /*the whole table takes part in the interpolation*/
     if ( ( tableSize >= 2U ) && ( NULL != tx ) && ( NULL != ty ) ) {
         if ( x < tx[ 0 ] ) {
             const float x0 = tx[ 0 ];
@@ -386,24 +575,14 @@ static float qInterp1_hermite( const float x,
 static float qInterp1_spline( const float x,
                               const float * const tx,
                               const float * const ty,
-                              const size_t tableSize )
+                              const size_t tableSize,
+                              qInterp1Segment_t * const hint )
 {
     float y = QFFM_NAN;
 
     if ( ( tableSize >= 4U ) && ( NULL != tx ) && ( NULL != ty ) ) {
-        size_t i = 0U;
-        /* Extrapolation for x beyond the range*/
-        if ( x <= tx[ 0 ] ) {
-            i = 0U;
-        }
-        else if ( x >= tx[ tableSize - 1U ] ) {
-            i = tableSize - 2U; /* Use the last interval for extrapolation*/
-        }
-        else {
-            while ( x >= tx[ i + 1U ] ) {
-                i++;
-            }
-        }
+        /*beyond the range, the first or the last interval extrapolates*/
+        const size_t i = qInterp1_Search( x, tx, tableSize, hint );
 
         if ( qFFMath_IsEqual( x , tx[ i + 1U ] ) ) {
             y = ty[ i + 1U ];
@@ -424,18 +603,7 @@ static float qInterp1_spline( const float x,
             float m0;
             float m1;
 
-            if ( 0U == i ) {
-                m0 = ( ty[ 1 ] - ty[ 0 ] )/( tx[ 1 ] - tx[ 0 ] );
-                m1 = ( ty[ 2 ] - ty[ 0 ] )/( tx[ 2 ] - tx[ 0 ] );
-            }
-            else if ( ( tableSize - 2U ) == i ) {
-                m0 = ( ty[ tableSize - 1U ] - ty[ tableSize - 3U ] )/( tx[ tableSize - 1U ] - tx[ tableSize - 3U ] );
-                m1 = ( ty[ tableSize - 1U ] - ty[ tableSize - 2U ] )/( tx[ tableSize - 1U ] - tx[ tableSize - 2U ] );
-            }
-            else {
-                m0 = slope( tx, ty, i );
-                m1 = slope( tx, ty, i + 1U );
-            }
+            qInterp1_splineSlopes( tx, ty, tableSize, i, &m0, &m1 );
             y = ( h00*y0 ) + ( h01*y1 ) + ( h10*x1_x0*m0 ) + ( h11*x1_x0*m1 );
         }
     }
@@ -446,52 +614,374 @@ static float qInterp1_spline( const float x,
 static float qInterp1_cSpline( const float x,
                                const float * const tx,
                                const float * const ty,
-                               const size_t tableSize )
+                               const size_t tableSize,
+                               qInterp1Segment_t * const hint )
 {
     float y = QFFM_NAN;
 
     if ( ( tableSize >= 4U ) && ( NULL != tx ) && ( NULL != ty ) ) {
-        size_t i = 0U;
-        /* Extrapolation for x beyond the range*/
-        if ( x <= tx[ 0 ] ) {
-            i = 0U;
+        /*beyond the range, the first or the last interval extrapolates*/
+        const size_t i = qInterp1_Search( x, tx, tableSize, hint );
+
+        if ( qFFMath_IsEqual( x , tx[ i + 1U ] ) ) {
+            y = ty[ i + 1U ];
         }
-        else if ( x >= tx[ tableSize - 1U ] ) {
-            i = tableSize - 2U; /* Use the last interval for extrapolation*/
+        else {
+            const float s = x - tx[ i ];
+            float k[ 4 ];
+
+            qInterp1_cSplineCoeff( tx, ty, tableSize, i, k );
+            y = k[ 0 ] + ( s*( k[ 1 ] + ( s*( k[ 2 ] + ( s*k[ 3 ] ) ) ) ) );
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+static size_t qInterp1_Search( const float x,
+                               const float * const tx,
+                               const size_t tableSize,
+                               qInterp1Segment_t * const hint )
+{
+    /*returns the segment i in [ 0, tableSize - 2 ] with tx[ i ] <= x < tx[ i + 1 ].
+    On equally spaced tables the segment is computed directly from x, otherwise
+    the segment of the previous call is used. From the guess, the search
+    gallops with doubling steps towards x and then bisects the last step, so
+    the cost grows with the logarithm of the distance to the guess and nearby
+    or ascending inputs are resolved in a few comparisons*/
+    const size_t last = tableSize - 2U;
+    size_t lo, hi, k = hint->index;
+
+    if ( hint->invStep > 0.0F ) {
+        const float t = ( x - tx[ 0 ] )*hint->invStep;
+
+        /*the comparisons also reject NaN before the conversion*/
+        if ( t >= (float)last ) {
+            k = last;
+        }
+        else if ( t > 0.0F ) {
+            k = (size_t)t;
+        }
+        else {
+            k = 0U;
+        }
+    }
+    else if ( k > last ) {
+        k = 0U;
+    }
+    else {
+        /*nothing to do*/
+    }
+    if ( x < tx[ k ] ) {
+        size_t step = 1U;
+
+        lo = 0U;
+        hi = k;
+        while ( ( step < hi ) && ( x < tx[ hi - step ] ) ) {
+            hi -= step;
+            step <<= 1U;
+        }
+        if ( step < hi ) {
+            lo = hi - step;
+        }
+    }
+    else if ( x >= tx[ k + 1U ] ) {
+        size_t step = 1U;
+
+        lo = k + 1U;
+        hi = tableSize - 1U;
+        while ( ( ( lo + step ) < hi ) && ( x >= tx[ lo + step ] ) ) {
+            lo += step;
+            step <<= 1U;
+        }
+        if ( ( lo + step ) < hi ) {
+            hi = lo + step;
+        }
+    }
+    else {
+        lo = k;
+        hi = k + 1U;
+    }
+    while ( ( hi - lo ) > 1U ) {
+        const size_t mid = lo + ( ( hi - lo ) >> 1U );
+
+        if ( x < tx[ mid ] ) {
+            hi = mid;
         }
         else {
-            while ( x >= tx[ i + 1U ] ) {
-                i++;
+            lo = mid;
+        }
+    }
+    if ( lo > last ) {
+        lo = last;
+    }
+    hint->index = lo;
+
+    return lo;
+}
+/*============================================================================*/
+static int qInterp1_Coefficients( qInterp1_t * const i )
+{
+    const float * const tx = i->xData;
+    const float * const ty = i->yData;
+    const size_t n = i->dataSize;
+    float * const c = i->coeff;
+
+    i->coeffReady = 0U;
+    if ( ( NULL != c ) && ( i->coeffSize >= QINTERP1_COEFF_SIZE( n ) ) ) {
+        size_t k;
+
+        /*each segment holds y = c0 + c1*s + c2*s^2 + c3*s^3 with s = x - tx[ k ]*/
+        if ( ( QINTERP1_CUBIC == i->mode ) && ( n >= 4U ) ) {
+            for ( k = 0U ; k < ( n - 1U ) ; ++k ) {
+                const float h = tx[ k + 1U ] - tx[ k ];
+                const float y0 = ty[ k ];
+                const float y1 = ty[ k + 1U ];
+                const float yl = ( k > 0U ) ? ty[ k - 1U ] : ( y0 - ( y1 - y0 ) );
+
+                qInterp1_HermiteCoeff( &c[ 4U*k ], h, y0, y1, h*( y0 - yl ), h*( y1 - y0 ) );
             }
+            i->coeffReady = 1U;
         }
+        else if ( ( QINTERP1_SPLINE == i->mode ) && ( n >= 4U ) ) {
+            for ( k = 0U ; k < ( n - 1U ) ; ++k ) {
+                const float h = tx[ k + 1U ] - tx[ k ];
+                float m0, m1;
 
-        if ( qFFMath_IsEqual( x , tx[ i + 1U ] ) ) {
-            y = ty[ i + 1U ];
+                qInterp1_splineSlopes( tx, ty, n, k, &m0, &m1 );
+                qInterp1_HermiteCoeff( &c[ 4U*k ], h, ty[ k ], ty[ k + 1U ], h*m0, h*m1 );
+            }
+            i->coeffReady = 1U;
+        }
+        else if ( ( QINTERP1_CONSTRAINED_SPLINE == i->mode ) && ( n >= 4U ) ) {
+            for ( k = 0U ; k < ( n - 1U ) ; ++k ) {
+                qInterp1_cSplineCoeff( tx, ty, n, k, &c[ 4U*k ] );
+            }
+            i->coeffReady = 1U;
+        }
+        else if ( QINTERP1_HERMITE == i->mode ) {
+            /*weights of the barycentric form of the interpolating polynomial,
+            the factors are scaled to a quarter of the table range to prevent
+            the products from overflowing, the scale cancels on evaluation*/
+            const float scale = 4.0F/( tx[ n - 1U ] - tx[ 0 ] );
+
+            for ( k = 0U ; k < n ; ++k ) {
+                float w = 1.0F;
+                size_t j;
+
+                for ( j = 0U ; j < n ; ++j ) {
+                    if ( j != k ) {
+                        w *= ( tx[ k ] - tx[ j ] )*scale;
+                    }
+                }
+                c[ k ] = 1.0F/w;
+            }
+            i->coeffReady = 1U;
         }
         else {
-            const float x0 = tx[ i ];
-            const float x1 = tx[ i + 1U ];
-            const float y0 = ty[ i ];
-            const float y1 = ty[ i + 1U ];
-            const float fd2i_xl1 = leftSecondDerivate( tx, ty, tableSize - 1U, i + 1U );
-            const float fd2i_x = rightSecondDerivate( tx, ty, tableSize - 1U, i + 1U );
-            const float x0_x1 = x0 - x1;
-            const float x1_2 = x1*x1;
-            const float x1_3 = x1_2*x1;
-            const float x0_2 = x0*x0;
-            const float x0_3 = x0_2*x0;
-            const float inv_x0_x1 = 1.0F/x0_x1;
-            const float d = ( fd2i_x - fd2i_xl1 )*( 0.166666667F*inv_x0_x1 );
-            const float c = ( ( x0*fd2i_xl1 ) - ( x1*fd2i_x ) )*( 0.5F*inv_x0_x1 );
-            const float b = ( y0 - y1 - ( c*( x0_2 - x1_2 ) ) - ( d*( x0_3 - x1_3 ) ) )*inv_x0_x1;
-            const float a = y1 - ( b*x1 ) - ( c*x1_2 ) - ( d*x1_3 );
-            y = a + ( x*( b + ( x*( c + ( x*d ) ) ) ) );
+            /*nothing to do*/
+        }
+    }
+
+    return (int)i->coeffReady;
+}
+/*============================================================================*/
+static void qInterp1_Monotonic( qInterp1_t * const i )
+{
+    const float * const ty = i->yData;
+    const size_t n = i->dataSize;
+    const int8_t dir = ( ty[ n - 1U ] > ty[ 0 ] ) ? 1 : -1;
+    size_t k;
+
+    i->inverseSegment = 0U;
+    i->monotonic = dir;
+    for ( k = 0U ; k < ( n - 1U ) ; ++k ) {
+        /*written to also reject NaN*/
+        if ( !( ( (float)dir*( ty[ k + 1U ] - ty[ k ] ) ) > 0.0F ) ) {
+            i->monotonic = 0;
+            break;
+        }
+    }
+}
+/*============================================================================*/
+static size_t qInterp1_InverseSearch( qInterp1_t * const i,
+                                      const float y )
+{
+    /*same as qInterp1_Search() on the y points, flipped by the direction of
+    the table, the result is in [ 0, tableSize - 2 ]*/
+    const float * const ty = i->yData;
+    const float d = (float)i->monotonic;
+    const size_t last = i->dataSize - 2U;
+    size_t k = i->inverseSegment;
+
+    if ( !( ( k <= last ) && ( ( d*( y - ty[ k ] ) ) >= 0.0F ) && ( ( d*( y - ty[ k + 1U ] ) ) < 0.0F ) ) ) {
+        size_t lo = 0U;
+        size_t hi = last + 1U;
+
+        while ( ( hi - lo ) > 1U ) {
+            const size_t mid = lo + ( ( hi - lo ) >> 1U );
+
+            if ( ( d*( y - ty[ mid ] ) ) < 0.0F ) {
+                hi = mid;
+            }
+            else {
+                lo = mid;
+            }
+        }
+        k = lo;
+    }
+    i->inverseSegment = k;
+
+    return k;
+}
+/*============================================================================*/
+static float qInterp1_InverseSolve( qInterp1_t * const i,
+                                    const float y,
+                                    float a,
+                                    float b )
+{
+    /*Illinois variant of the regula falsi on [ a, b ], the interpolation
+    passes through the points at both ends, so they bracket the solution.
+    The first step is the linear inverse, which is refined in a few steps*/
+    float fa = qInterp1_Get( i, a ) - y;
+    float fb = qInterp1_Get( i, b ) - y;
+    const float tol = 1.0e-6F*qFFMath_Abs( fb - fa );
+    float x = a;
+    int side = 0;
+    int n;
+
+    for ( n = 0 ; n < 32 ; ++n ) {
+        float fx;
+
+        x = ( ( fa*b ) - ( fb*a ) )/( fa - fb );
+        fx = qInterp1_Get( i, x ) - y;
+        if ( !( qFFMath_Abs( fx ) > tol ) ) {
+            break;
+        }
+        if ( ( fx*fb ) > 0.0F ) {
+            b = x;
+            fb = fx;
+            if ( -1 == side ) {
+                fa *= 0.5F;
+            }
+            side = -1;
+        }
+        else if ( ( fx*fa ) > 0.0F ) {
+            a = x;
+            fa = fx;
+            if ( 1 == side ) {
+                fb *= 0.5F;
+            }
+            side = 1;
+        }
+        else {
+            break;
         }
     }
 
+    return x;
+}
+/*============================================================================*/
+static float qInterp1_Poly( qInterp1_t * const i,
+                            const float x )
+{
+    const float * const tx = i->xData;
+    const float * const ty = i->yData;
+    const size_t n = i->dataSize;
+    const float * const c = i->coeff;
+    float y;
+
+    if ( ( ( QINTERP1_HERMITE == i->mode ) || ( QINTERP1_CUBIC == i->mode ) ) &&
+         ( ( x < tx[ 0 ] ) || ( x > tx[ n - 1U ] ) ) ) {
+        /*these methods use their own extrapolation*/
+        y = i->method( x, tx, ty, n, &i->segment );
+    }
+    else if ( QINTERP1_HERMITE == i->mode ) {
+        float num = 0.0F, den = 0.0F;
+        size_t k;
+
+        y = QFFM_NAN;
+        for ( k = 0U ; k < n ; ++k ) {
+            const float d = x - tx[ k ];
+
+            if ( qFFMath_IsEqual( x, tx[ k ] ) ) {
+                y = ty[ k ];
+                break;
+            }
+            num += ( c[ k ]/d )*ty[ k ];
+            den += c[ k ]/d;
+        }
+        if ( k == n ) {
+            y = num/den;
+        }
+    }
+    else {
+        const size_t k = qInterp1_Search( x, tx, n, &i->segment );
+        const float * const ck = &c[ 4U*k ];
+        const float s = x - tx[ k ];
+
+        y = ck[ 0 ] + ( s*( ck[ 1 ] + ( s*( ck[ 2 ] + ( s*ck[ 3 ] ) ) ) ) );
+    }
+
     return y;
 }
 /*============================================================================*/
+static void qInterp1_HermiteCoeff( float * const c,
+                                   const float h,
+                                   const float y0,
+                                   const float y1,
+                                   const float t0,
+                                   const float t1 )
+{
+    /*expands h00*y0 + h10*t0 + h01*y1 + h11*t1 with t = s/h*/
+    const float ih = 1.0F/h;
+
+    c[ 0 ] = y0;
+    c[ 1 ] = t0*ih;
+    c[ 2 ] = ( ( 3.0F*( y1 - y0 ) ) - ( 2.0F*t0 ) - t1 )*ih*ih;
+    c[ 3 ] = ( ( 2.0F*( y0 - y1 ) ) + t0 + t1 )*ih*ih*ih;
+}
+/*============================================================================*/
+static void qInterp1_splineSlopes( const float * const tx,
+                                   const float * const ty,
+                                   const size_t tableSize,
+                                   const size_t i,
+                                   float * const m0,
+                                   float * const m1 )
+{
+    if ( 0U == i ) {
+        *m0 = ( ty[ 1 ] - ty[ 0 ] )/( tx[ 1 ] - tx[ 0 ] );
+        *m1 = ( ty[ 2 ] - ty[ 0 ] )/( tx[ 2 ] - tx[ 0 ] );
+    }
+    else if ( ( tableSize - 2U ) == i ) {
+        *m0 = ( ty[ tableSize - 1U ] - ty[ tableSize - 3U ] )/( tx[ tableSize - 1U ] - tx[ tableSize - 3U ] );
+        *m1 = ( ty[ tableSize - 1U ] - ty[ tableSize - 2U ] )/( tx[ tableSize - 1U ] - tx[ tableSize - 2U ] );
+    }
+    else {
+        *m0 = slope( tx, ty, i );
+        *m1 = slope( tx, ty, i + 1U );
+    }
+}
+/*============================================================================*/
+static void qInterp1_cSplineCoeff( const float * const tx,
+                                   const float * const ty,
+                                   const size_t tableSize,
+                                   const size_t i,
+                                   float * const k )
+{
+    /*y = k0 + k1*s + k2*s^2 + k3*s^3 with s = x - tx[ i ], built from the
+    second derivatives at both ends, which avoids the cancellation of the
+    powers of x far from the origin*/
+    const float h = tx[ i + 1U ] - tx[ i ];
+    const float d2x0 = rightSecondDerivate( tx, ty, tableSize - 1U, i + 1U );
+    const float d2x1 = leftSecondDerivate( tx, ty, tableSize - 1U, i + 1U );
+
+    k[ 0 ] = ty[ i ];
+    k[ 2 ] = 0.5F*d2x0;
+    k[ 3 ] = ( d2x1 - d2x0 )/( 6.0F*h );
+    k[ 1 ] = ( ( ty[ i + 1U ] - ty[ i ] )/h ) - ( k[ 2 ]*h ) - ( k[ 3 ]*h*h );
+}
+/*============================================================================*/
 static float slope( const float * const tx,
                     const float * const ty,
                     const size_t i )
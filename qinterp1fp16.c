@@ -0,0 +1,575 @@
+/*!
+ * @file qinterp1fp16.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ **/
+
+#include "qinterp1fp16.h"
+
+typedef qFP16_t (*qInterp1FP16Fcn_t)( qInterp1FP16_t * const i,
+                                      const qFP16_t x );
+
+static qFP16_t qInterp1FP16_next( qInterp1FP16_t * const i,
+                                  const qFP16_t x );
+static qFP16_t qInterp1FP16_previous( qInterp1FP16_t * const i,
+                                      const qFP16_t x );
+static qFP16_t qInterp1FP16_nearest( qInterp1FP16_t * const i,
+                                     const qFP16_t x );
+static qFP16_t qInterp1FP16_linear( qInterp1FP16_t * const i,
+                                    const qFP16_t x );
+static qFP16_t qInterp1FP16_sine( qInterp1FP16_t * const i,
+                                  const qFP16_t x );
+static qFP16_t qInterp1FP16_cubic( qInterp1FP16_t * const i,
+                                   const qFP16_t x );
+static qFP16_t qInterp1FP16_hermite( qInterp1FP16_t * const i,
+                                     const qFP16_t x );
+static qFP16_t qInterp1FP16_spline( qInterp1FP16_t * const i,
+                                    const qFP16_t x );
+static qFP16_t qInterp1FP16_cSpline( qInterp1FP16_t * const i,
+                                     const qFP16_t x );
+
+static int qInterp1FP16_Init( qInterp1FP16_t * const i,
+                              const size_t sizeTable );
+static qFP16_t qInterp1FP16_At( const qInterp1FP16_Table_t * const t,
+                                const size_t k );
+static size_t qInterp1FP16_Search( qInterp1FP16_t * const i,
+                                   const qFP16_t x );
+static qFP16_t qInterp1FP16_Hermite( const qFP16_t t,
+                                     const qFP16_t p0,
+                                     const qFP16_t p1,
+                                     const qFP16_t m0,
+                                     const qFP16_t m1 );
+static qFP16_t qInterp1FP16_Scaled( const qFP16_t d,
+                                    const qFP16_t h,
+                                    const qFP16_t dx );
+static qFP16_t qInterp1FP16_Harmonic( const qFP16_t a,
+                                      const qFP16_t b );
+static qFP16_t qInterp1FP16_cSlope( qInterp1FP16_t * const i,
+                                    const size_t p,
+                                    const qFP16_t h );
+
+/*cstat -CERT-INT30-C_a*/
+
+/*============================================================================*/
+int qInterp1FP16_Setup( qInterp1FP16_t * const i,
+                        const qFP16_t * const xTable,
+                        const qFP16_t * const yTable,
+                        const size_t sizeTable )
+{
+    int retVal = 0;
+
+    if ( ( NULL != xTable ) && ( NULL != yTable ) ) {
+        retVal = qInterp1FP16_Init( i, sizeTable );
+        if ( 1 == retVal ) {
+            i->xData.fp = xTable;
+            i->yData.fp = yTable;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qInterp1FP16_SetupInt16( qInterp1FP16_t * const i,
+                             const int16_t * const xTable,
+                             const int16_t * const yTable,
+                             const size_t sizeTable )
+{
+    int retVal = 0;
+
+    if ( ( NULL != xTable ) && ( NULL != yTable ) ) {
+        retVal = qInterp1FP16_Init( i, sizeTable );
+        if ( 1 == retVal ) {
+            i->xData.raw = xTable;
+            i->yData.raw = yTable;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qInterp1FP16_SetScale( qInterp1FP16_t * const i,
+                           const qFP16_t xScale,
+                           const qFP16_t xOffset,
+                           const qFP16_t yScale,
+                           const qFP16_t yOffset )
+{
+    int retVal = 0;
+
+    if ( ( NULL != i ) && ( xScale > 0 ) ) {
+        i->xData.scale = xScale;
+        i->xData.offset = xOffset;
+        i->yData.scale = yScale;
+        i->yData.offset = yOffset;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qInterp1FP16_SetMethod( qInterp1FP16_t * const i,
+                            const qInterp1Method_t m )
+{
+    int retVal = 0;
+    static const qInterp1FP16Fcn_t im[ QINTERP1_MAX ] = {
+        &qInterp1FP16_next,
+        &qInterp1FP16_previous,
+        &qInterp1FP16_nearest,
+        &qInterp1FP16_linear,
+        &qInterp1FP16_sine,
+        &qInterp1FP16_cubic,
+        &qInterp1FP16_hermite,
+        &qInterp1FP16_spline,
+        &qInterp1FP16_cSpline,
+    };
+
+    if ( ( NULL != i ) && ( m < QINTERP1_MAX ) ) {
+        i->method = im[ m ];
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+qFP16_t qInterp1FP16_Get( qInterp1FP16_t * const i,
+                          const qFP16_t x )
+{
+    return i->method( i, x );
+}
+/*============================================================================*/
+static int qInterp1FP16_Init( qInterp1FP16_t * const i,
+                              const size_t sizeTable )
+{
+    int retVal = 0;
+
+    if ( ( NULL != i ) && ( sizeTable > 2U ) ) {
+        i->xData.fp = NULL;
+        i->xData.raw = NULL;
+        i->xData.scale = qFP16.one;
+        i->xData.offset = 0;
+        i->yData = i->xData;
+        i->dataSize = sizeTable;
+        i->segment = 0U;
+        i->method = &qInterp1FP16_linear;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_At( const qInterp1FP16_Table_t * const t,
+                                const size_t k )
+{
+    qFP16_t v;
+
+    if ( NULL != t->fp ) {
+        v = t->fp[ k ];
+    }
+    else {
+        /*an integer times a Q16.16 scale is already in Q16.16*/
+        v = t->offset + ( (qFP16_t)t->raw[ k ]*t->scale );
+    }
+
+    return v;
+}
+/*============================================================================*/
+static size_t qInterp1FP16_Search( qInterp1FP16_t * const i,
+                                   const qFP16_t x )
+{
+    /*same lookup of qInterp1: gallop from the segment of the previous call
+    and then bisect, the result is in [ 0, dataSize - 2 ]*/
+    const qInterp1FP16_Table_t * const tx = &i->xData;
+    const size_t last = i->dataSize - 2U;
+    size_t lo, hi, k = i->segment;
+
+    if ( k > last ) {
+        k = 0U;
+    }
+    if ( x < qInterp1FP16_At( tx, k ) ) {
+        size_t step = 1U;
+
+        lo = 0U;
+        hi = k;
+        while ( ( step < hi ) && ( x < qInterp1FP16_At( tx, hi - step ) ) ) {
+            hi -= step;
+            step <<= 1U;
+        }
+        if ( step < hi ) {
+            lo = hi - step;
+        }
+    }
+    else if ( x >= qInterp1FP16_At( tx, k + 1U ) ) {
+        size_t step = 1U;
+
+        lo = k + 1U;
+        hi = i->dataSize - 1U;
+        while ( ( ( lo + step ) < hi ) && ( x >= qInterp1FP16_At( tx, lo + step ) ) ) {
+            lo += step;
+            step <<= 1U;
+        }
+        if ( ( lo + step ) < hi ) {
+            hi = lo + step;
+        }
+    }
+    else {
+        lo = k;
+        hi = k + 1U;
+    }
+    while ( ( hi - lo ) > 1U ) {
+        const size_t mid = lo + ( ( hi - lo ) >> 1U );
+
+        if ( x < qInterp1FP16_At( tx, mid ) ) {
+            hi = mid;
+        }
+        else {
+            lo = mid;
+        }
+    }
+    if ( lo > last ) {
+        lo = last;
+    }
+    i->segment = lo;
+
+    return lo;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_next( qInterp1FP16_t * const i,
+                                  const qFP16_t x )
+{
+    const size_t n = i->dataSize;
+    const size_t k = qInterp1FP16_Search( i, x );
+    qFP16_t y;
+
+    if ( x >= qInterp1FP16_At( &i->xData, n - 1U ) ) {
+        y = qInterp1FP16_At( &i->yData, n - 1U );
+    }
+    else {
+        y = qInterp1FP16_At( &i->yData, k + 1U );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_previous( qInterp1FP16_t * const i,
+                                      const qFP16_t x )
+{
+    const size_t n = i->dataSize;
+    qFP16_t y;
+
+    if ( x <= qInterp1FP16_At( &i->xData, 0U ) ) {
+        y = qInterp1FP16_At( &i->yData, 0U );
+    }
+    else if ( x >= qInterp1FP16_At( &i->xData, n - 1U ) ) {
+        y = qInterp1FP16_At( &i->yData, n - 1U );
+    }
+    else {
+        y = qInterp1FP16_At( &i->yData, qInterp1FP16_Search( i, x ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_nearest( qInterp1FP16_t * const i,
+                                     const qFP16_t x )
+{
+    const size_t k = qInterp1FP16_Search( i, x );
+    const qFP16_t d0 = qFP16_Abs( qFP16_Sub( x, qInterp1FP16_At( &i->xData, k ) ) );
+    const qFP16_t d1 = qFP16_Abs( qFP16_Sub( x, qInterp1FP16_At( &i->xData, k + 1U ) ) );
+    qFP16_t y;
+
+    /*on a tie, the upper neighbor is taken*/
+    if ( d1 <= d0 ) {
+        y = qInterp1FP16_At( &i->yData, k + 1U );
+    }
+    else {
+        y = qInterp1FP16_At( &i->yData, k );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_linear( qInterp1FP16_t * const i,
+                                    const qFP16_t x )
+{
+    /*beyond the range, the first or the last interval extrapolates*/
+    const size_t k = qInterp1FP16_Search( i, x );
+    const qFP16_t x0 = qInterp1FP16_At( &i->xData, k );
+    const qFP16_t x1 = qInterp1FP16_At( &i->xData, k + 1U );
+    const qFP16_t y0 = qInterp1FP16_At( &i->yData, k );
+    const qFP16_t y1 = qInterp1FP16_At( &i->yData, k + 1U );
+    const qFP16_t t = qFP16_Div( qFP16_Sub( x, x0 ), qFP16_Sub( x1, x0 ) );
+
+    return qFP16_Add( y0, qFP16_Mul( t, qFP16_Sub( y1, y0 ) ) );
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_sine( qInterp1FP16_t * const i,
+                                  const qFP16_t x )
+{
+    const size_t k = qInterp1FP16_Search( i, x );
+    const qFP16_t x0 = qInterp1FP16_At( &i->xData, k );
+    const qFP16_t x1 = qInterp1FP16_At( &i->xData, k + 1U );
+    const qFP16_t y0 = qInterp1FP16_At( &i->yData, k );
+    const qFP16_t y1 = qInterp1FP16_At( &i->yData, k + 1U );
+    const qFP16_t t = qFP16_Div( qFP16_Sub( x, x0 ), qFP16_Sub( x1, x0 ) );
+    const qFP16_t c = qFP16_Cos( qFP16_Mul( qFP16.f_pi, t ) );
+    const qFP16_t w = qFP16_Mul( qFP16.one_half, qFP16_Sub( qFP16.one, c ) );
+
+    return qFP16_Add( y0, qFP16_Mul( w, qFP16_Sub( y1, y0 ) ) );
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_cubic( qInterp1FP16_t * const i,
+                                   const qFP16_t x )
+{
+    const size_t n = i->dataSize;
+    const qInterp1FP16_Table_t * const tx = &i->xData;
+    const qInterp1FP16_Table_t * const ty = &i->yData;
+    qFP16_t y = qFP16.overflow;
+
+    if ( n >= 4U ) {
+        if ( x < qInterp1FP16_At( tx, 0U ) ) {
+            const qFP16_t x0 = qInterp1FP16_At( tx, 0U );
+            const qFP16_t h = qFP16_Sub( qInterp1FP16_At( tx, 1U ), x0 );
+            const qFP16_t y0 = qInterp1FP16_At( ty, 0U );
+            const qFP16_t y1 = qInterp1FP16_At( ty, 1U );
+            const qFP16_t t = qFP16_Div( qFP16_Sub( x, x0 ), h );
+
+            y = qInterp1FP16_Hermite( t, y0, y1,
+                                      qFP16_Mul( h, qFP16_Sub( y0, y1 ) ),
+                                      qFP16_Mul( h, qFP16_Sub( y1, y0 ) ) );
+        }
+        else if ( x > qInterp1FP16_At( tx, n - 1U ) ) {
+            const qFP16_t x1 = qInterp1FP16_At( tx, n - 1U );
+            const qFP16_t h = qFP16_Sub( x1, qInterp1FP16_At( tx, n - 2U ) );
+            const qFP16_t y0 = qInterp1FP16_At( ty, n - 2U );
+            const qFP16_t y1 = qInterp1FP16_At( ty, n - 1U );
+            const qFP16_t t = qFP16_Div( qFP16_Sub( x, x1 ), h );
+
+            y = qInterp1FP16_Hermite( t, y1, y0,
+                                      qFP16_Mul( h, qFP16_Sub( y0, qInterp1FP16_At( ty, n - 3U ) ) ),
+                                      qFP16_Mul( h, qFP16_Sub( y1, y0 ) ) );
+        }
+        else {
+            const size_t k = qInterp1FP16_Search( i, x );
+            const qFP16_t x0 = qInterp1FP16_At( tx, k );
+            const qFP16_t h = qFP16_Sub( qInterp1FP16_At( tx, k + 1U ), x0 );
+            const qFP16_t y0 = qInterp1FP16_At( ty, k );
+            const qFP16_t y1 = qInterp1FP16_At( ty, k + 1U );
+            /*the first segment has no left neighbor, use its own difference*/
+            const qFP16_t yl = ( k > 0U ) ? qInterp1FP16_At( ty, k - 1U )
+                                          : qFP16_Sub( y0, qFP16_Sub( y1, y0 ) );
+            const qFP16_t t = qFP16_Div( qFP16_Sub( x, x0 ), h );
+
+            y = qInterp1FP16_Hermite( t, y0, y1,
+                                      qFP16_Mul( h, qFP16_Sub( y0, yl ) ),
+                                      qFP16_Mul( h, qFP16_Sub( y1, y0 ) ) );
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_hermite( qInterp1FP16_t * const i,
+                                     const qFP16_t x )
+{
+    const size_t n = i->dataSize;
+    const qInterp1FP16_Table_t * const tx = &i->xData;
+    const qInterp1FP16_Table_t * const ty = &i->yData;
+    qFP16_t y;
+
+    if ( ( x < qInterp1FP16_At( tx, 0U ) ) || ( x > qInterp1FP16_At( tx, n - 1U ) ) ) {
+        /*the extrapolation is linear on the first or the last interval*/
+        y = qInterp1FP16_linear( i, x );
+    }
+    else {
+        size_t k, j;
+
+        y = 0;
+        for ( k = 0U ; k < n ; ++k ) {
+            const qFP16_t xk = qInterp1FP16_At( tx, k );
+            qFP16_t term = qInterp1FP16_At( ty, k );
+
+            for ( j = 0U ; j < n ; ++j ) {
+                if ( k != j ) {
+                    const qFP16_t xj = qInterp1FP16_At( tx, j );
+
+                    term = qFP16_Mul( term, qFP16_Div( qFP16_Sub( x, xj ), qFP16_Sub( xk, xj ) ) );
+                }
+            }
+            y = qFP16_Add( y, term );
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_spline( qInterp1FP16_t * const i,
+                                    const qFP16_t x )
+{
+    const size_t n = i->dataSize;
+    const qInterp1FP16_Table_t * const tx = &i->xData;
+    const qInterp1FP16_Table_t * const ty = &i->yData;
+    qFP16_t y = qFP16.overflow;
+
+    if ( n >= 4U ) {
+        /*beyond the range, the first or the last interval extrapolates*/
+        const size_t k = qInterp1FP16_Search( i, x );
+        const qFP16_t x0 = qInterp1FP16_At( tx, k );
+        const qFP16_t x1 = qInterp1FP16_At( tx, k + 1U );
+        const qFP16_t y0 = qInterp1FP16_At( ty, k );
+        const qFP16_t y1 = qInterp1FP16_At( ty, k + 1U );
+
+        if ( x == x1 ) {
+            y = y1;
+        }
+        else {
+            /*the slopes are scaled by the interval width, so they are
+            differences of y and keep the resolution of the table*/
+            const qFP16_t h = qFP16_Sub( x1, x0 );
+            const qFP16_t dy = qFP16_Sub( y1, y0 );
+            const qFP16_t t = qFP16_Div( qFP16_Sub( x, x0 ), h );
+            qFP16_t m0, m1;
+
+            if ( 0U == k ) {
+                m0 = dy;
+                m1 = qInterp1FP16_Scaled( qFP16_Sub( qInterp1FP16_At( ty, 2U ), y0 ), h,
+                                          qFP16_Sub( qInterp1FP16_At( tx, 2U ), x0 ) );
+            }
+            else if ( ( n - 2U ) == k ) {
+                m0 = qInterp1FP16_Scaled( qFP16_Sub( y1, qInterp1FP16_At( ty, k - 1U ) ), h,
+                                          qFP16_Sub( x1, qInterp1FP16_At( tx, k - 1U ) ) );
+                m1 = dy;
+            }
+            else {
+                m0 = qInterp1FP16_Scaled( qFP16_Sub( y1, qInterp1FP16_At( ty, k - 1U ) ), h,
+                                          qFP16_Sub( x1, qInterp1FP16_At( tx, k - 1U ) ) );
+                m1 = qInterp1FP16_Scaled( qFP16_Sub( qInterp1FP16_At( ty, k + 2U ), y0 ), h,
+                                          qFP16_Sub( qInterp1FP16_At( tx, k + 2U ), x0 ) );
+            }
+            y = qInterp1FP16_Hermite( t, y0, y1, m0, m1 );
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_cSpline( qInterp1FP16_t * const i,
+                                     const qFP16_t x )
+{
+    const size_t n = i->dataSize;
+    qFP16_t y = qFP16.overflow;
+
+    if ( n >= 4U ) {
+        /*beyond the range, the first or the last interval extrapolates*/
+        const size_t k = qInterp1FP16_Search( i, x );
+        const qFP16_t x0 = qInterp1FP16_At( &i->xData, k );
+        const qFP16_t x1 = qInterp1FP16_At( &i->xData, k + 1U );
+        const qFP16_t y0 = qInterp1FP16_At( &i->yData, k );
+        const qFP16_t y1 = qInterp1FP16_At( &i->yData, k + 1U );
+
+        if ( x == x1 ) {
+            y = y1;
+        }
+        else {
+            /*the cubic of the floating-point version written in t, from the
+            first derivatives at both ends scaled by the interval width*/
+            const qFP16_t h = qFP16_Sub( x1, x0 );
+            const qFP16_t dy = qFP16_Sub( y1, y0 );
+            const qFP16_t dy2 = qFP16_Add( dy, dy );
+            const qFP16_t t = qFP16_Div( qFP16_Sub( x, x0 ), h );
+            const qFP16_t g0 = qInterp1FP16_cSlope( i, k, h );
+            const qFP16_t g1 = qInterp1FP16_cSlope( i, k + 1U, h );
+            const qFP16_t d1 = qFP16_Sub( dy2, g1 );
+            const qFP16_t d2 = qFP16_Sub( qFP16_Add( qFP16_Add( g1, g1 ), g0 ), qFP16_Add( dy2, dy ) );
+            const qFP16_t d3 = qFP16_Sub( dy2, qFP16_Add( g0, g1 ) );
+
+            y = qFP16_Mul( t, qFP16_Add( d2, qFP16_Mul( t, d3 ) ) );
+            y = qFP16_Add( y0, qFP16_Mul( t, qFP16_Add( d1, y ) ) );
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_Hermite( const qFP16_t t,
+                                     const qFP16_t p0,
+                                     const qFP16_t p1,
+                                     const qFP16_t m0,
+                                     const qFP16_t m1 )
+{
+    /*h00*p0 + h10*m0 + h01*p1 + h11*m1 written as
+    p0 + h01*( p1 - p0 ) + h10*m0 + h11*m1*/
+    const qFP16_t u = qFP16_Sub( qFP16.one, t );
+    const qFP16_t t2 = qFP16_Mul( t, t );
+    const qFP16_t h01 = qFP16_Mul( t2, qFP16_Add( qFP16.one, qFP16_Add( u, u ) ) );
+    const qFP16_t h10 = qFP16_Mul( t, qFP16_Mul( u, u ) );
+    const qFP16_t h11 = qFP16_Mul( t2, u ); /*negated*/
+    qFP16_t y;
+
+    y = qFP16_Sub( qFP16_Mul( h10, m0 ), qFP16_Mul( h11, m1 ) );
+    y = qFP16_Add( qFP16_Add( p0, qFP16_Mul( h01, qFP16_Sub( p1, p0 ) ) ), y );
+
+    return y;
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_Scaled( const qFP16_t d,
+                                    const qFP16_t h,
+                                    const qFP16_t dx )
+{
+    /*the slope d/dx scaled by h*/
+    return ( h == dx ) ? d : qFP16_Mul( d, qFP16_Div( h, dx ) );
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_Harmonic( const qFP16_t a,
+                                      const qFP16_t b )
+{
+    /*a*b/( a + b ), which is zero when any of them is zero*/
+    const qFP16_t s = qFP16_Add( a, b );
+
+    return ( 0 == s ) ? 0 : qFP16_Mul( a, qFP16_Div( b, s ) );
+}
+/*============================================================================*/
+static qFP16_t qInterp1FP16_cSlope( qInterp1FP16_t * const i,
+                                    const size_t p,
+                                    const qFP16_t h )
+{
+    /*the first derivative of the constrained spline at the point p, times the
+    width h of the interval being evaluated*/
+    const qInterp1FP16_Table_t * const tx = &i->xData;
+    const qInterp1FP16_Table_t * const ty = &i->yData;
+    const size_t last = i->dataSize - 1U;
+    qFP16_t g;
+
+    if ( ( 0U == p ) || ( last == p ) ) {
+        /*only used by the interval next to the end, so dy/dx*h = dy*/
+        const size_t a = ( 0U == p ) ? 0U : ( last - 2U );
+        const size_t b = ( 0U == p ) ? 1U : last;
+        const qFP16_t dy = qFP16_Sub( qInterp1FP16_At( ty, b ), qInterp1FP16_At( ty, b - 1U ) );
+        const qFP16_t dy2 = qFP16_Sub( qInterp1FP16_At( ty, a + 2U ), qInterp1FP16_At( ty, a ) );
+        const qFP16_t dx2 = qFP16_Sub( qInterp1FP16_At( tx, a + 2U ), qInterp1FP16_At( tx, a ) );
+        const qFP16_t u = qInterp1FP16_Scaled( dy2, h, dx2 );
+
+        g = qFP16_Sub( qFP16_Add( dy, qFP16_Mul( qFP16.one_half, dy ) ), qInterp1FP16_Harmonic( dy, u ) );
+    }
+    else {
+        const qFP16_t xp = qInterp1FP16_At( tx, p );
+        const qFP16_t yp = qInterp1FP16_At( ty, p );
+        const qFP16_t ul = qInterp1FP16_Scaled( qFP16_Sub( yp, qInterp1FP16_At( ty, p - 1U ) ), h,
+                                                qFP16_Sub( xp, qInterp1FP16_At( tx, p - 1U ) ) );
+        const qFP16_t ur = qInterp1FP16_Scaled( qFP16_Sub( qInterp1FP16_At( ty, p + 1U ), yp ), h,
+                                                qFP16_Sub( qInterp1FP16_At( tx, p + 1U ), xp ) );
+
+        /*the harmonic mean of both slopes, zero if they differ in sign*/
+        if ( ( ( ul > 0 ) && ( ur > 0 ) ) || ( ( ul < 0 ) && ( ur < 0 ) ) ) {
+            const qFP16_t hm = qInterp1FP16_Harmonic( ul, ur );
+
+            g = qFP16_Add( hm, hm );
+        }
+        else {
+            g = 0;
+        }
+    }
+
+    return g;
+}
+/*============================================================================*/
+
+/*cstat +CERT-INT30-C_a*/
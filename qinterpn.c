@@ -0,0 +1,205 @@
+/*!
+ * @file qinterpn.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qLibs distribution.
+ **/
+
+#include "qinterpn.h"
+
+static size_t qInterpN_Weights( qInterpN_t * const i,
+                                const size_t d,
+                                const float x,
+                                size_t * const idx,
+                                float * const w );
+
+/*cstat -CERT-INT30-C_a*/
+
+/*============================================================================*/
+int qInterpN_Setup( qInterpN_t * const i,
+                    const float * const * const axes,
+                    const size_t * const sizes,
+                    const size_t dims,
+                    const float * const data )
+{
+    int retVal = 0;
+
+    if ( ( NULL != i ) && ( NULL != axes ) && ( NULL != sizes ) && ( NULL != data ) &&
+         ( dims > 0U ) && ( dims <= QINTERPN_MAX_DIMS ) ) {
+        size_t d;
+        size_t stride = 1U;
+
+        retVal = 1;
+        /*row-major, the last axis is the contiguous one*/
+        for ( d = dims ; d > 0U ; --d ) {
+            const size_t k = d - 1U;
+
+            if ( 0 == qInterp1_SegmentSetup( &i->segment[ k ], axes[ k ], sizes[ k ] ) ) {
+                retVal = 0;
+                break;
+            }
+            i->axis[ k ] = axes[ k ];
+            i->size[ k ] = sizes[ k ];
+            i->stride[ k ] = stride;
+            stride *= sizes[ k ];
+        }
+        if ( 1 == retVal ) {
+            i->data = data;
+            i->dims = dims;
+            i->method = QINTERPN_LINEAR;
+        }
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+int qInterpN_SetMethod( qInterpN_t * const i,
+                        const qInterpNMethod_t m )
+{
+    int retVal = 0;
+
+    if ( ( NULL != i ) && ( m < QINTERPN_MAX ) ) {
+        i->method = m;
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+float qInterpN_Get( qInterpN_t * const i,
+                    const float * const x )
+{
+    size_t idx[ QINTERPN_MAX_DIMS ][ 4 ];
+    float w[ QINTERPN_MAX_DIMS ][ 4 ];
+    size_t cnt[ QINTERPN_MAX_DIMS ];
+    size_t pos[ QINTERPN_MAX_DIMS ];
+    const size_t outer = i->dims - 1U;
+    const float * const data = i->data;
+    float y = 0.0F;
+    size_t d;
+    int more = 1;
+
+    for ( d = 0U ; d < i->dims ; ++d ) {
+        cnt[ d ] = qInterpN_Weights( i, d, x[ d ], idx[ d ], w[ d ] );
+        pos[ d ] = 0U;
+    }
+    /*visit the 2^N or 4^N neighbors as runs along the last axis, which are
+    contiguous in the row-major table*/
+    while ( 0 != more ) {
+        const size_t * const in = idx[ outer ];
+        const float * const wn = w[ outer ];
+        float wt = 1.0F;
+        size_t base = 0U;
+        float run = 0.0F;
+        size_t k;
+
+        for ( d = 0U ; d < outer ; ++d ) {
+            wt *= w[ d ][ pos[ d ] ];
+            base += idx[ d ][ pos[ d ] ];
+        }
+        for ( k = 0U ; k < cnt[ outer ] ; ++k ) {
+            run += wn[ k ]*data[ base + in[ k ] ];
+        }
+        y += wt*run;
+
+        more = 0;
+        for ( d = outer ; d > 0U ; --d ) {
+            if ( ++pos[ d - 1U ] < cnt[ d - 1U ] ) {
+                more = 1;
+                break;
+            }
+            pos[ d - 1U ] = 0U;
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+int qInterpN_GetArray( qInterpN_t * const i,
+                       const float * const xq,
+                       float * const yq,
+                       const size_t n )
+{
+    int retVal = 0;
+
+    if ( ( NULL != i ) && ( NULL != xq ) && ( NULL != yq ) ) {
+        size_t k;
+
+        for ( k = 0U ; k < n ; ++k ) {
+            yq[ k ] = qInterpN_Get( i, &xq[ k*i->dims ] );
+        }
+        retVal = 1;
+    }
+
+    return retVal;
+}
+/*============================================================================*/
+static size_t qInterpN_Weights( qInterpN_t * const i,
+                                const size_t d,
+                                const float x,
+                                size_t * const idx,
+                                float * const w )
+{
+    /*returns the table offsets of the neighbors of x along the axis d and
+    their weights, so the interpolation is the weighted sum of the table
+    values at those offsets*/
+    const float * const tx = i->axis[ d ];
+    const size_t n = i->size[ d ];
+    const size_t s = i->stride[ d ];
+    const size_t k = qInterp1_SegmentFind( &i->segment[ d ], tx, n, x );
+    const float h = tx[ k + 1U ] - tx[ k ];
+    const float t = ( x - tx[ k ] )/h;
+    size_t cnt;
+
+    if ( QINTERPN_CUBIC == i->method ) {
+        /*Hermite basis with the finite-difference slopes of the qInterp1
+        spline, centered inside the table and one-sided at its ends*/
+        const float t2 = t*t;
+        const float t3 = t2*t;
+        const float h01 = ( 3.0F*t2 ) - ( 2.0F*t3 );
+        const float c0 = ( t3 - ( 2.0F*t2 ) + t )*h;
+        const float c1 = ( t3 - t2 )*h;
+
+        w[ 0 ] = 0.0F;
+        w[ 1 ] = 1.0F - h01;
+        w[ 2 ] = h01;
+        w[ 3 ] = 0.0F;
+        if ( 0U == k ) {
+            w[ 1 ] -= c0/h;
+            w[ 2 ] += c0/h;
+        }
+        else {
+            const float dx = tx[ k + 1U ] - tx[ k - 1U ];
+
+            w[ 0 ] -= c0/dx;
+            w[ 2 ] += c0/dx;
+        }
+        if ( ( n - 2U ) == k ) {
+            w[ 1 ] -= c1/h;
+            w[ 2 ] += c1/h;
+        }
+        else {
+            const float dx = tx[ k + 2U ] - tx[ k ];
+
+            w[ 1 ] -= c1/dx;
+            w[ 3 ] += c1/dx;
+        }
+        /*the unused neighbors beyond the ends carry a zero weight*/
+        idx[ 0 ] = ( ( k > 0U ) ? ( k - 1U ) : k )*s;
+        idx[ 1 ] = k*s;
+        idx[ 2 ] = ( k + 1U )*s;
+        idx[ 3 ] = ( ( ( k + 2U ) < n ) ? ( k + 2U ) : ( k + 1U ) )*s;
+        cnt = 4U;
+    }
+    else {
+        w[ 0 ] = 1.0F - t;
+        w[ 1 ] = t;
+        idx[ 0 ] = k*s;
+        idx[ 1 ] = ( k + 1U )*s;
+        cnt = 2U;
+    }
+
+    return cnt;
+}
+/*============================================================================*/
+
+/*cstat +CERT-INT30-C_a*/
@@ -5,12 +5,35 @@
  **/
 
 #include "qltisys.h"
+#include "qffmath.h"
 #include <float.h>
 
 static float qLTISys_DiscreteUpdate( qLTISys_t * const sys,
                                      const float u );
 static float qLTISys_ContinuosUpdate( qLTISys_t * const sys,
                                       const float u );
+static float qLTISys_Dot( const float * const a,
+                          const float * const b,
+                          const size_t n );
+static void qLTISys_DiscreteBlock( qLTISys_t * const sys,
+                                   const float * const u,
+                                   float * const y,
+                                   const size_t n );
+static void qLTISys_Roots( double * const c,
+                           const size_t n,
+                           float * const re,
+                           float * const im,
+                           const bool unit );
+static size_t qLTISys_Conjugates( float * const re,
+                                  float * const im,
+                                  const size_t n );
+static size_t qLTISys_Nearest( const float * const re,
+                               const float * const im,
+                               const bool * const used,
+                               const size_t n,
+                               const float xr,
+                               const float xi,
+                               const bool realOnly );
 
 /*============================================================================*/
 static float qLTISys_DiscreteUpdate( qLTISys_t * const sys,
@@ -85,6 +108,115 @@ float qLTISys_Excite( qLTISys_t * const sys,
     return y;
 }
 /*============================================================================*/
+int qLTISys_ExciteBlock( qLTISys_t * const sys,
+                         const float * const u,
+                         float * const y,
+                         const size_t n )
+{
+    int retValue = 0;
+
+    if ( ( 1 == qLTISys_IsInitialized( sys ) ) && ( NULL != u ) && ( NULL != y ) ) {
+        const float *in = u;
+        const float lo = sys->min;
+        const float hi = sys->max;
+        size_t k;
+
+        if ( NULL != sys->tDelay.head ) { /*check if has delay*/
+            /*the delayed input is staged in the output buffer, the update
+            below reads each sample before overwriting it*/
+            for ( k = 0U ; k < n ; ++k ) {
+                qTDL_InsertSample( &sys->tDelay, u[ k ] );
+                y[ k ] = qTDL_GetOldest( &sys->tDelay );
+            }
+            in = y;
+        }
+        if ( sys->dt <= 0.0F ) {
+            qLTISys_DiscreteBlock( sys, in, y, n );
+        }
+        else {
+            for ( k = 0U ; k < n ; ++k ) {
+                y[ k ] = qLTISys_ContinuosUpdate( sys, in[ k ] );
+            }
+        }
+        /*saturate the whole block in a separate pass*/
+        for ( k = 0U ; k < n ; ++k ) {
+            const float yk = ( y[ k ] < lo ) ? lo : y[ k ];
+
+            y[ k ] = ( yk > hi ) ? hi : yk;
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static void qLTISys_DiscreteBlock( qLTISys_t * const sys,
+                                   const float * const u,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*up to three states, the states and the coefficients are held in locals
+    for the whole block. Same operations and order as
+    qLTISys_DiscreteUpdate(), so the response is the same*/
+    float * const xd = sys->xd;
+    const float * const b = sys->b;
+    const float a0 = sys->a[ 0 ];
+    const float a1 = ( sys->na > 1U ) ? sys->a[ 1 ] : 0.0F;
+    const float a2 = ( sys->na > 2U ) ? sys->a[ 2 ] : 0.0F;
+    size_t k;
+
+    switch ( sys->n ) {
+        case 1U:
+        {
+            float x0 = xd[ 0 ];
+
+            for ( k = 0U ; k < n ; ++k ) {
+                x0 = u[ k ] - ( a0*x0 );
+                y[ k ] = b[ 0 ]*x0;
+            }
+            xd[ 0 ] = x0;
+            break;
+        }
+        case 2U:
+        {
+            float x0 = xd[ 0 ], x1 = xd[ 1 ];
+
+            for ( k = 0U ; k < n ; ++k ) {
+                const float v = u[ k ] - ( a0*x0 ) - ( a1*x1 );
+
+                y[ k ] = ( b[ 1 ]*x0 ) + ( b[ 0 ]*v );
+                x1 = x0;
+                x0 = v;
+            }
+            xd[ 0 ] = x0;
+            xd[ 1 ] = x1;
+            break;
+        }
+        case 3U:
+        {
+            float x0 = xd[ 0 ], x1 = xd[ 1 ], x2 = xd[ 2 ];
+
+            for ( k = 0U ; k < n ; ++k ) {
+                const float v = u[ k ] - ( a0*x0 ) - ( a1*x1 ) - ( a2*x2 );
+
+                y[ k ] = ( ( b[ 2 ]*x1 ) + ( b[ 1 ]*x0 ) ) + ( b[ 0 ]*v );
+                x2 = x1;
+                x1 = x0;
+                x0 = v;
+            }
+            xd[ 0 ] = x0;
+            xd[ 1 ] = x1;
+            xd[ 2 ] = x2;
+            break;
+        }
+        default:
+            for ( k = 0U ; k < n ; ++k ) {
+                y[ k ] = qLTISys_DiscreteUpdate( sys, u[ k ] );
+            }
+            break;
+    }
+}
+/*============================================================================*/
 int qLTISys_SetDelay( qLTISys_t * const sys,
                       float * const w,
                       const size_t n,
@@ -236,6 +368,69 @@ float qLTISys_DiscreteFIRUpdate( float *w,
     return y;
 }
 /*============================================================================*/
+float qLTISys_DiscreteFIRCircular( float * const w,
+                                   const float * const c,
+                                   const size_t wsize,
+                                   size_t * const head,
+                                   const float x )
+{
+    float y = 0.0F;
+
+    if ( ( NULL != w ) && ( NULL != head ) && ( wsize > 0U ) ) {
+        /*the newest sample takes the place of the oldest one, so the window
+        starts at h and wraps around, the taps [ 0, wsize - h ) are in
+        w[ h, wsize ) and the remaining ones in w[ 0, h )*/
+        const size_t h = ( 0U == *head ) ? ( wsize - 1U ) : ( *head - 1U );
+        const size_t n1 = wsize - h;
+
+        w[ h ] = x;
+        *head = h;
+        if ( NULL != c ) {
+            y = qLTISys_Dot( &w[ h ], c, n1 ) + qLTISys_Dot( w, &c[ n1 ], h );
+        }
+        else {
+            y = qLTISys_Dot( w, NULL, wsize );
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+static float qLTISys_Dot( const float * const a,
+                          const float * const b,
+                          const size_t n )
+{
+    /*four independent partial sums, so the loop can be unrolled and mapped to
+    vector instructions by the compiler. Without b, it's the sum of a*/
+    float s0 = 0.0F, s1 = 0.0F, s2 = 0.0F, s3 = 0.0F;
+    size_t i = 0U;
+
+    if ( NULL != b ) {
+        for ( ; ( i + 4U ) <= n ; i += 4U ) {
+            s0 += a[ i ]*b[ i ];
+            s1 += a[ i + 1U ]*b[ i + 1U ];
+            s2 += a[ i + 2U ]*b[ i + 2U ];
+            s3 += a[ i + 3U ]*b[ i + 3U ];
+        }
+        for ( ; i < n ; ++i ) {
+            s0 += a[ i ]*b[ i ];
+        }
+    }
+    else {
+        for ( ; ( i + 4U ) <= n ; i += 4U ) {
+            s0 += a[ i ];
+            s1 += a[ i + 1U ];
+            s2 += a[ i + 2U ];
+            s3 += a[ i + 3U ];
+        }
+        for ( ; i < n ; ++i ) {
+            s0 += a[ i ];
+        }
+    }
+
+    return ( s0 + s1 ) + ( s2 + s3 );
+}
+/*============================================================================*/
 int qLTISys_SetIntegrationMethod( qLTISys_t * const sys,
                                   qNumA_IntegrationMethod_t im )
 {
@@ -251,3 +446,409 @@ int qLTISys_SetIntegrationMethod( qLTISys_t * const sys,
     return retValue;
 }
 /*============================================================================*/
+int qLTISys_TFToSOS( float * const sos,
+                     const size_t ns,
+                     const float * const num,
+                     const size_t nb,
+                     const float * const den,
+                     const size_t na )
+{
+    int retValue = 0;
+
+    if ( ( NULL != sos ) && ( NULL != num ) && ( NULL != den ) && ( nb > 0U ) && ( ns > 0U ) ) {
+        double c[ QLTISYS_SOS_MAX_ORDER + 1U ];
+        float zr[ QLTISYS_SOS_MAX_ORDER ], zi[ QLTISYS_SOS_MAX_ORDER ];
+        float pr[ QLTISYS_SOS_MAX_ORDER ], pi[ QLTISYS_SOS_MAX_ORDER ];
+        bool zu[ QLTISYS_SOS_MAX_ORDER ], pu[ QLTISYS_SOS_MAX_ORDER ];
+        const size_t order = ( ( nb - 1U ) > na ) ? ( nb - 1U ) : na;
+        size_t d = 0U;
+
+        /*leading zeros of the numerator are delays of the input*/
+        while ( ( d < nb ) && qFFMath_IsEqual( 0.0F, num[ d ] ) ) {
+            ++d;
+        }
+        if ( ( d < nb ) && ( !qFFMath_IsEqual( 0.0F, den[ 0 ] ) ) &&
+             ( order <= QLTISYS_SOS_MAX_ORDER ) && ( ( 2U*ns ) >= order ) ) {
+            const size_t m = nb - 1U - d;
+            size_t nz, np, i, j, k = 0U;
+
+            for ( i = 0U ; i <= m ; ++i ) {
+                c[ i ] = (double)num[ d + i ]/(double)num[ d ];
+            }
+            qLTISys_Roots( c, m, zr, zi, true );
+            nz = qLTISys_Conjugates( zr, zi, m );
+            for ( i = 0U ; i <= na ; ++i ) {
+                c[ i ] = (double)den[ i ]/(double)den[ 0 ];
+            }
+            qLTISys_Roots( c, na, pr, pi, false );
+            np = qLTISys_Conjugates( pr, pi, na );
+            for ( i = 0U ; i < QLTISYS_SOS_MAX_ORDER ; ++i ) {
+                zu[ i ] = false;
+                pu[ i ] = false;
+            }
+            /*sort the poles by magnitude, the closest to the unit circle first*/
+            for ( i = 1U ; i < np ; ++i ) {
+                const float tr = pr[ i ], ti = pi[ i ];
+                const float r2 = ( tr*tr ) + ( ti*ti );
+
+                for ( j = i ; j > 0U ; --j ) {
+                    if ( ( ( pr[ j - 1U ]*pr[ j - 1U ] ) + ( pi[ j - 1U ]*pi[ j - 1U ] ) ) >= r2 ) {
+                        break;
+                    }
+                    pr[ j ] = pr[ j - 1U ];
+                    pi[ j ] = pi[ j - 1U ];
+                }
+                pr[ j ] = tr;
+                pi[ j ] = ti;
+            }
+            /*sections are built from the poles closest to the unit circle
+            and stored backwards, so those poles are evaluated at the end*/
+            for ( i = 0U ; i < ns ; ++i ) {
+                float * const s = &sos[ 5U*( ns - 1U - i ) ];
+                float xr = 0.0F, xi = 0.0F;
+
+                s[ 0 ] = 1.0F;
+                s[ 1 ] = 0.0F;
+                s[ 2 ] = 0.0F;
+                s[ 3 ] = 0.0F;
+                s[ 4 ] = 0.0F;
+                while ( ( k < np ) && pu[ k ] ) {
+                    ++k;
+                }
+                if ( k < np ) {
+                    pu[ k ] = true;
+                    xr = pr[ k ];
+                    xi = pi[ k ];
+                    if ( xi > 0.0F ) { /*complex conjugate pair*/
+                        s[ 3 ] = -2.0F*xr;
+                        s[ 4 ] = ( xr*xr ) + ( xi*xi );
+                    }
+                    else { /*real pole, paired with the closest real one*/
+                        s[ 3 ] = -xr;
+                        j = qLTISys_Nearest( pr, pi, pu, np, xr, xi, true );
+                        if ( j < np ) {
+                            pu[ j ] = true;
+                            s[ 3 ] -= pr[ j ];
+                            s[ 4 ] = xr*pr[ j ];
+                        }
+                    }
+                }
+                /*the zeros closest to the poles of the section*/
+                j = qLTISys_Nearest( zr, zi, zu, nz, xr, xi, false );
+                if ( j < nz ) {
+                    zu[ j ] = true;
+                    if ( zi[ j ] > 0.0F ) {
+                        s[ 1 ] = -2.0F*zr[ j ];
+                        s[ 2 ] = ( zr[ j ]*zr[ j ] ) + ( zi[ j ]*zi[ j ] );
+                    }
+                    else {
+                        const float r = zr[ j ];
+
+                        s[ 1 ] = -r;
+                        j = qLTISys_Nearest( zr, zi, zu, nz, xr, xi, true );
+                        if ( j < nz ) {
+                            zu[ j ] = true;
+                            s[ 1 ] -= zr[ j ];
+                            s[ 2 ] = r*zr[ j ];
+                        }
+                        else if ( d > 0U ) { /*( 1 - r*z^-1 )*z^-1*/
+                            --d;
+                            s[ 0 ] = 0.0F;
+                            s[ 1 ] = 1.0F;
+                            s[ 2 ] = -r;
+                        }
+                        else {
+                            /*nothing to do*/
+                        }
+                    }
+                }
+                else if ( d > 1U ) {
+                    d -= 2U;
+                    s[ 0 ] = 0.0F;
+                    s[ 2 ] = 1.0F;
+                }
+                else if ( d > 0U ) {
+                    --d;
+                    s[ 0 ] = 0.0F;
+                    s[ 1 ] = 1.0F;
+                }
+                else {
+                    /*nothing to do*/
+                }
+            }
+            /*the gain of the transfer function goes to the first section*/
+            for ( i = 0U ; i < 3U ; ++i ) {
+                sos[ i ] *= num[ nb - 1U - m ]/den[ 0 ];
+            }
+            retValue = 1;
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qLTISys_SOSSetup( qLTISysSOS_t * const sys,
+                      const float * const sos,
+                      float * const x,
+                      const size_t ns )
+{
+    int retValue = 0;
+
+    if ( ( NULL != sys ) && ( NULL != sos ) && ( NULL != x ) && ( ns > 0U ) ) {
+        size_t i;
+
+        sys->c = sos;
+        sys->x = x;
+        sys->ns = ns;
+        for ( i = 0U ; i < ( 2U*ns ) ; ++i ) {
+            x[ i ] = 0.0F;
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+float qLTISys_SOSExcite( qLTISysSOS_t * const sys,
+                         const float u )
+{
+    float y = u;
+    size_t i;
+
+    for ( i = 0U ; i < sys->ns ; ++i ) {
+        const float * const c = &sys->c[ 5U*i ];
+        float * const x = &sys->x[ 2U*i ];
+        const float v = y;
+
+        /*using transposed direct-form 2*/
+        y = ( c[ 0 ]*v ) + x[ 0 ];
+        x[ 0 ] = ( ( c[ 1 ]*v ) - ( c[ 3 ]*y ) ) + x[ 1 ];
+        x[ 1 ] = ( c[ 2 ]*v ) - ( c[ 4 ]*y );
+    }
+
+    return y;
+}
+/*============================================================================*/
+int qLTISys_SOSExciteBlock( qLTISysSOS_t * const sys,
+                            const float * const u,
+                            float * const y,
+                            const size_t n )
+{
+    int retValue = 0;
+
+    if ( ( NULL != sys ) && ( NULL != u ) && ( NULL != y ) ) {
+        const float *in = u;
+        size_t i, k;
+
+        /*the whole block goes through one section before the next one, the
+        output of each section is the input of the following one*/
+        for ( i = 0U ; i < sys->ns ; ++i ) {
+            const float * const c = &sys->c[ 5U*i ];
+            const float b0 = c[ 0 ], b1 = c[ 1 ], b2 = c[ 2 ];
+            const float a1 = c[ 3 ], a2 = c[ 4 ];
+            float x0 = sys->x[ 2U*i ], x1 = sys->x[ ( 2U*i ) + 1U ];
+
+            for ( k = 0U ; k < n ; ++k ) {
+                const float v = in[ k ];
+                const float yk = ( b0*v ) + x0;
+
+                x0 = ( ( b1*v ) - ( a1*yk ) ) + x1;
+                x1 = ( b2*v ) - ( a2*yk );
+                y[ k ] = yk;
+            }
+            sys->x[ 2U*i ] = x0;
+            sys->x[ ( 2U*i ) + 1U ] = x1;
+            in = y;
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static void qLTISys_Roots( double * const c,
+                           const size_t n,
+                           float * const re,
+                           float * const im,
+                           const bool unit )
+{
+    /*Aberth-Ehrlich method, all the roots of the monic polynomial c of
+    degree n are refined simultaneously. It runs in double precision, it's
+    only used by the conversion and the roots of high order polynomials
+    are too sensitive for single precision. The contents of c are lost*/
+    size_t m = n;
+    double r;
+
+    /*trailing zeros are roots at the origin*/
+    while ( ( m > 0U ) && qFFMath_IsEqual( 0.0F, (float)c[ m ] ) ) {
+        --m;
+        re[ m ] = 0.0F;
+        im[ m ] = 0.0F;
+    }
+    /*the multiple zeros at z = -1 and z = 1 of the lowpass and highpass
+    designs would be resolved poorly by the iteration, so they are taken
+    out by synthetic division while the polynomial vanishes there. Not
+    for poles, a pole close to z = 1 is not the same as an integrator*/
+    for ( r = -1.0 ; unit && ( r < 2.0 ) ; r += 2.0 ) {
+        while ( m > 0U ) {
+            double p = 0.0;
+            double bound = 0.0;
+            size_t i;
+
+            for ( i = 0U ; i <= m ; ++i ) {
+                p = ( p*r ) + c[ i ];
+                bound += ( c[ i ] < 0.0 ) ? -c[ i ] : c[ i ];
+            }
+            if ( ( p*p ) > ( 64.0*(double)( m*m )*DBL_EPSILON*DBL_EPSILON*bound*bound ) ) {
+                break;
+            }
+            for ( i = 1U ; i < m ; ++i ) {
+                c[ i ] += r*c[ i - 1U ];
+            }
+            --m;
+            re[ m ] = (float)r;
+            im[ m ] = 0.0F;
+        }
+    }
+    if ( m > 0U ) {
+        /*initial guesses around a circle with the mean magnitude of the roots*/
+        const float r0 = qFFMath_Pow( qFFMath_Abs( (float)c[ m ] ), 1.0F/(float)m );
+        const double tol = 16.0*DBL_EPSILON*DBL_EPSILON;
+        double zre[ QLTISYS_SOS_MAX_ORDER ], zim[ QLTISYS_SOS_MAX_ORDER ];
+        bool done = false;
+        size_t it, k, j;
+
+        for ( k = 0U ; k < m ; ++k ) {
+            const float t = ( ( 2.0F*QFFM_PI*(float)k )/(float)m ) + 0.4F;
+
+            zre[ k ] = (double)( r0*qFFMath_Cos( t ) );
+            zim[ k ] = (double)( r0*qFFMath_Sin( t ) );
+        }
+        for ( it = 0U ; ( it < 200U ) && ( !done ) ; ++it ) {
+            done = true;
+            for ( k = 0U ; k < m ; ++k ) {
+                const double zr = zre[ k ], zi = zim[ k ];
+                double pr = 1.0, pi = 0.0, dr = 0.0, di = 0.0;
+                double sr = 0.0, si = 0.0;
+                double t, qr, qi, wr, wi, mag;
+
+                for ( j = 1U ; j <= m ; ++j ) { /*p(z) and p'(z) by Horner*/
+                    t = ( ( dr*zr ) - ( di*zi ) ) + pr;
+                    di = ( ( dr*zi ) + ( di*zr ) ) + pi;
+                    dr = t;
+                    t = ( ( pr*zr ) - ( pi*zi ) ) + c[ j ];
+                    pi = ( pr*zi ) + ( pi*zr );
+                    pr = t;
+                }
+                mag = ( dr*dr ) + ( di*di );
+                if ( mag > 0.0 ) {
+                    qr = ( ( pr*dr ) + ( pi*di ) )/mag; /*q = p/p'*/
+                    qi = ( ( pi*dr ) - ( pr*di ) )/mag;
+                    for ( j = 0U ; j < m ; ++j ) { /*s = sum( 1/( z_k - z_j ) )*/
+                        const double er = zr - zre[ j ];
+                        const double ei = zi - zim[ j ];
+                        const double e2 = ( er*er ) + ( ei*ei );
+
+                        if ( ( j != k ) && ( e2 > 0.0 ) ) {
+                            sr += er/e2;
+                            si -= ei/e2;
+                        }
+                    }
+                    /*w = q/( 1 - q*s )*/
+                    t = 1.0 - ( ( qr*sr ) - ( qi*si ) );
+                    wi = -( ( qr*si ) + ( qi*sr ) );
+                    mag = ( t*t ) + ( wi*wi );
+                    if ( mag > 0.0 ) {
+                        wr = ( ( qr*t ) + ( qi*wi ) )/mag;
+                        wi = ( ( qi*t ) - ( qr*wi ) )/mag;
+                        zre[ k ] = zr - wr;
+                        zim[ k ] = zi - wi;
+                        if ( ( ( wr*wr ) + ( wi*wi ) ) > ( tol*( ( zr*zr ) + ( zi*zi ) ) ) ) {
+                            done = false;
+                        }
+                    }
+                }
+            }
+        }
+        for ( k = 0U ; k < m ; ++k ) {
+            re[ k ] = (float)zre[ k ];
+            im[ k ] = (float)zim[ k ];
+        }
+    }
+}
+/*============================================================================*/
+static size_t qLTISys_Conjugates( float * const re,
+                                  float * const im,
+                                  const size_t n )
+{
+    /*each complex root is matched with its conjugate and only one of them
+    is kept, with a positive imaginary part, real roots get a zero one.
+    Returns the number of roots kept*/
+    float tr[ QLTISYS_SOS_MAX_ORDER ], ti[ QLTISYS_SOS_MAX_ORDER ];
+    bool used[ QLTISYS_SOS_MAX_ORDER ];
+    size_t cnt = 0U, i, j, k;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        used[ i ] = false;
+    }
+    for ( i = 0U ; i < n ; ++i ) {
+        float best = -1.0F;
+
+        k = n;
+        for ( j = 0U ; j < n ; ++j ) { /*the most complex one left*/
+            if ( ( !used[ j ] ) && ( qFFMath_Abs( im[ j ] ) > best ) ) {
+                best = qFFMath_Abs( im[ j ] );
+                k = j;
+            }
+        }
+        if ( k < n ) {
+            const float mag = qFFMath_Sqrt( ( re[ k ]*re[ k ] ) + ( im[ k ]*im[ k ] ) );
+
+            used[ k ] = true;
+            tr[ cnt ] = re[ k ];
+            ti[ cnt ] = 0.0F;
+            j = ( best > ( 1.0e-4F*( 1.0F + mag ) ) ) ? qLTISys_Nearest( re, im, used, n, re[ k ], -im[ k ], false ) : n;
+            if ( j < n ) {
+                used[ j ] = true;
+                tr[ cnt ] = 0.5F*( re[ k ] + re[ j ] );
+                ti[ cnt ] = 0.5F*( qFFMath_Abs( im[ k ] ) + qFFMath_Abs( im[ j ] ) );
+            }
+            ++cnt;
+        }
+    }
+    for ( i = 0U ; i < cnt ; ++i ) {
+        re[ i ] = tr[ i ];
+        im[ i ] = ti[ i ];
+    }
+
+    return cnt;
+}
+/*============================================================================*/
+static size_t qLTISys_Nearest( const float * const re,
+                               const float * const im,
+                               const bool * const used,
+                               const size_t n,
+                               const float xr,
+                               const float xi,
+                               const bool realOnly )
+{
+    /*index of the unused root closest to x, n if there is none left*/
+    float best = FLT_MAX;
+    size_t i, k = n;
+
+    for ( i = 0U ; i < n ; ++i ) {
+        if ( ( !used[ i ] ) && ( ( !realOnly ) || ( im[ i ] <= 0.0F ) ) ) {
+            const float er = re[ i ] - xr;
+            const float ei = im[ i ] - xi;
+            const float e2 = ( er*er ) + ( ei*ei );
+
+            if ( e2 < best ) {
+                best = e2;
+                k = i;
+            }
+        }
+    }
+
+    return k;
+}
+/*============================================================================*/
@@ -189,6 +189,7 @@ static int qSSmoother_Setup_MWM1( _qSSmoother_t * const f,
         /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
         s->w = window;
         s->wsize = wsize;
+        s->head = 0U;
         retValue = qSSmoother_Reset( s );
         (void)param;
     }
@@ -232,6 +233,7 @@ static int qSSmoother_Setup_MOR1( _qSSmoother_t * const f,
         /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
         s->w = window;
         s->wsize = wsize;
+        s->head = 0U;
         s->alpha  = a;
         retValue = qSSmoother_Reset( s );
     }
@@ -303,6 +305,7 @@ static int qSSmoother_Setup_GMWF( _qSSmoother_t * const f,
         s->w = window;
         s->k = kernel;
         s->wsize = ws;
+        s->head = 0U;
         retValue = qSSmoother_Reset( s );
     }
 
@@ -528,10 +531,11 @@ static float qSSmoother_Filter_MWM1( _qSSmoother_t * const f,
     /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
     if ( 1U == f->init ) {
         qSSmoother_WindowSet( s->w, s->wsize, x );
+        s->head = 0U;
         f->init = 0U;
     }
     /*cstat -CERT-FLP36-C*/
-    return qLTISys_DiscreteFIRUpdate( s->w, NULL, s->wsize, x )/(float)s->wsize;
+    return qLTISys_DiscreteFIRCircular( s->w, NULL, s->wsize, &s->head, x )/(float)s->wsize;
     /*cstat +CERT-FLP36-C*/
 }
 /*============================================================================*/
@@ -564,20 +568,21 @@ static float qSSmoother_Filter_MOR1( _qSSmoother_t * const f,
     /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
     if ( 1U == f->init ) {
         qSSmoother_WindowSet( s->w, s->wsize, x );
+        s->head = 0U;
         s->m = x;
         f->init = 0U;
     }
-    /*shift, sum and compensate*/
-    m = qLTISys_DiscreteFIRUpdate( s->w, NULL, s->wsize, x ) - x;
+    /*insert, sum and compensate*/
+    m = qLTISys_DiscreteFIRCircular( s->w, NULL, s->wsize, &s->head, x ) - x;
     /*is it an outlier?*/
     if ( QLIB_ABS( s->m - x ) > ( s->alpha*QLIB_ABS( s->m ) ) ) {
-        s->w[ 0 ] = s->m; /*replace the outlier with the dynamic median*/
+        s->w[ s->head ] = s->m; /*replace the outlier with the dynamic median*/
     }
     /*cstat -CERT-FLP36-C*/
     /*compute new mean for next iteration*/
-    s->m = ( m + s->w[ 0 ] ) / (float)s->wsize;
+    s->m = ( m + s->w[ s->head ] ) / (float)s->wsize;
     /*cstat +CERT-FLP36-C*/
-    return s->w[ 0 ];
+    return s->w[ s->head ];
 }
 /*============================================================================*/
 static float qSSmoother_Filter_MOR2( _qSSmoother_t * const f,
@@ -616,10 +621,11 @@ static float qSSmoother_Filter_GMWF( _qSSmoother_t * const f,
 
     if ( 1U == f->init ) {
         qSSmoother_WindowSet( s->w, s->wsize, x );
+        s->head = 0U;
         f->init = 0U;
     }
 
-    return qLTISys_DiscreteFIRUpdate( s->w, s->k, s->wsize, x );
+    return qLTISys_DiscreteFIRCircular( s->w, s->k, s->wsize, &s->head, x );
 }
 /*============================================================================*/
 static float qSSmoother_Filter_KLMN( _qSSmoother_t * const f,